@@ -0,0 +1,107 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+from reaktoro import (
+    AsyncWriter,
+    AsyncWriterBackPressure,
+    AsyncWriterOptions,
+)
+
+import pytest
+
+
+def _create_writer(capacity=4, backpressure=AsyncWriterBackPressure.Block):
+    options = AsyncWriterOptions()
+    options.active = True
+    options.capacity = capacity
+    options.backpressure = backpressure
+    writer = AsyncWriter(options)
+    writer.open()
+    return writer
+
+
+def _job(executed, value):
+    def job():
+        executed.append(value)
+    return job
+
+
+def _failing_job(executed, value, error):
+    def job():
+        executed.append(value)
+        raise error
+    return job
+
+
+def test_async_writer_executes_jobs_in_order():
+    writer = _create_writer()
+    assert writer.running()
+
+    executed = []
+    for i in range(100):
+        assert writer.push(_job(executed, i))
+
+    writer.flush()
+    assert executed == list(range(100))
+
+    writer.close()
+    assert not writer.running()
+    assert writer.dropped() == 0
+
+
+def test_async_writer_executes_jobs_immediately_when_not_open():
+    writer = AsyncWriter()
+
+    executed = []
+    assert writer.push(_job(executed, 1))
+    assert executed == [1]
+    assert not writer.running()
+
+
+@pytest.mark.parametrize("method", ["flush", "close"])
+def test_async_writer_rethrows_first_job_exception(method):
+    writer = _create_writer()
+
+    executed = []
+    writer.push(_job(executed, 0))
+    writer.push(_failing_job(executed, 1, ValueError("first")))
+    writer.push(_failing_job(executed, 2, RuntimeError("second")))
+    writer.push(_job(executed, 3))
+
+    with pytest.raises(ValueError, match="first"):
+        getattr(writer, method)()
+
+    # The jobs after the failing ones are still executed
+    assert executed == [0, 1, 2, 3]
+
+    # The exception is rethrown only once
+    writer.flush()
+    writer.close()
+
+
+def test_async_writer_drop_counts_discarded_jobs():
+    writer = _create_writer(capacity=1, backpressure=AsyncWriterBackPressure.Drop)
+
+    executed = []
+    pushed = [writer.push(_job(executed, i)) for i in range(1000)]
+
+    writer.close()
+
+    # Only the accepted jobs are executed, in the order they were pushed
+    assert executed == [i for i, accepted in enumerate(pushed) if accepted]
+    assert writer.dropped() == pushed.count(False)
@@ -0,0 +1,278 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "AsyncWriter.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Reaktoro {
+
+struct AsyncWriter::Impl
+{
+    /// The options of the writer
+    AsyncWriterOptions options;
+
+    /// The ring buffer of pending jobs
+    std::vector<Job> buffer;
+
+    /// The number of jobs consumed by the writer thread (only modified by the writer thread)
+    std::atomic<Index> head = {0};
+
+    /// The number of jobs pushed by the producer thread (only modified by the producer thread)
+    std::atomic<Index> tail = {0};
+
+    /// The number of jobs dropped because the queue was full
+    std::atomic<Index> dropped = {0};
+
+    /// The flag that signals the writer thread to stop after consuming all pending jobs
+    std::atomic<bool> stopping = {false};
+
+    /// The mutex used by the condition variables and to protect `error`
+    std::mutex mutex;
+
+    /// The condition variable used to wake up the writer thread
+    std::condition_variable consumer;
+
+    /// The condition variable used to wake up the producer thread
+    std::condition_variable producer;
+
+    /// The flag that indicates if the writer thread is waiting for new jobs
+    std::atomic<bool> consumer_waiting = {false};
+
+    /// The flag that indicates if the producer thread is waiting for free slots or for the jobs to be consumed
+    std::atomic<bool> producer_waiting = {false};
+
+    /// The first exception thrown by a job executed in the writer thread
+    std::exception_ptr error;
+
+    /// The writer thread
+    std::thread thread;
+
+    Impl()
+    {}
+
+    Impl(const AsyncWriterOptions& options)
+    : options(options)
+    {}
+
+    ~Impl()
+    {
+        try { close(); } catch(...) {}
+    }
+
+    auto open() -> void
+    {
+        close();
+
+        if(!options.active)
+            return;
+
+        buffer.assign(std::max<Index>(options.capacity, 1), Job());
+        head = 0;
+        tail = 0;
+        stopping = false;
+        thread = std::thread([&]() { run(); });
+    }
+
+    auto run() -> void
+    {
+        const Index capacity = buffer.size();
+        while(true)
+        {
+            const Index h = head.load(std::memory_order_relaxed);
+
+            // Read `stopping` before `tail` so that all jobs pushed before close are consumed
+            const bool stop = stopping.load(std::memory_order_acquire);
+
+            if(h == tail.load(std::memory_order_acquire))
+            {
+                if(stop)
+                    break;
+                wait(consumer, consumer_waiting, [&]() {
+                    return h != tail.load(std::memory_order_acquire) || stopping.load(std::memory_order_acquire); });
+                continue;
+            }
+
+            Job job = std::move(buffer[h % capacity]);
+            buffer[h % capacity] = nullptr;
+
+            try { job(); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error) error = std::current_exception();
+            }
+
+            head.store(h + 1, std::memory_order_release);
+            notify(producer, producer_waiting);
+        }
+    }
+
+    /// Block the calling thread on a condition variable until a predicate holds.
+    /// The wait is announced in a flag, so that the other thread takes the mutex to notify it only when needed.
+    template<typename Predicate>
+    auto wait(std::condition_variable& cv, std::atomic<bool>& waiting, const Predicate& ready) -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        waiting.store(true, std::memory_order_relaxed);
+
+        // Order the flag before the loads in the predicate, pairing with the fence in `notify`
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        cv.wait(lock, ready);
+        waiting.store(false, std::memory_order_relaxed);
+    }
+
+    /// Wake up the thread waiting on a condition variable, if any, after the state it waits for was published.
+    auto notify(std::condition_variable& cv, const std::atomic<bool>& waiting) -> void
+    {
+        // Order the published state before the load of the flag, pairing with the fence in `wait`
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if(!waiting.load(std::memory_order_relaxed))
+            return;
+
+        // Notify under the mutex, so that the notification cannot fall between the waiter's check and its sleep
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    }
+
+    auto push(Job job) -> bool
+    {
+        if(!thread.joinable())
+        {
+            job();
+            return true;
+        }
+
+        const Index capacity = buffer.size();
+        const Index t = tail.load(std::memory_order_relaxed);
+        auto full = [&]() { return t - head.load(std::memory_order_acquire) >= capacity; };
+
+        while(full())
+        {
+            if(options.backpressure == AsyncWriterBackPressure::Drop)
+            {
+                ++dropped;
+                return false;
+            }
+            wait(producer, producer_waiting, [&]() { return !full(); });
+        }
+
+        buffer[t % capacity] = std::move(job);
+        tail.store(t + 1, std::memory_order_release);
+        notify(consumer, consumer_waiting);
+
+        return true;
+    }
+
+    auto rethrow() -> void
+    {
+        std::exception_ptr eptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::swap(eptr, error);
+        }
+        if(eptr)
+            std::rethrow_exception(eptr);
+    }
+
+    auto flush() -> void
+    {
+        if(thread.joinable())
+        {
+            const Index t = tail.load(std::memory_order_relaxed);
+            auto done = [&]() { return head.load(std::memory_order_acquire) == t; };
+            if(!done())
+                wait(producer, producer_waiting, done);
+        }
+        rethrow();
+    }
+
+    auto close() -> void
+    {
+        if(thread.joinable())
+        {
+            stopping.store(true, std::memory_order_release);
+            notify(consumer, consumer_waiting);
+            thread.join();
+            buffer.clear();
+        }
+        rethrow();
+    }
+};
+
+AsyncWriter::AsyncWriter()
+: pimpl(new Impl())
+{}
+
+AsyncWriter::AsyncWriter(const AsyncWriterOptions& options)
+: pimpl(new Impl(options))
+{}
+
+AsyncWriter::~AsyncWriter()
+{}
+
+auto AsyncWriter::setOptions(const AsyncWriterOptions& options) -> void
+{
+    pimpl->close();
+    pimpl->options = options;
+}
+
+auto AsyncWriter::options() const -> const AsyncWriterOptions&
+{
+    return pimpl->options;
+}
+
+auto AsyncWriter::open() -> void
+{
+    pimpl->open();
+}
+
+auto AsyncWriter::push(Job job) -> bool
+{
+    return pimpl->push(std::move(job));
+}
+
+auto AsyncWriter::flush() -> void
+{
+    pimpl->flush();
+}
+
+auto AsyncWriter::close() -> void
+{
+    pimpl->close();
+}
+
+auto AsyncWriter::running() const -> bool
+{
+    return pimpl->thread.joinable();
+}
+
+auto AsyncWriter::dropped() const -> Index
+{
+    return pimpl->dropped;
+}
+
+} // namespace Reaktoro
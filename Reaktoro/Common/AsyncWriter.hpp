@@ -0,0 +1,109 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// The policy of an AsyncWriter instance when its queue of pending jobs is full.
+enum class AsyncWriterBackPressure
+{
+    /// Block the producer thread until the writer thread frees a slot in the queue.
+    Block,
+
+    /// Discard the new job and count it as dropped.
+    Drop,
+};
+
+/// The options for the asynchronous output of ChemicalOutput and ChemicalPlot instances.
+/// @see AsyncWriter
+struct AsyncWriterOptions
+{
+    /// The boolean flag that indicates if output jobs are executed by a background writer thread.
+    /// If false, every job is executed on the calling thread as soon as it is pushed.
+    bool active = false;
+
+    /// The maximum number of pending jobs in the queue of the writer thread.
+    Index capacity = 1024;
+
+    /// The policy used when the queue of pending jobs is full.
+    AsyncWriterBackPressure backpressure = AsyncWriterBackPressure::Block;
+};
+
+/// A class that executes output jobs in order on a background writer thread.
+/// Jobs are pushed by a single producer thread to a bounded lock-free queue and
+/// consumed by the writer thread, so that formatting and writing of output files
+/// happen off the critical path of the calculations. Every job pushed before
+/// a call to @ref flush or @ref close is guaranteed to have been executed when
+/// these methods return.
+class AsyncWriter
+{
+public:
+    /// A type to describe an output job.
+    using Job = std::function<void()>;
+
+    /// Construct a default AsyncWriter instance, which executes jobs synchronously.
+    AsyncWriter();
+
+    /// Construct an AsyncWriter instance with given options.
+    explicit AsyncWriter(const AsyncWriterOptions& options);
+
+    /// Destroy this AsyncWriter instance after executing all pending jobs.
+    ~AsyncWriter();
+
+    /// Set the options of the writer, closing it first if it is open.
+    auto setOptions(const AsyncWriterOptions& options) -> void;
+
+    /// Return the options of the writer.
+    auto options() const -> const AsyncWriterOptions&;
+
+    /// Start the writer thread if the asynchronous output is active.
+    auto open() -> void;
+
+    /// Push a job to be executed by the writer thread.
+    /// The job is executed immediately on the calling thread if the writer is not open.
+    /// @return false if the job was dropped because the queue was full, true otherwise
+    auto push(Job job) -> bool;
+
+    /// Wait until all pushed jobs have been executed.
+    /// Rethrow the first exception thrown by a job, if any.
+    auto flush() -> void;
+
+    /// Execute all pending jobs and stop the writer thread.
+    /// Rethrow the first exception thrown by a job, if any.
+    auto close() -> void;
+
+    /// Return true if the writer thread is running.
+    auto running() const -> bool;
+
+    /// Return the number of jobs dropped because the queue was full.
+    auto dropped() const -> Index;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
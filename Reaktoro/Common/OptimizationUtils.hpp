@@ -21,6 +21,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 
 namespace Reaktoro {
@@ -29,12 +30,19 @@ template <typename Ret, typename... Args>
 auto memoize(std::function<Ret(Args...)> f) -> std::function<Ret(Args...)>
 {
     auto cache = std::make_shared<std::map<std::tuple<Args...>, Ret>>();
+    auto mutex = std::make_shared<std::mutex>(); // the cache is shared by all copies of the returned function
     return [=](Args... args) mutable -> Ret
     {
         std::tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        {
+            std::lock_guard<std::mutex> lock(*mutex);
+            auto it = cache->find(t);
+            if(it != cache->end())
+                return it->second;
+        }
+        Ret result = f(args...);
+        std::lock_guard<std::mutex> lock(*mutex);
+        return cache->emplace(t, result).first->second;
     };
 }
 
@@ -0,0 +1,71 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+from reaktoro import (
+    convert,
+    UnitConverter,
+)
+
+import pytest
+
+
+@pytest.mark.parametrize("value, from_unit, to_unit", [
+    (25.0, "celsius", "fahrenheit"),
+    (77.0, "fahrenheit", "celsius"),
+    (300.0, "kelvin", "celsius"),
+    (25.0, "celsius", "kelvin"),
+    (-40.0, "degC", "degF"),
+    (500.0, "rankine", "kelvin"),
+    (2.5, "kg", "g"),
+    (1.0, "mol/(m2*s)", "mmol/(cm2*s)"),
+    (3.0, "bar", "bar"),
+])
+def test_unit_converter_matches_convert(value, from_unit, to_unit):
+    converter = UnitConverter(from_unit, to_unit)
+    assert converter(value) == pytest.approx(convert(value, from_unit, to_unit))
+    assert converter(value) == pytest.approx(converter.factor() * value + converter.offset())
+
+
+def test_affine_temperature_conversions():
+    assert convert(25.0, "celsius", "fahrenheit") == pytest.approx(77.0)
+    assert convert(77.0, "fahrenheit", "celsius") == pytest.approx(25.0)
+    assert convert(-40.0, "celsius", "fahrenheit") == pytest.approx(-40.0)
+    assert convert(300.0, "kelvin", "celsius") == pytest.approx(26.85)
+    assert convert(25.0, "celsius", "kelvin") == pytest.approx(298.15)
+
+    converter = UnitConverter("celsius", "fahrenheit")
+    assert converter.factor() == pytest.approx(1.8)
+    assert converter.offset() == pytest.approx(32.0)
+
+
+def test_conversion_to_same_unit():
+    assert convert(3.0, "bar", "bar") == 3.0
+    assert convert(25.0, "celsius", "celsius") == 25.0
+
+    converter = UnitConverter("kg", "kg")
+    assert converter.factor() == 1.0
+    assert converter.offset() == 0.0
+
+
+def test_conversion_with_unknown_unit():
+    # The unit is checked even if it is converted to itself
+    with pytest.raises(RuntimeError):
+        convert(1.0, "foo", "foo")
+    with pytest.raises(RuntimeError):
+        UnitConverter("foo", "foo")
+    with pytest.raises(RuntimeError):
+        convert(1.0, "foo", "m")
@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+#include "Units.hpp"
+
 // C++ includes
 #include <algorithm>
 #include <cmath>
@@ -22,6 +24,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -469,6 +472,36 @@ double convertTemperature(double value, const string& from, const string& to)
     return fromKelvin(toKelvin(value, from), to);
 }
 
+/// An affine transformation `a*x + b` stored as the pair (a, b)
+using Affine = std::pair<double, double>;
+
+Affine toKelvin(const string& from)
+{
+    if(from == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(from);
+    const Affine next = toKelvin(unit.symbol);
+    return {next.first/unit.factor, next.second - next.first*unit.translate/unit.factor};
+}
+
+Affine fromKelvin(const string& to)
+{
+    if(to == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(to);
+    const Affine next = fromKelvin(unit.symbol);
+    return {unit.factor*next.first, unit.factor*next.second + unit.translate};
+}
+
+Affine convertTemperature(const string& from, const string& to)
+{
+    checkTemperatureUnit(from);
+    checkTemperatureUnit(to);
+
+    const Affine a = toKelvin(from);
+    const Affine b = fromKelvin(to);
+
+    return {b.first*a.first, b.first*a.second + b.second};
+}
+
 double factor(const string& symbol)
 {
     if(temperatureUnitsMap.count(symbol)) return 1.0;
@@ -639,25 +672,79 @@ inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to
     }
 }
 
+Affine conversion(const string& from, const string& to)
+{
+    // Check the unit is known before skipping the conversion to itself
+    if(from == to)
+    {
+        if(!temperatureUnitsMap.count(from))
+            dimension(parseUnit(from));
+        return {1.0, 0.0};
+    }
+    if(temperatureUnitsMap.count(from) && temperatureUnitsMap.count(to))
+        return convertTemperature(from, to);
+    auto parsed_from = parseUnit(from);
+    auto parsed_to   = parseUnit(to);
+    checkConvertibleUnits(parsed_from, parsed_to, from, to);
+    return {factor(parsed_from)/factor(parsed_to), 0.0};
+}
+
+/// The conversions already calculated for pairs of units
+map<std::pair<string, string>, Affine> conversions;
+
+/// The maximum number of cached conversions, beyond which the cache is cleared before it grows further
+const std::size_t max_conversions = 1024;
+
+/// The mutex that protects the map of conversions
+std::mutex conversions_mutex;
+
+Affine cachedConversion(const string& from, const string& to)
+{
+    const auto key = std::make_pair(from, to);
+    {
+        std::lock_guard<std::mutex> lock(conversions_mutex);
+        auto iter = conversions.find(key);
+        if(iter != conversions.end())
+            return iter->second;
+    }
+    const Affine res = conversion(from, to);
+    std::lock_guard<std::mutex> lock(conversions_mutex);
+    if(conversions.size() >= max_conversions)
+        conversions.clear();
+    conversions.emplace(key, res);
+    return res;
+}
+
 } // namespace internal
 
 double convert(double value, const string& from, const string& to)
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
-        return internal::convertTemperature(value, from, to);
-    auto parsed_from = internal::parseUnit(from);
-    auto parsed_to   = internal::parseUnit(to);
-    internal::checkConvertibleUnits(parsed_from, parsed_to, from, to);
-    return value * internal::factor(parsed_from)/internal::factor(parsed_to);
+    const internal::Affine res = internal::cachedConversion(from, to);
+    return res.first * value + res.second;
 }
 
 bool convertible(const std::string& from, const std::string& to)
 {
     if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
         return true;
+    {
+        std::lock_guard<std::mutex> lock(internal::conversions_mutex);
+        if(internal::conversions.count({from, to}))
+            return true;
+    }
     auto parsed_from = internal::parseUnit(from);
     auto parsed_to   = internal::parseUnit(to);
     return dimension(parsed_from) == dimension(parsed_to);
 }
 
+UnitConverter::UnitConverter()
+{}
+
+UnitConverter::UnitConverter(const std::string& from, const std::string& to)
+{
+    const internal::Affine res = internal::cachedConversion(from, to);
+    scale = res.first;
+    shift = res.second;
+}
+
 } // namespace units
@@ -33,4 +33,41 @@ auto convert(double value, const std::string& from, const std::string& to) -> do
 /// @return True if they are convertible, false otherwise
 auto convertible(const std::string& from, const std::string& to) -> bool;
 
+/// A class used to convert numeric values from a unit to another.
+/// The unit strings are parsed only once, when the converter is created,
+/// and the conversion is then applied as an affine transformation.
+/// This is useful for converting many values between the same units.
+/// ~~~
+/// units::UnitConverter converter("degC", "K");
+/// for(double& T : temperatures)
+///     T = converter(T);
+/// ~~~
+class UnitConverter
+{
+public:
+    /// Construct a default UnitConverter instance, which does not change the values
+    UnitConverter();
+
+    /// Construct a UnitConverter instance between two given units
+    /// @param from The string representing the unit from which the conversion is made
+    /// @param to The string representing the unit to which the conversion is made
+    UnitConverter(const std::string& from, const std::string& to);
+
+    /// Convert a numeric value from the first unit to the second
+    auto operator()(double value) const -> double { return scale * value + shift; }
+
+    /// Return the factor that multiplies the values in the conversion
+    auto factor() const -> double { return scale; }
+
+    /// Return the offset that is added to the scaled values in the conversion (non-zero for temperatures only)
+    auto offset() const -> double { return shift; }
+
+private:
+    /// The factor that multiplies the values in the conversion
+    double scale = 1.0;
+
+    /// The offset that is added to the scaled values in the conversion
+    double shift = 0.0;
+};
+
 } /* namespace units */
@@ -24,6 +24,7 @@
 #include <cmath>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -67,6 +68,9 @@ struct ChemicalOutput::Impl
     /// The names of the quantities to appear as column header in the output.
     std::vector<std::string> headings;
 
+    /// The functions that evaluate the quantities to be output (empty for the iteration column).
+    std::vector<ChemicalQuantity::Function> functions;
+
     /// The floating-point precision in the output.
     int precision = 6;
 
@@ -88,6 +92,15 @@ struct ChemicalOutput::Impl
     /// The spacings between the columns
     std::vector<int> spacings;
 
+    /// The values of the quantities in the current update
+    std::vector<double> values;
+
+    /// The writer that formats and writes the output lines, possibly in a background thread
+    AsyncWriter writer;
+
+    /// The jobs that output the current line, its values and attachments, pushed to the writer as a single job
+    std::vector<AsyncWriter::Job> line;
+
     Impl()
     : quantity(system)
     {}
@@ -102,7 +115,7 @@ struct ChemicalOutput::Impl
 
     ~Impl()
     {
-        close();
+        try { close(); } catch(...) {}
     }
 
     auto spacing(std::string word) const -> std::size_t
@@ -135,6 +148,11 @@ struct ChemicalOutput::Impl
         // Set the floating-point precision in the output.
         datafile << std::setprecision(precision);
 
+        // Create the functions of the quantities once so that updates skip their lookup
+        functions.clear();
+        for(auto word : data)
+            functions.push_back(word == "i" ? ChemicalQuantity::Function() : quantity.function(word));
+
         // Determine the spacings between the columns
         spacings.clear();
         for(auto word : headings)
@@ -156,32 +174,55 @@ struct ChemicalOutput::Impl
             }
             ++icolumn;
         }
+
+        // Start the writer thread, if asynchronous output is active
+        writer.open();
     }
 
     auto close() -> void
     {
+        // Ensure all pending output lines are written before closing the file
+        pushLine();
+        writer.close();
         datafile.close();
     }
 
-    auto update(const ChemicalState& state, double t) -> void
+    auto flush() -> void
     {
-        // Output values on a new line
-        if(datafile.is_open()) datafile << std::endl;
-        if(terminal) std::cout << std::endl;
+        pushLine();
+        writer.flush();
+        if(datafile.is_open()) datafile.flush();
+    }
 
-        // Output the current chemical state to the data file.
+    auto update(const ChemicalState& state, double t) -> void
+    {
+        // Evaluate the quantities at the current chemical state
         quantity.update(state, t);
+        values.resize(functions.size());
+        for(Index i = 0; i < functions.size(); ++i)
+            values[i] = functions[i] ? functions[i]() : iteration;
 
-        // For each quantity, ouput its value on each column
-        icolumn = 0;
-        for(auto word : data)
+        // Push the previous line, now that all its attachments are known
+        pushLine();
+
+        // Format and output the values on a new line, to be pushed with its attachments
+        line.push_back([this, values = values]()
         {
-            auto space = spacings[icolumn];
-            auto val = (word == "i") ? iteration : quantity.value(word);
-            if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
-            if(terminal) std::cout << std::left << std::setw(space) << val;
-            ++icolumn;
-        }
+            // Output values on a new line
+            if(datafile.is_open()) datafile << std::endl;
+            if(terminal) std::cout << std::endl;
+
+            // For each quantity, ouput its value on each column
+            for(Index i = 0; i < values.size(); ++i)
+            {
+                auto space = spacings[i];
+                if(datafile.is_open()) datafile << std::left << std::setw(space) << values[i];
+                if(terminal) std::cout << std::left << std::setw(space) << values[i];
+            }
+        });
+
+        // Attachments are output in the columns after the quantities
+        icolumn = functions.size();
 
         // Update the iteration number
         ++iteration;
@@ -191,10 +232,26 @@ struct ChemicalOutput::Impl
     auto attach(ValueType value) -> void
     {
         auto space = spacings[icolumn];
-        if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
-        if(terminal) std::cout << std::left << std::setw(space) << value;
+        line.push_back([this, space, value]()
+        {
+            if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
+            if(terminal) std::cout << std::left << std::setw(space) << value;
+        });
         ++icolumn;
     }
+
+    /// Push the current line to the writer as one job, so that a dropped line drops its attachments too
+    auto pushLine() -> void
+    {
+        if(line.empty())
+            return;
+        writer.push([jobs = std::move(line)]()
+        {
+            for(const auto& job : jobs)
+                job();
+        });
+        line.clear();
+    }
 };
 
 ChemicalOutput::ChemicalOutput()
@@ -292,6 +349,18 @@ auto ChemicalOutput::terminal(bool enabled) -> void
     pimpl->terminal = enabled;
 }
 
+auto ChemicalOutput::asynchronous(bool enabled) -> void
+{
+    auto options = pimpl->writer.options();
+    options.active = enabled;
+    pimpl->writer.setOptions(options);
+}
+
+auto ChemicalOutput::asynchronous(const AsyncWriterOptions& options) -> void
+{
+    pimpl->writer.setOptions(options);
+}
+
 auto ChemicalOutput::quantities() const -> std::vector<std::string>
 {
     return pimpl->data;
@@ -312,6 +381,11 @@ auto ChemicalOutput::update(const ChemicalState& state, double t) -> void
     pimpl->update(state, t);
 }
 
+auto ChemicalOutput::flush() -> void
+{
+    pimpl->flush();
+}
+
 auto ChemicalOutput::close() -> void
 {
     pimpl->close();
@@ -26,6 +26,7 @@
 namespace Reaktoro {
 
 // Forward declarations
+struct AsyncWriterOptions;
 class ChemicalState;
 class ChemicalSystem;
 class ReactionSystem;
@@ -95,6 +96,16 @@ public:
     /// Enable or disable the output to the terminal.
     auto terminal(bool enabled) -> void;
 
+    /// Enable or disable the output in a background writer thread.
+    /// If enabled, the quantities are still evaluated in @ref update, but their
+    /// formatting and writing happen in a background thread. Each line is handed to
+    /// the writer thread together with its attachments, at the next update or when
+    /// the output is flushed or closed, so that a dropped line drops its attachments too.
+    auto asynchronous(bool enabled) -> void;
+
+    /// Set the options of the output in a background writer thread.
+    auto asynchronous(const AsyncWriterOptions& options) -> void;
+
     /// Return the name of the quantities in the output file.
     auto quantities() const -> std::vector<std::string>;
 
@@ -107,7 +118,10 @@ public:
     /// Update the output with a new chemical state and its tag.
     auto update(const ChemicalState& state, double t) -> void;
 
-    /// Close the output file.
+    /// Wait until all pending output has been written.
+    auto flush() -> void;
+
+    /// Write all pending output and close the output file.
     auto close() -> void;
 
     /// Convert this ChemicalOutput instance to bool.
@@ -26,6 +26,7 @@
 #include <boost/format.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -161,6 +162,12 @@ struct ChemicalPlot::Impl
     /// The ID of this ChemicalPlot instance (by order of creation)
     unsigned id;
 
+    /// The functions that evaluate the quantities along the y-axis (empty for the iteration column).
+    std::vector<ChemicalQuantity::Function> functions;
+
+    /// The writer that outputs the data lines and refreshes the plot, possibly in a background thread
+    AsyncWriter writer;
+
     Impl()
     : quantity(system)
     {
@@ -181,7 +188,7 @@ struct ChemicalPlot::Impl
 
     ~Impl()
     {
-        close();
+        try { close(); } catch(...) {}
     }
 
     auto open() -> void
@@ -280,10 +287,21 @@ struct ChemicalPlot::Impl
 
         // Flush the plot file to ensure its correct state before the plot starts
         plotfile.flush();
+
+        // Create the functions of the quantities along the y-axis once so that updates skip their lookup
+        functions.clear();
+        for(auto item : y)
+            functions.push_back(std::get<1>(item) == "i" ? ChemicalQuantity::Function() : quantity.function(std::get<1>(item)));
+
+        // Start the writer thread, if asynchronous output is active
+        writer.open();
     }
 
     auto close() -> void
     {
+        // Ensure all pending data lines are written before Gnuplot is signaled to stop
+        writer.close();
+
         if(pipe != nullptr)
         {
             // Create the file that signals Gnuplot to stop rereading the input script
@@ -305,24 +323,29 @@ struct ChemicalPlot::Impl
 
     auto update(const ChemicalState& state, double t) -> void
     {
-        // Output the current chemical state to the data file.
+        // Evaluate the quantities at the current chemical state
         quantity.update(state, t);
-        datafile << std::left << std::setw(20) << quantity.value(x);
-        for(auto item : y)
+        std::vector<double> values;
+        values.reserve(functions.size() + 1);
+        values.push_back(quantity.value(x));
+        for(const auto& func : functions)
+            values.push_back(func ? func() : iteration);
+
+        // Output the values to the data file and refresh the plot in the writer
+        writer.push([this, values = std::move(values)]()
         {
-            std::string qstr = std::get<1>(item);
-            auto val = (qstr == "i") ? iteration : quantity.value(qstr);
-            datafile << std::left << std::setw(20) << val;
-        }
-        datafile << std::endl;
+            for(auto val : values)
+                datafile << std::left << std::setw(20) << val;
+            datafile << std::endl;
 
-        // Open the Gnuplot plot after the first data has been output to the data file.
-        // This ensures that Gnuplot opens the plot without errors/warnings.
-        if(pipe == nullptr)
-        {
-            std::string command = ("gnuplot -persist -e \"current=''\" " + plotname + " >> gnuplot.log 2>&1");
-            pipe = popen(command.c_str(), "w");
-        }
+            // Open the Gnuplot plot after the first data has been output to the data file.
+            // This ensures that Gnuplot opens the plot without errors/warnings.
+            if(pipe == nullptr)
+            {
+                std::string command = ("gnuplot -persist -e \"current=''\" " + plotname + " >> gnuplot.log 2>&1");
+                pipe = popen(command.c_str(), "w");
+            }
+        });
 
         // Update the iteration number
         ++iteration;
@@ -452,6 +475,18 @@ auto ChemicalPlot::frequency(unsigned frequency) -> void
     pimpl->frequency = frequency;
 }
 
+auto ChemicalPlot::asynchronous(bool enabled) -> void
+{
+    auto options = pimpl->writer.options();
+    options.active = enabled;
+    pimpl->writer.setOptions(options);
+}
+
+auto ChemicalPlot::asynchronous(const AsyncWriterOptions& options) -> void
+{
+    pimpl->writer.setOptions(options);
+}
+
 auto ChemicalPlot::operator<<(std::string command) -> ChemicalPlot&
 {
     pimpl->config.append(command + "\n");
@@ -474,6 +509,11 @@ auto ChemicalPlot::update(const ChemicalState& state, double t) -> void
     pimpl->update(state, t);
 }
 
+auto ChemicalPlot::flush() -> void
+{
+    pimpl->writer.flush();
+}
+
 auto ChemicalPlot::operator==(const ChemicalPlot& other) -> bool
 {
     return pimpl == other.pimpl;
@@ -26,6 +26,7 @@
 namespace Reaktoro {
 
 // Forward declarations
+struct AsyncWriterOptions;
 class ChemicalState;
 class ChemicalSystem;
 class ReactionSystem;
@@ -167,6 +168,12 @@ public:
     /// Set the refresh rate of the real-time plot.
     auto frequency(unsigned frequency) -> void;
 
+    /// Enable or disable the output of the plot data in a background writer thread.
+    auto asynchronous(bool enabled) -> void;
+
+    /// Set the options of the output of the plot data in a background writer thread.
+    auto asynchronous(const AsyncWriterOptions& options) -> void;
+
     /// Inject a gnuplot command to the script file.
     auto operator<<(std::string command) -> ChemicalPlot&;
 
@@ -179,6 +186,9 @@ public:
     /// Update the plot with a new chemical state and a tag.
     auto update(const ChemicalState& state, double t) -> void;
 
+    /// Wait until all pending plot data has been written.
+    auto flush() -> void;
+
     /// Compare a ChemicalPlot instance for equality
     auto operator==(const ChemicalPlot& other) -> bool;
 
@@ -20,10 +20,33 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
 namespace Reaktoro {
 
+auto ChemicalPropertiesCounters::operator+=(const ChemicalPropertiesCounters& other) -> ChemicalPropertiesCounters&
+{
+    num_thermo_updates  += other.num_thermo_updates;
+    num_thermo_evals    += other.num_thermo_evals;
+    num_chemical_evals  += other.num_chemical_evals;
+    num_phase_skips     += other.num_phase_skips;
+    time_thermo_model   += other.time_thermo_model;
+    time_chemical_model += other.time_chemical_model;
+
+    if(time_thermo_model_phases.size() == 0)
+        time_thermo_model_phases = other.time_thermo_model_phases;
+    else if(other.time_thermo_model_phases.size() == time_thermo_model_phases.size())
+        time_thermo_model_phases += other.time_thermo_model_phases;
+
+    if(time_chemical_model_phases.size() == 0)
+        time_chemical_model_phases = other.time_chemical_model_phases;
+    else if(other.time_chemical_model_phases.size() == time_chemical_model_phases.size())
+        time_chemical_model_phases += other.time_chemical_model_phases;
+
+    return *this;
+}
+
 ChemicalProperties::ChemicalProperties()
 {}
 
@@ -35,12 +58,37 @@ ChemicalProperties::ChemicalProperties(const ChemicalSystem& system)
 
 auto ChemicalProperties::update(double T_, double P_) -> void
 {
+    stats.num_thermo_updates += 1;
+
     // Update both temperature and pressure
     if(T != T_ || P != P_)
     {
         T = T_;
         P = P_;
-        system.thermoModel()(tres, T, P);
+
+        // The chemical model results of all phases must be re-evaluated at the new temperature and pressure
+        cres_valid = false;
+
+        const Time begin = time();
+
+        if(phase_timing)
+        {
+            // Evaluate the thermodynamic model of each phase as done by the system model
+            Index offset = 0;
+            for(Index iphase = 0; iphase < num_phases; ++iphase)
+            {
+                const Time begin_phase = time();
+                const auto size = system.numSpeciesInPhase(iphase);
+                auto tp = tres.phaseProperties(iphase, offset, size);
+                system.phase(iphase).properties(tp, T_, P_);
+                stats.time_thermo_model_phases[iphase] += elapsed(begin_phase);
+                offset += size;
+            }
+        }
+        else system.thermoModel()(tres, T, P);
+
+        stats.num_thermo_evals += 1;
+        stats.time_thermo_model += elapsed(begin);
     }
 }
 
@@ -51,14 +99,9 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
            "The temperature or pressure values are invalid (NAN). "
            "Update these properties before calling this method!")
 
-    n = n_;
-    system.chemicalModel()(cres, T, P, n);
-
-    // Update mole fractions
-    Index offset = 0;
-    for(Index iphase = 0; iphase < num_phases; ++iphase)
+    // The function that updates the mole fractions of the species in a phase
+    auto update_mole_fractions = [&](Index offset, Index size)
     {
-        const auto size = system.numSpeciesInPhase(iphase);
         const auto np = rows(n, offset, size);
         const auto npc = Composition(np);
         auto xp = rows(x, offset, offset, size, size);
@@ -72,8 +115,52 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
             else
                 xp = 0.0;
         }
-        offset += size;
+    };
+
+    const Time begin = time();
+
+    if(system.hasPhaseModels())
+    {
+        // Evaluate the chemical model of each phase as done by the system model, but
+        // only for those phases whose species amounts changed since the last evaluation
+        Index offset = 0;
+        for(Index iphase = 0; iphase < num_phases; ++iphase)
+        {
+            const auto size = system.numSpeciesInPhase(iphase);
+            auto np = n.segment(offset, size);
+            if(cres_valid && np == n_.segment(offset, size))
+            {
+                stats.num_phase_skips += 1;
+                offset += size;
+                continue;
+            }
+            const Time begin_phase = phase_timing ? time() : Time();
+            np = n_.segment(offset, size);
+            auto cp = cres.phaseProperties(iphase, offset, size);
+            system.phase(iphase).properties(cp, T.val, P.val, np);
+            update_mole_fractions(offset, size);
+            if(phase_timing)
+                stats.time_chemical_model_phases[iphase] += elapsed(begin_phase);
+            offset += size;
+        }
+    }
+    else
+    {
+        n = n_;
+        system.chemicalModel()(cres, T, P, n);
+        Index offset = 0;
+        for(Index iphase = 0; iphase < num_phases; ++iphase)
+        {
+            const auto size = system.numSpeciesInPhase(iphase);
+            update_mole_fractions(offset, size);
+            offset += size;
+        }
     }
+
+    cres_valid = true;
+
+    stats.num_chemical_evals += 1;
+    stats.time_chemical_model += elapsed(begin);
 }
 
 auto ChemicalProperties::update(double T, double P, VectorConstRef n) -> void
@@ -89,6 +176,32 @@ auto ChemicalProperties::update(double T_, double P_, VectorConstRef n_, const T
     n = n_;
     tres = tres_;
     cres = cres_;
+    cres_valid = true;
+}
+
+auto ChemicalProperties::setPhaseTiming(bool active) -> void
+{
+    phase_timing = active && system.hasPhaseModels();
+    if(phase_timing && stats.time_thermo_model_phases.size() == 0)
+    {
+        stats.time_thermo_model_phases = zeros(num_phases);
+        stats.time_chemical_model_phases = zeros(num_phases);
+    }
+}
+
+auto ChemicalProperties::counters() const -> const ChemicalPropertiesCounters&
+{
+    return stats;
+}
+
+auto ChemicalProperties::resetCounters() -> void
+{
+    stats = ChemicalPropertiesCounters();
+    if(phase_timing)
+    {
+        stats.time_thermo_model_phases = zeros(num_phases);
+        stats.time_chemical_model_phases = zeros(num_phases);
+    }
 }
 
 auto ChemicalProperties::temperature() const -> Temperature
@@ -28,6 +28,39 @@
 
 namespace Reaktoro {
 
+/// A type used to count the evaluations of the thermodynamic and chemical models in ChemicalProperties.
+struct ChemicalPropertiesCounters
+{
+    /// The number of calls to ChemicalProperties::update with temperature and pressure
+    unsigned num_thermo_updates = 0;
+
+    /// The number of evaluations of the thermodynamic model (skipped if temperature and pressure did not change)
+    unsigned num_thermo_evals = 0;
+
+    /// The number of evaluations of the chemical model
+    unsigned num_chemical_evals = 0;
+
+    /// The number of phases whose chemical model evaluation was skipped because their species amounts did not change
+    unsigned num_phase_skips = 0;
+
+    /// The wall time spent for all evaluations of the thermodynamic model (in units of s)
+    double time_thermo_model = 0;
+
+    /// The wall time spent for all evaluations of the chemical model (in units of s)
+    double time_chemical_model = 0;
+
+    /// The wall time spent for the evaluations of the thermodynamic model of each phase (in units of s).
+    /// This is empty unless phase timing is active in ChemicalProperties.
+    Vector time_thermo_model_phases;
+
+    /// The wall time spent for the evaluations of the chemical model of each phase (in units of s).
+    /// This is empty unless phase timing is active in ChemicalProperties.
+    Vector time_chemical_model_phases;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const ChemicalPropertiesCounters& other) -> ChemicalPropertiesCounters&;
+};
+
 /// A class for querying thermodynamic and chemical properties of a chemical system.
 class ChemicalProperties
 {
@@ -44,6 +77,9 @@ public:
     auto update(double T, double P) -> void;
 
     /// Update the chemical properties of the chemical system.
+    /// If the chemical system has phase models (see ChemicalSystem::hasPhaseModels), only the
+    /// phases whose species amounts changed since the last update are re-evaluated, unless the
+    /// temperature or pressure changed in between.
     /// @param n The amounts of the species in the system (in units of mol)
     auto update(VectorConstRef n) -> void;
 
@@ -61,6 +97,18 @@ public:
     /// @param cres The result of the ChemicalModel function of the chemical system.
     auto update(double T, double P, VectorConstRef n, const ThermoModelResult& tres, const ChemicalModelResult& cres) -> void;
 
+    /// Set the timing of the thermodynamic and chemical models of each phase.
+    /// The per-phase timing is only possible if the chemical system has phase models
+    /// (see ChemicalSystem::hasPhaseModels). It is ignored otherwise.
+    /// @param active The boolean flag that indicates if the per-phase timing is active
+    auto setPhaseTiming(bool active) -> void;
+
+    /// Return the counters of the evaluations of the thermodynamic and chemical models.
+    auto counters() const -> const ChemicalPropertiesCounters&;
+
+    /// Reset the counters of the evaluations of the thermodynamic and chemical models.
+    auto resetCounters() -> void;
+
     /// Return the temperature of the system (in units of K).
     auto temperature() const -> Temperature;
 
@@ -220,6 +268,16 @@ private:
 
     /// The results of the evaluation of the PhaseChemicalModel functions of each phase.
     ChemicalModelResult cres;
+
+    /// The counters of the evaluations of the thermodynamic and chemical models.
+    ChemicalPropertiesCounters stats;
+
+    /// The boolean flag that indicates if the models of each phase are timed separately.
+    bool phase_timing = false;
+
+    /// The boolean flag that indicates if the chemical model results are consistent with the current
+    /// temperature, pressure and species amounts, so that unchanged phases need not be re-evaluated.
+    bool cres_valid = false;
 };
 
 } // namespace Reaktoro
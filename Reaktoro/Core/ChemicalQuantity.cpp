@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/ConvertUtils.hpp>
@@ -174,6 +175,12 @@ struct ChemicalQuantity::Impl
     /// The rates of the reactions in the chemical system (in units of mol/s).
     ChemicalVector rates;
 
+    /// The flag that indicates if `properties` corresponds to the current chemical state
+    bool properties_updated = false;
+
+    /// The flag that indicates if `rates` corresponds to the current chemical state
+    bool rates_updated = false;
+
     /// All created chemical quantity functions from formatted strings
     std::map<std::string, Function> function_map;
 
@@ -211,12 +218,33 @@ struct ChemicalQuantity::Impl
         P = state.pressure();
         n = state.speciesAmounts();
 
-        // Update the thermodynamic properties of the system
-        properties = system.properties(T, P, n);
+        // Mark the thermodynamic properties and reaction rates as outdated so that
+        // they are only evaluated if a quantity function actually requests them
+        properties_updated = false;
+        rates_updated = false;
+    }
 
-        // Update the rates of the reactions
-        if(!reactions.reactions().empty())
-            rates = reactions.rates(properties);
+    /// Return the thermodynamic properties of the system at the current chemical state
+    auto updatedProperties() -> const ChemicalProperties&
+    {
+        if(!properties_updated)
+        {
+            properties = system.properties(T, P, n);
+            properties_updated = true;
+        }
+        return properties;
+    }
+
+    /// Return the rates of the reactions at the current chemical state
+    auto updatedRates() -> const ChemicalVector&
+    {
+        if(!rates_updated)
+        {
+            if(!reactions.reactions().empty())
+                rates = reactions.rates(updatedProperties());
+            rates_updated = true;
+        }
+        return rates;
     }
 
     auto function(const ChemicalQuantity& quantity, std::string str) -> const Function&
@@ -244,6 +272,26 @@ struct ChemicalQuantity::Impl
     {
         return function(quantity, str)();
     }
+
+    auto values(const ChemicalQuantity& quantity, const std::vector<std::string>& quantities, const std::vector<ChemicalState>& states) -> Matrix
+    {
+        // Create the quantity functions only once for all chemical states
+        std::vector<Function> functions;
+        functions.reserve(quantities.size());
+        for(const auto& str : quantities)
+            functions.push_back(function(quantity, str));
+
+        // Evaluate the quantity functions at every chemical state, one row per state
+        Matrix res(states.size(), quantities.size());
+        for(Index i = 0; i < states.size(); ++i)
+        {
+            update(states[i], i);
+            for(Index j = 0; j < functions.size(); ++j)
+                res(i, j) = functions[j]();
+        }
+
+        return res;
+    }
 };
 
 ChemicalQuantity::ChemicalQuantity(const ChemicalSystem& system)
@@ -277,12 +325,12 @@ auto ChemicalQuantity::state() const -> const ChemicalState&
 
 auto ChemicalQuantity::properties() const -> const ChemicalProperties&
 {
-    return pimpl->properties;
+    return pimpl->updatedProperties();
 }
 
 auto ChemicalQuantity::rates() const -> const ChemicalVector&
 {
-    return pimpl->rates;
+    return pimpl->updatedRates();
 }
 
 auto ChemicalQuantity::tag() const -> double
@@ -317,6 +365,11 @@ auto ChemicalQuantity::operator()(std::string str) const -> double
     return value(str);
 }
 
+auto ChemicalQuantity::values(const std::vector<std::string>& quantities, const std::vector<ChemicalState>& states) -> Matrix
+{
+    return pimpl->values(*this, quantities, states);
+}
+
 namespace quantity {
 
 /// A type used to describe the list of arguments for quantity querying.
@@ -369,11 +422,11 @@ private:
 auto temperature(const ChemicalQuantity& quantity, std::string arguments) -> std::function<double()>
 {
     const Args args(arguments);
-    const std::string units = args.argument("units", "K");
+    const units::UnitConverter converter("K", args.argument("units", "K"));
     auto func = [=]() -> double
     {
         const double val = quantity.state().temperature();
-        return units::convert(val, "K", units);
+        return converter(val);
     };
     return func;
 }
@@ -381,11 +434,11 @@ auto temperature(const ChemicalQuantity& quantity, std::string arguments) -> std
 auto pressure(const ChemicalQuantity& quantity, std::string arguments) -> std::function<double()>
 {
     const Args args(arguments);
-    const std::string units = args.argument("units", "Pa");
+    const units::UnitConverter converter("Pa", args.argument("units", "Pa"));
     auto func = [=]() -> double
     {
         const double val = quantity.state().pressure();
-        return units::convert(val, "Pa", units);
+        return converter(val);
     };
     return func;
 }
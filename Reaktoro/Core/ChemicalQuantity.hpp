@@ -20,6 +20,7 @@
 // C++ includes
 #include <memory>
 #include <string>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Index.hpp>
@@ -39,6 +40,12 @@ class ReactionSystem;
 /// can be calculated at a chemical state whose temperature, pressure, and
 /// mole amounts of all species are known.
 ///
+/// The chemical properties and reaction rates of the chemical state are
+/// only evaluated when a requested quantity depends on them. Quantities
+/// such as temperature, pressure, or amounts and masses of elements,
+/// species and phases are thus computed without evaluating the
+/// thermodynamic and chemical models of the system.
+///
 /// In the example below, the volume of a phase named Gaseous and the pH
 /// of the aqueous phase (assuming both phases were defined in the chemical
 /// system) are retrieved:
@@ -150,6 +157,14 @@ public:
     /// Return the value of the quantity given as a formatted string.
     auto operator()(std::string str) const -> double;
 
+    /// Return the values of many quantities at many chemical states.
+    /// The quantity functions are created once and then evaluated for every chemical
+    /// state, which is updated in this ChemicalQuantity instance with its index as tag.
+    /// @param quantities The quantities given as formatted strings
+    /// @param states The chemical states at which the quantities are evaluated
+    /// @return The matrix of values, with one row per chemical state and one column per quantity
+    auto values(const std::vector<std::string>& quantities, const std::vector<ChemicalState>& states) -> Matrix;
+
 private:
     struct Impl;
 
@@ -91,6 +91,12 @@ struct ChemicalSystem::Impl
     /// The chemical model of the system
     ChemicalModel chemical_model;
 
+    /// The boolean flag that indicates if the models of the system are composed of the models of its phases
+    bool phase_models = false;
+
+    /// The boolean flag that indicates if the custom models of the system can be evaluated concurrently
+    bool reentrant_models = false;
+
     /// The formula matrix of the system
     Matrix formula_matrix;
 
@@ -103,6 +109,7 @@ struct ChemicalSystem::Impl
         initializeFormulaMatrix();
         initializeThermoModel();
         initializeChemicalModel();
+        phase_models = true;
     }
 
     Impl(const std::vector<Phase>& phaselist, const ThermoModel& tm, const ChemicalModel& cm)
@@ -257,6 +264,40 @@ auto ChemicalSystem::chemicalModel() const -> const ChemicalModel&
     return pimpl->chemical_model;
 }
 
+auto ChemicalSystem::hasPhaseModels() const -> bool
+{
+    return pimpl->phase_models;
+}
+
+auto ChemicalSystem::setReentrantModels(bool reentrant) -> void
+{
+    pimpl->reentrant_models = reentrant;
+}
+
+auto ChemicalSystem::hasReentrantModels() const -> bool
+{
+    return pimpl->phase_models || pimpl->reentrant_models;
+}
+
+auto ChemicalSystem::clone() const -> ChemicalSystem
+{
+    if(!hasPhaseModels())
+        return *this;
+    std::vector<Phase> copies;
+    copies.reserve(numPhases());
+    for(const Phase& phase : phases())
+    {
+        Phase copy;
+        copy.setName(phase.name());
+        copy.setType(phase.type());
+        copy.setSpecies(phase.species());
+        copy.setThermoModel(phase.thermoModel());
+        copy.setChemicalModel(phase.chemicalModel());
+        copies.push_back(copy);
+    }
+    return ChemicalSystem(copies);
+}
+
 auto ChemicalSystem::formulaMatrix() const -> MatrixConstRef
 {
     return pimpl->formula_matrix;
@@ -77,6 +77,25 @@ public:
     /// Return the chemical model of the system.
     auto chemicalModel() const -> const ChemicalModel&;
 
+    /// Return true if the thermodynamic and chemical models of the system are evaluated
+    /// phase by phase using the models of its phases, and false if custom models were given.
+    auto hasPhaseModels() const -> bool;
+
+    /// Set whether the custom thermodynamic and chemical models of the system can be evaluated concurrently.
+    /// This should be set only if the given models protect their own internal state, or keep one per thread.
+    auto setReentrantModels(bool reentrant) -> void;
+
+    /// Return true if the system and its clones can evaluate their models concurrently in different threads.
+    /// This is the case if the system has phase models, or if its custom models were declared reentrant.
+    /// @see hasPhaseModels, setReentrantModels, clone
+    auto hasReentrantModels() const -> bool;
+
+    /// Return a copy of this system whose phases have their own copies of the thermodynamic and chemical models.
+    /// The copy and this system can then be used concurrently by different threads, since the internal state
+    /// of the phase models is not shared. The copy shares the models of this system if custom models were given.
+    /// @see hasPhaseModels
+    auto clone() const -> ChemicalSystem;
+
     /// Return the formula matrix of the system
     /// The formula matrix is defined as the matrix whose entry `(j, i)`
     /// is given by the number of atoms of its `j`-th element in its `i`-th species.
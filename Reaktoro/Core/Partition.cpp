@@ -347,6 +347,16 @@ auto Partition::system() const -> const ChemicalSystem&
     return pimpl->system;
 }
 
+auto Partition::clone(const ChemicalSystem& system) const -> Partition
+{
+    Partition copy(system);
+    copy.setInertSpecies(indicesInertSpecies());
+    copy.setEquilibriumSpecies(indicesEquilibriumSpecies());
+    copy.setFluidPhases(indicesFluidPhases());
+    copy.setSolidPhases(indicesSolidPhases());
+    return copy;
+}
+
 auto Partition::numFluidPhases() const -> unsigned
 {
     return pimpl->indices_fluid_phases.size();
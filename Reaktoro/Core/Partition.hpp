@@ -114,6 +114,10 @@ public:
     /// Return the chemical system.
     auto system() const -> const ChemicalSystem&;
 
+    /// Return a copy of this partition for an identical chemical system.
+    /// @param system The chemical system instance (e.g., one returned by ChemicalSystem::clone)
+    auto clone(const ChemicalSystem& system) const -> Partition;
+
     /// Return the number of phases in the fluid partition.
     auto numFluidPhases() const -> unsigned;
 
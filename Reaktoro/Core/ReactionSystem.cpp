@@ -17,7 +17,11 @@
 
 #include "ReactionSystem.hpp"
 
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/SparseCore>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -39,6 +43,9 @@ auto stoichiometricMatrix(const ChemicalSystem& system, const std::vector<Reacti
     return S;
 }
 
+/// The type used to store the stoichiometric matrix in compressed row format
+using SparseStoichiometricMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
 } // namespace
 
 struct ReactionSystem::Impl
@@ -52,6 +59,18 @@ struct ReactionSystem::Impl
     /// The stoichiometric matrix of the reactions w.r.t. to all species in the system
     Matrix stoichiometric_matrix;
 
+    /// The stoichiometric matrix of the reactions in compressed row format
+    SparseStoichiometricMatrix sparse_stoichiometric_matrix;
+
+    /// The rows of the sparse stoichiometric matrix of the reactions without equilibrium constant functions
+    SparseStoichiometricMatrix sparse_stoichiometric_matrix_gibbs;
+
+    /// The indices of the reactions with equilibrium constant functions
+    Indices ireactions_lnk;
+
+    /// The function that calculates the rates of all reactions at once
+    ReactionRateVectorFunction rates;
+
     /// Construct a defaut ReactionSystem::Impl instance
     Impl()
     {}
@@ -62,6 +81,74 @@ struct ReactionSystem::Impl
     {
         // Initialize the stoichiometric matrix of the reactions
         stoichiometric_matrix = Reaktoro::stoichiometricMatrix(system, reactions);
+
+        // Initialize the sparse stoichiometric matrices of the reactions
+        const Index num_reactions = reactions.size();
+        const Index num_species = system.numSpecies();
+
+        std::vector<Eigen::Triplet<double>> triplets, triplets_gibbs;
+        for(Index i = 0; i < num_reactions; ++i)
+        {
+            const bool has_lnk = static_cast<bool>(reactions[i].equilibriumConstant());
+            if(has_lnk) ireactions_lnk.push_back(i);
+            for(Index j = 0; j < num_species; ++j)
+            {
+                const double vij = stoichiometric_matrix(i, j);
+                if(vij == 0.0) continue;
+                triplets.emplace_back(i, j, vij);
+                if(!has_lnk) triplets_gibbs.emplace_back(i, j, vij);
+            }
+        }
+
+        sparse_stoichiometric_matrix.resize(num_reactions, num_species);
+        sparse_stoichiometric_matrix.setFromTriplets(triplets.begin(), triplets.end());
+
+        sparse_stoichiometric_matrix_gibbs.resize(num_reactions, num_species);
+        sparse_stoichiometric_matrix_gibbs.setFromTriplets(triplets_gibbs.begin(), triplets_gibbs.end());
+    }
+
+    /// Calculate the ln equilibrium constants of all reactions
+    auto lnEquilibriumConstants(const ChemicalProperties& properties) const -> ThermoVector
+    {
+        const Index num_reactions = reactions.size();
+
+        // The temperature and pressure of the system
+        const double T = properties.temperature();
+        const double P = properties.pressure();
+
+        ThermoVector res(num_reactions);
+
+        // Calculate lnK = -S*G0/RT for the reactions without an equilibrium constant function, where S holds their stoichiometries
+        if(ireactions_lnk.size() < num_reactions)
+        {
+            const auto& S = sparse_stoichiometric_matrix_gibbs;
+            const ThermoVectorConstRef G0 = properties.standardPartialMolarGibbsEnergies();
+            const ThermoScalar RT = universalGasConstant * Temperature(T);
+            ThermoVector SG0(num_reactions);
+            SG0.val = S * G0.val;
+            SG0.ddT = S * G0.ddT;
+            SG0.ddP = S * G0.ddP;
+            res = -SG0/RT;
+        }
+
+        // Evaluate the equilibrium constant functions where they were provided
+        for(Index i : ireactions_lnk)
+            res[i] = reactions[i].equilibriumConstant()(T, P);
+
+        return res;
+    }
+
+    /// Calculate the ln reaction quotients of all reactions
+    auto lnReactionQuotients(const ChemicalProperties& properties) const -> ChemicalVector
+    {
+        const auto& S = sparse_stoichiometric_matrix;
+        const ChemicalVectorConstRef ln_a = properties.lnActivities();
+        ChemicalVector res(reactions.size(), system.numSpecies());
+        res.val = S * ln_a.val;
+        res.ddT = S * ln_a.ddT;
+        res.ddP = S * ln_a.ddP;
+        res.ddn = S * ln_a.ddn;
+        return res;
     }
 };
 
@@ -122,6 +209,11 @@ auto ReactionSystem::reaction(std::string name) const -> const Reaction&
     return pimpl->reactions[index];
 }
 
+auto ReactionSystem::setRates(const ReactionRateVectorFunction& rates) -> void
+{
+    pimpl->rates = rates;
+}
+
 auto ReactionSystem::stoichiometricMatrix() const -> MatrixConstRef
 {
     return pimpl->stoichiometric_matrix;
@@ -132,27 +224,29 @@ auto ReactionSystem::system() const -> const ChemicalSystem&
     return pimpl->system;
 }
 
+auto ReactionSystem::clone(const ChemicalSystem& system) const -> ReactionSystem
+{
+    if(numReactions() == 0)
+        return ReactionSystem();
+    ReactionSystem copy(system, reactions());
+    copy.setRates(pimpl->rates);
+    return copy;
+}
+
 auto ReactionSystem::lnEquilibriumConstants(const ChemicalProperties& properties) const -> ThermoVector
 {
-    const unsigned num_reactions = numReactions();
-    ThermoVector res(num_reactions);
-    for(unsigned i = 0; i < num_reactions; ++i)
-        res[i] = reaction(i).lnEquilibriumConstant(properties);
-    return res;
+    return pimpl->lnEquilibriumConstants(properties);
 }
 
 auto ReactionSystem::lnReactionQuotients(const ChemicalProperties& properties) const -> ChemicalVector
 {
-    const unsigned num_reactions = numReactions();
-    const unsigned num_species = system().numSpecies();
-    ChemicalVector res(num_reactions, num_species);
-    for(unsigned i = 0; i < num_reactions; ++i)
-        res[i] = reaction(i).lnReactionQuotient(properties);
-    return res;
+    return pimpl->lnReactionQuotients(properties);
 }
 
 auto ReactionSystem::rates(const ChemicalProperties& properties) const -> ChemicalVector
 {
+    if(pimpl->rates)
+        return pimpl->rates(properties);
     const unsigned num_reactions = numReactions();
     const unsigned num_species = system().numSpecies();
     ChemicalVector res(num_reactions, num_species);
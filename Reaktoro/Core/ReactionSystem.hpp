@@ -71,12 +71,23 @@ public:
     /// @param name The name of the reaction
     auto reaction(std::string name) const -> const Reaction&;
 
+    /// Set a function that calculates the kinetic rates of all reactions at once.
+    /// This function takes precedence over the rate functions of the individual
+    /// reactions in the calculation of @ref rates, which permits a vectorized
+    /// evaluation of the rates (e.g., see @ref createReactionRates).
+    /// @param rates The function that calculates the rates of all reactions
+    auto setRates(const ReactionRateVectorFunction& rates) -> void;
+
     /// Return the stoichiometric matrix of the reaction system.
     auto stoichiometricMatrix() const -> MatrixConstRef;
 
     /// Return the chemical system instance
     auto system() const -> const ChemicalSystem&;
 
+    /// Return a copy of this reaction system for an identical chemical system.
+    /// @param system The chemical system instance (e.g., one returned by ChemicalSystem::clone)
+    auto clone(const ChemicalSystem& system) const -> ReactionSystem;
+
     /// Calculate the equilibrium constants of the reactions.
     /// @param properties The chemical properties of the system
     auto lnEquilibriumConstants(const ChemicalProperties& properties) const -> ThermoVector;
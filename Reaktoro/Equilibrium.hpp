@@ -19,13 +19,17 @@
 
 #include <Reaktoro/Equilibrium/EquilibriumBalance.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumCompositionProblem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInitialGuess.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInverseBatchSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumInverseProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumInverseSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumPacketSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumPath.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumReactions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumStatistics.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumUtils.hpp>
@@ -0,0 +1,110 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumInitialGuess.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return true if any equilibrium species has positive amount.
+auto positive(VectorConstRef n, const Indices& ies) -> bool
+{
+    for(Index i : ies)
+        if(n[i] > 0.0)
+            return true;
+    return false;
+}
+
+} // namespace
+
+auto previousInitialGuess(const Partition& partition) -> EquilibriumInitialGuessProvider
+{
+    const Indices ies = partition.indicesEquilibriumSpecies();
+
+    EquilibriumInitialGuessProvider provider;
+    provider.name = "previous";
+    provider.function = [=](const ChemicalState& state, double T, double P, VectorConstRef be, EquilibriumInitialGuess& guess)
+    {
+        const auto& n = state.speciesAmounts();
+        if(!positive(n, ies))
+            return false;
+        guess.n = n;
+        guess.y.resize(0);
+        guess.z.resize(0);
+        return true;
+    };
+
+    return provider;
+}
+
+auto neighbourInitialGuess(const ChemicalState& other, const Partition& partition) -> EquilibriumInitialGuessProvider
+{
+    const Indices ies = partition.indicesEquilibriumSpecies();
+
+    EquilibriumInitialGuessProvider provider;
+    provider.name = "neighbour";
+    provider.function = [=, &other](const ChemicalState& state, double T, double P, VectorConstRef be, EquilibriumInitialGuess& guess)
+    {
+        const auto& n = other.speciesAmounts();
+        if(!positive(n, ies))
+            return false;
+        guess.n = n;
+        guess.y = other.elementDualPotentials();
+        guess.z = other.speciesDualPotentials();
+        return true;
+    };
+
+    return provider;
+}
+
+auto sensitivityInitialGuess(const EquilibriumSensitivity& sensitivity, const Partition& partition) -> EquilibriumInitialGuessProvider
+{
+    const Indices ies = partition.indicesEquilibriumSpecies();
+    const Matrix Ae = partition.formulaMatrixEquilibriumPartition();
+
+    EquilibriumInitialGuessProvider provider;
+    provider.name = "sensitivity";
+    provider.function = [=, &sensitivity](const ChemicalState& state, double T, double P, VectorConstRef be, EquilibriumInitialGuess& guess)
+    {
+        const auto& dndb = sensitivity.dndb;
+        const auto& n0 = state.speciesAmounts();
+
+        // Skip if the sensitivity has not been calculated for the equilibrium partition
+        if(Index(dndb.rows()) != ies.size() || dndb.cols() != be.rows())
+            return false;
+        if(!positive(n0, ies))
+            return false;
+
+        // Extrapolate the amounts of the equilibrium species, removing negative amounts
+        guess.n = n0;
+        const Vector ne0 = n0(ies);
+        guess.n(ies) = (ne0 + dndb * (be - Ae*ne0)).cwiseMax(0.0);
+        guess.y.resize(0);
+        guess.z.resize(0);
+        return true;
+    };
+
+    return provider;
+}
+
+} // namespace Reaktoro
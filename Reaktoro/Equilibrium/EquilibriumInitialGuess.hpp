@@ -0,0 +1,87 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <string>
+
+// Reaktoro includes
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class Partition;
+struct EquilibriumSensitivity;
+
+/// A type that describes an initial guess for an equilibrium calculation.
+struct EquilibriumInitialGuess
+{
+    /// The molar amounts of the species (in units of mol)
+    Vector n;
+
+    /// The dual potentials of the elements (in units of J/mol).
+    /// Leave it empty to keep the dual potentials of the chemical state being equilibrated.
+    Vector y;
+
+    /// The dual potentials of the species (in units of J/mol).
+    /// Leave it empty to keep the dual potentials of the chemical state being equilibrated.
+    Vector z;
+};
+
+/// The signature of a function that provides an initial guess for an equilibrium calculation.
+/// The function receives the chemical state being equilibrated, the temperature (in units of K),
+/// pressure (in units of Pa), and molar amounts of the elements in the equilibrium partition, and
+/// writes its initial guess into the given EquilibriumInitialGuess instance. It returns false if
+/// no initial guess can be provided.
+using EquilibriumInitialGuessFunction = std::function<bool(const ChemicalState&, double, double, VectorConstRef, EquilibriumInitialGuess&)>;
+
+/// A type that describes a named provider of initial guesses for equilibrium calculations.
+/// @see EquilibriumSolver::setInitialGuessProviders
+struct EquilibriumInitialGuessProvider
+{
+    /// The name of the provider, reported in EquilibriumResult when its initial guess is used
+    std::string name;
+
+    /// The function that computes the initial guess
+    EquilibriumInitialGuessFunction function;
+};
+
+/// Return a provider that uses the current chemical state as initial guess.
+/// In a transport calculation, this is the solution of the same cell at the previous time step.
+/// No initial guess is provided if all equilibrium species have zero amounts.
+/// @param partition The partition of the chemical system
+auto previousInitialGuess(const Partition& partition) -> EquilibriumInitialGuessProvider;
+
+/// Return a provider that uses another chemical state as initial guess.
+/// In a transport calculation, this is typically the solution of a neighbour cell.
+/// @param other The chemical state used as initial guess, which must outlive the provider
+/// @param partition The partition of the chemical system
+auto neighbourInitialGuess(const ChemicalState& other, const Partition& partition) -> EquilibriumInitialGuessProvider;
+
+/// Return a provider that extrapolates the current chemical state with its equilibrium sensitivity.
+/// The initial guess for the amounts of the equilibrium species is @f$n_0 + \partial n/\partial b\,(b_e - b_{e,0})@f$,
+/// where @f$n_0@f$ are the current amounts and @f$b_{e,0}@f$ the amounts of the elements they contain.
+/// Negative extrapolated amounts are set to zero.
+/// @param sensitivity The sensitivity of the current chemical state, which must outlive the provider
+/// @param partition The partition of the chemical system used to calculate the sensitivity
+auto sensitivityInitialGuess(const EquilibriumSensitivity& sensitivity, const Partition& partition) -> EquilibriumInitialGuessProvider;
+
+} // namespace Reaktoro
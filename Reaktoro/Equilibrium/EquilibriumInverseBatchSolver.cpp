@@ -0,0 +1,428 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumInverseBatchSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInverseProblem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Optimization/NonlinearSolver.hpp>
+
+namespace Reaktoro {
+
+struct EquilibriumInverseBatchSolver::Impl
+{
+    /// The solvers and the data used by a thread to solve a subset of the samples.
+    struct Worker
+    {
+        /// The chemical system of the worker
+        ChemicalSystem system;
+
+        /// The inverse equilibrium problem of the worker, whose constraint values change with the sample
+        EquilibriumInverseProblem problem;
+
+        /// The options of the inverse equilibrium calculations
+        EquilibriumOptions options;
+
+        /// The solver for the equilibrium calculations
+        EquilibriumSolver solver;
+
+        /// The solver for the non-linear problem in the titrant amounts
+        NonlinearSolver nonlinear_solver;
+
+        /// The non-linear problem in the titrant amounts, whose function is created only once
+        NonlinearProblem nonlinear_problem;
+
+        /// The residual of the non-linear problem
+        NonlinearResidual nonlinear_residual;
+
+        /// The chemical properties used to evaluate the equilibrium constraints, with the chemical system of the worker
+        ChemicalProperties properties;
+
+        /// The residuals of the equilibrium constraints
+        ResidualEquilibriumConstraints res;
+
+        /// The formula matrix of the titrants restricted to the equilibrium elements
+        Matrix Ce;
+
+        /// The indices of the equilibrium elements
+        Indices iee;
+
+        /// The initial amounts of the equilibrium elements of the current sample
+        Vector be0;
+
+        /// The amounts of the equilibrium elements of the current iteration
+        Vector be;
+
+        /// The temperature and pressure of the current sample
+        double T = 0.0, P = 0.0;
+
+        /// The chemical state of the current sample
+        ChemicalState* state = nullptr;
+
+        /// The copy of the given chemical state of a warm-started sample, used if the calculation fails
+        ChemicalState backup;
+
+        /// The accumulated equilibrium result of the current sample
+        EquilibriumResult sample;
+
+        /// The accumulated equilibrium result of all samples solved by the worker
+        EquilibriumResult total;
+
+        /// The number of samples warm-started by the worker
+        unsigned num_warmstarts = 0;
+
+        /// The number of warm-started samples solved again by the worker
+        unsigned num_retries = 0;
+
+        /// Construct a Worker instance for a given inverse equilibrium problem
+        Worker(const ChemicalSystem& system, const Partition& partition, const EquilibriumInverseProblem& problem_, const EquilibriumOptions& options)
+        : system(system), problem(problem_), options(options), solver(system), properties(system), backup(system)
+        {
+            solver.setOptions(options);
+            solver.setPartition(partition);
+
+            const Index Nt = problem.numTitrants();
+            const Index Nc = problem.numConstraints();
+
+            iee = partition.indicesEquilibriumElements();
+            Ce = rows(problem.formulaMatrixTitrants(), iee);
+
+            nonlinear_problem.n = Nt;
+            nonlinear_problem.m = Nc;
+            nonlinear_problem.A = Ce;
+
+            nonlinear_residual.jacobian.resize(Nc, Nt);
+
+            // Set the non-linear function of the non-linear problem, evaluated for the current sample
+            nonlinear_problem.f = [this](VectorConstRef x)
+            {
+                auto& F = nonlinear_residual.val;
+                auto& J = nonlinear_residual.jacobian;
+
+                // The amounts of elements in the equilibrium partition
+                be.noalias() = be0 + Ce*x;
+
+                // Solve the equilibrium problem with update `be`
+                sample += solver.solve(*state, T, P, be);
+
+                // Check if the equilibrium calculation converged
+                if(!sample.optimum.succeeded)
+                {
+                    // If not, solve using cold start
+                    state->setSpeciesAmounts(0.0);
+                    sample += solver.solve(*state, T, P, be);
+                }
+
+                // Check if the function evaluation was successful
+                nonlinear_residual.succeeded = sample.optimum.succeeded;
+
+                // Calculate the residual vector `F` and its Jacobian `J`, evaluating the models of the worker's system
+                problem.residualEquilibriumConstraints(x, *state, properties, res);
+                F = res.val;
+                problem.jacobianEquilibriumConstraints(res, solver.sensitivity().dndb, J);
+
+                return nonlinear_residual;
+            };
+        }
+
+        /// Solve the inverse equilibrium problem of a sample, returning true if the calculation succeeded
+        auto solve(ChemicalState& state_, double T_, double P_, VectorConstRef values, VectorConstRef b, VectorRef x, unsigned& iterations) -> bool
+        {
+            problem.setConstraintTargets(values);
+
+            state = &state_;
+            T = T_;
+            P = P_;
+            be0 = rows(b, iee);
+            nonlinear_problem.b = -be0;
+
+            state->setTemperature(T);
+            state->setPressure(P);
+
+            sample = {};
+            const NonlinearResult nonlinear = nonlinear_solver.solve(nonlinear_problem, x, options.nonlinear);
+            total += sample;
+            iterations += nonlinear.iterations;
+
+            return nonlinear.succeeded && sample.optimum.succeeded;
+        }
+    };
+
+    /// The inverse equilibrium problem solved for every sample
+    EquilibriumInverseProblem problem;
+
+    /// The options of the batch inverse equilibrium solver
+    EquilibriumInverseBatchOptions options;
+
+    /// The initial guess of the titrant amounts used when a sample is not warm-started
+    Vector x0;
+
+    /// The workers that solve the samples, one for each thread
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// The result of the last calculation
+    EquilibriumInverseBatchResult result;
+
+    /// Construct an Impl instance with given inverse equilibrium problem
+    Impl(const EquilibriumInverseProblem& problem)
+    : problem(problem)
+    {
+        // Replace zeros in the initial guess of the titrant amounts by small molar amounts
+        x0 = problem.titrantInitialAmounts();
+        x0 = (x0.array() > 0.0).select(x0, 1e-6);
+    }
+
+    /// Set the options of the batch inverse equilibrium solver
+    auto setOptions(const EquilibriumInverseBatchOptions& options_) -> void
+    {
+        options = options_;
+        workers.clear();
+    }
+
+    /// Return the number of threads used to solve a given number of chunks of samples
+    auto numThreads(Index num_chunks) const -> Index
+    {
+        if(!problem.system().hasReentrantModels())
+            return 1;
+        Index num_threads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, num_chunks));
+    }
+
+    /// Create a worker, with its own copy of the chemical system unless it is the first one
+    auto createWorker(bool first) const -> std::unique_ptr<Worker>
+    {
+        const ChemicalSystem& system = problem.system();
+        const ChemicalSystem copy = first ? system : system.clone();
+        const Partition partition = first ? problem.partition() : problem.partition().clone(copy);
+        return std::unique_ptr<Worker>(new Worker(copy, partition, problem, options.equilibrium));
+    }
+
+    /// Return the order in which the samples are solved, so that nearby samples are consecutive
+    auto ordering(VectorConstRef T, VectorConstRef P, MatrixConstRef values, MatrixConstRef b) const -> Indices
+    {
+        Indices order(T.rows());
+        std::iota(order.begin(), order.end(), 0);
+
+        if(!options.ordering)
+            return order;
+
+        // Compare two samples by temperature, pressure, constraint values and element amounts, in this order
+        auto less = [&](Index i, Index j)
+        {
+            if(T[i] != T[j]) return T[i] < T[j];
+            if(P[i] != P[j]) return P[i] < P[j];
+            for(Index k = 0; k < Index(values.cols()); ++k)
+                if(values(i, k) != values(j, k)) return values(i, k) < values(j, k);
+            for(Index k = 0; k < Index(b.cols()); ++k)
+                if(b(i, k) != b(j, k)) return b(i, k) < b(j, k);
+            return false;
+        };
+
+        std::sort(order.begin(), order.end(), less);
+
+        return order;
+    }
+
+    /// Solve the inverse equilibrium problem for a batch of samples
+    auto solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef values, MatrixConstRef b) -> void
+    {
+        const Index num_samples = states.size();
+        const Index num_titrants = problem.numTitrants();
+
+        Assert(Index(T.rows()) == num_samples && Index(P.rows()) == num_samples && Index(values.rows()) == num_samples && Index(b.rows()) == num_samples,
+            "Could not solve the inverse equilibrium problems.",
+            "Expecting as many temperatures, pressures, rows of constraint values and rows of element amounts as chemical states.");
+        Assert(Index(values.cols()) == problem.numConstraintTargets(),
+            "Could not solve the inverse equilibrium problems.",
+            "Expecting as many columns of target values as equilibrium constraints imposed by the user.");
+        Assert(Index(b.cols()) == problem.system().numElements(),
+            "Could not solve the inverse equilibrium problems.",
+            "Expecting as many columns of element amounts as elements in the chemical system.");
+
+        const Time begin = time();
+
+        // The samples in the order they are solved, split in chunks of consecutive samples
+        const Indices order = ordering(T, P, values, b);
+        const Index chunk_size = std::max<Index>(1, options.chunk_size);
+        const Index num_chunks = (num_samples + chunk_size - 1)/chunk_size;
+
+        // Create the workers if needed and reset their results
+        const Index num_threads = numThreads(num_chunks);
+        while(workers.size() < num_threads)
+            workers.push_back(createWorker(workers.empty()));
+        for(auto& worker : workers)
+        {
+            worker->total = {};
+            worker->num_warmstarts = 0;
+            worker->num_retries = 0;
+        }
+
+        result.titrants.resize(num_samples, num_titrants);
+        result.iterations.assign(num_samples, 0);
+
+        // The flags that indicate if the calculation of each sample succeeded
+        std::vector<char> succeeded(num_samples, 0);
+
+        // The index of the next chunk of samples to be solved
+        std::atomic<Index> next(0);
+
+        // The first exception thrown by a worker, if any
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        // The function executed by each thread, in which chunks of samples are solved one at a time
+        auto run = [&](Worker& worker)
+        {
+            try {
+                Vector x;
+                for(Index c = next++; c < num_chunks; c = next++)
+                {
+                    const Index first = c * chunk_size;
+                    const Index last = std::min(first + chunk_size, num_samples);
+
+                    for(Index j = first; j < last; ++j)
+                    {
+                        const Index k = order[j];
+                        const Index kprev = j > first ? order[j - 1] : num_samples;
+
+                        // Warm-start from the solution of the previous sample in the chunk if it succeeded
+                        const bool warm = options.warmstart && kprev < num_samples && succeeded[kprev];
+
+                        if(warm)
+                        {
+                            worker.backup = states[k];
+                            states[k] = states[kprev];
+                            x = result.titrants.row(kprev);
+                            ++worker.num_warmstarts;
+                        }
+                        else x = x0;
+
+                        bool ok = worker.solve(states[k], T[k], P[k], values.row(k), b.row(k), x, result.iterations[k]);
+
+                        // Solve the sample again from its given chemical state if the warm-started calculation failed
+                        if(!ok && warm)
+                        {
+                            states[k] = worker.backup;
+                            x = x0;
+                            ++worker.num_retries;
+                            ok = worker.solve(states[k], T[k], P[k], values.row(k), b.row(k), x, result.iterations[k]);
+                        }
+
+                        result.titrants.row(k) = x;
+                        succeeded[k] = ok;
+                    }
+                }
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) error = std::current_exception();
+                next = num_chunks;
+            }
+        };
+
+        // Solve the samples in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(*workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::ref(*workers[i]));
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        if(error)
+            std::rethrow_exception(error);
+
+        // Collect the failed samples and accumulate the results of the workers
+        result.failed.clear();
+        for(Index k = 0; k < num_samples; ++k)
+            if(!succeeded[k])
+                result.failed.push_back(k);
+
+        result.num_samples = num_samples;
+        result.num_failed = result.failed.size();
+        result.num_succeeded = num_samples - result.num_failed;
+        result.num_warmstarts = 0;
+        result.num_retries = 0;
+        result.total = {};
+        for(auto& worker : workers)
+        {
+            result.num_warmstarts += worker->num_warmstarts;
+            result.num_retries += worker->num_retries;
+            result.total += worker->total;
+        }
+
+        result.time = elapsed(begin);
+        result.throughput = result.time > 0.0 ? num_samples/result.time : 0.0;
+    }
+};
+
+EquilibriumInverseBatchSolver::EquilibriumInverseBatchSolver(const EquilibriumInverseProblem& problem)
+: pimpl(new Impl(problem))
+{}
+
+EquilibriumInverseBatchSolver::~EquilibriumInverseBatchSolver()
+{}
+
+auto EquilibriumInverseBatchSolver::operator=(EquilibriumInverseBatchSolver other) -> EquilibriumInverseBatchSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumInverseBatchSolver::setOptions(const EquilibriumInverseBatchOptions& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto EquilibriumInverseBatchSolver::problem() const -> const EquilibriumInverseProblem&
+{
+    return pimpl->problem;
+}
+
+auto EquilibriumInverseBatchSolver::solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef values, MatrixConstRef b) -> void
+{
+    pimpl->solve(states, T, P, values, b);
+}
+
+auto EquilibriumInverseBatchSolver::result() const -> const EquilibriumInverseBatchResult&
+{
+    return pimpl->result;
+}
+
+} // namespace Reaktoro
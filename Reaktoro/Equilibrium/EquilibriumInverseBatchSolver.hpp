@@ -0,0 +1,83 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class EquilibriumInverseProblem;
+struct EquilibriumInverseBatchOptions;
+struct EquilibriumInverseBatchResult;
+
+/// A class that solves the same inverse equilibrium problem for a batch of samples.
+/// The inverse equilibrium problem is prepared once, with its titrants and equilibrium constraints,
+/// and then solved for many samples, each with its own temperature, pressure, constraint values
+/// (e.g., pH and alkalinity) and initial amounts of elements. The samples are ordered so that nearby
+/// samples are solved consecutively, and distributed in chunks over a pool of threads, each owning
+/// an equilibrium solver and a non-linear solver that persist between samples and calls. Within
+/// a chunk, each sample is warm-started from the solution of the previous one.
+/// @see EquilibriumInverseProblem, EquilibriumInverseSolver
+class EquilibriumInverseBatchSolver
+{
+public:
+    /// Construct an EquilibriumInverseBatchSolver instance.
+    /// @param problem The inverse equilibrium problem solved for every sample
+    explicit EquilibriumInverseBatchSolver(const EquilibriumInverseProblem& problem);
+
+    /// Construct a copy of an EquilibriumInverseBatchSolver instance.
+    EquilibriumInverseBatchSolver(const EquilibriumInverseBatchSolver& other) = delete;
+
+    /// Destroy the EquilibriumInverseBatchSolver instance.
+    virtual ~EquilibriumInverseBatchSolver();
+
+    /// Assign an EquilibriumInverseBatchSolver instance to this instance.
+    auto operator=(EquilibriumInverseBatchSolver other) -> EquilibriumInverseBatchSolver&;
+
+    /// Set the options for the inverse equilibrium calculations.
+    auto setOptions(const EquilibriumInverseBatchOptions& options) -> void;
+
+    /// Return the inverse equilibrium problem solved for every sample.
+    auto problem() const -> const EquilibriumInverseProblem&;
+
+    /// Solve the inverse equilibrium problem for a batch of samples.
+    /// @param[in,out] states The initial guesses and the final chemical states of the samples
+    /// @param T The temperatures of the samples (in units of K)
+    /// @param P The pressures of the samples (in units of Pa)
+    /// @param values The target values of the equilibrium constraints, one row per sample, given as when the constraints
+    /// were imposed, in the same units (e.g., pH values for EquilibriumInverseProblem::pH; see EquilibriumInverseProblem::setConstraintTargets)
+    /// @param b The initial amounts of the elements, one row per sample (in units of mol)
+    auto solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef values, MatrixConstRef b) -> void;
+
+    /// Return the result of the last inverse equilibrium calculation.
+    auto result() const -> const EquilibriumInverseBatchResult&;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -24,6 +24,7 @@
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/ElementUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -43,27 +44,6 @@
 namespace Reaktoro {
 namespace {
 
-/// A type used to define the residual of an equilibrium constraint and its partial derivatives.
-struct ResidualEquilibriumConstraint
-{
-    /// Construct a default EquilibriumConstraintResult instance
-    ResidualEquilibriumConstraint()
-    : val(0.0) {};
-
-    /// Construct an EquilibriumConstraintResult instance from a ChemicalScalar instance
-    ResidualEquilibriumConstraint(const ChemicalScalar& scalar)
-    : val(scalar.val), ddn(scalar.ddn) {}
-
-    /// The residual value of the equilibrium constraint.
-    double val = 0.0;
-
-    /// The partial derivatives of the residual w.r.t. titrant amounts x.
-    Vector ddx;
-
-    /// The partial derivatives of the residual w.r.t. species amounts n.
-    Vector ddn;
-};
-
 /// A type used to represent a titrant and its attributes.
 struct Titrant
 {
@@ -160,9 +140,40 @@ auto createTitrant(std::string titrant, const ChemicalSystem& system) -> Titrant
 }
 
 /// A type used to define the functional signature of an equilibrium constraint.
-using EquilibriumConstraint =
-    std::function<ResidualEquilibriumConstraint
-        (VectorConstRef, const ChemicalState&)>;
+/// The function returns the residual of the constraint for a given constraint value and writes its partial
+/// derivatives w.r.t. titrant amounts x and species amounts n in the given rows, which are zero on entry.
+using EquilibriumConstraintFunction =
+    std::function<double
+        (double, VectorConstRef, const ChemicalState&, const ChemicalProperties&, RowVectorStridedRef, RowVectorStridedRef)>;
+
+/// Return the activity of H+ for a given pH.
+auto pHToActivity(double pH) -> double
+{
+    return std::pow(10.0, -pH);
+}
+
+/// A type used to define an equilibrium constraint compiled into the evaluation of all residuals.
+struct EquilibriumConstraint
+{
+    /// The function that evaluates the residual of the constraint and its partial derivatives.
+    EquilibriumConstraintFunction function;
+
+    /// The value of the constraint (e.g., the amount or activity of a species).
+    double value = 0.0;
+
+    /// The indices of the species whose amounts the residual depends on.
+    Indices species;
+
+    /// The boolean flag that indicates if the residual depends on the chemical properties of the state.
+    bool properties = false;
+
+    /// The boolean flag that indicates if the constraint was added internally (e.g., for mutually exclusive titrants)
+    /// and its value is a fixed parameter rather than a target given by the user.
+    bool internal = false;
+
+    /// The function that converts a target value, given as when the constraint was imposed, into the value of the constraint.
+    std::function<double(double)> convert;
+};
 
 } // namespace
 
@@ -183,6 +194,12 @@ struct EquilibriumInverseProblem::Impl
     /// The equilibrium constraint functions
     std::vector<EquilibriumConstraint> constraints;
 
+    /// The indices of the species whose amounts any of the residuals depends on
+    Indices constraints_species;
+
+    /// The boolean flag that indicates if any of the residuals depends on the chemical properties of the state
+    bool constraints_properties = false;
+
     /// The initial guess of the titrants (in units of mol)
     Vector titrant_initial_amounts;
 
@@ -213,24 +230,17 @@ struct EquilibriumInverseProblem::Impl
         // The index of the species
         const Index ispecies = system.indexSpeciesWithError(species);
 
-        // The number of species in the system
-        const Index num_species = system.numSpecies();
-
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar ni(num_species);
-
-        // Set the parial molar derivative of `ni`
-        ni.ddn[ispecies] = 1.0;
-
         // Define the amount constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            ni.val = state.speciesAmount(ispecies);
-            return ni - value;
+            ddn[ispecies] = 1.0;
+            return state.speciesAmount(ispecies) - value;
         };
+        f.species = {ispecies};
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a species activity constraint to the inverse equilibrium problem.
@@ -239,21 +249,19 @@ struct EquilibriumInverseProblem::Impl
         // The index of the species
         const Index ispecies = system.indexSpeciesWithError(species);
 
-        // The ln of the given activity value
-        const double ln_val = std::log(value);
-
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar ln_ai;
-
         // Define the activity constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            ln_ai = state.properties().lnActivities()[ispecies];
-            return ln_ai - ln_val;
+            const auto ln_ai = properties.lnActivities()[ispecies];
+            ddn = ln_ai.ddn;
+            return ln_ai.val - std::log(value);
         };
+        f.species = speciesInPhases({system.indexPhaseWithSpecies(ispecies)});
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a pE constraint to the inverse equilibrium problem.
@@ -263,13 +271,18 @@ struct EquilibriumInverseProblem::Impl
         const auto pE = ChemicalProperty::pE(system);
 
         // Define the activity constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            return pE(state.properties()) - value;
+            const ChemicalScalar res = pE(properties);
+            ddn = res.ddn;
+            return res.val - value;
         };
+        f.species = range<Index>(system.numSpecies());
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a Eh constraint to the inverse equilibrium problem.
@@ -279,13 +292,18 @@ struct EquilibriumInverseProblem::Impl
         const auto Eh = ChemicalProperty::Eh(system);
 
         // Define the activity constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            return Eh(state.properties()) - value;
+            const ChemicalScalar res = Eh(properties);
+            ddn = res.ddn;
+            return res.val - value;
         };
+        f.species = range<Index>(system.numSpecies());
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a total alkalinity constraint to the inverse equilibrium problem.
@@ -295,13 +313,18 @@ struct EquilibriumInverseProblem::Impl
         const auto alk = ChemicalProperty::alkalinity(system);
 
         // Define the activity constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            return alk(state.properties()) - value;
+            const ChemicalScalar res = alk(properties);
+            ddn = res.ddn;
+            return res.val - value;
         };
+        f.species = range<Index>(system.numSpecies());
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a phase amount constraint to the inverse equilibrium problem.
@@ -310,18 +333,19 @@ struct EquilibriumInverseProblem::Impl
         // The index of the species
         const Index iphase = system.indexPhaseWithError(phase);
 
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar np;
-
         // Define the phase volume constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            np = state.properties().phaseAmounts()[iphase];
-            return np - value;
+            const ChemicalVector values = properties.phaseAmounts();
+            ddn = values.ddn.row(iphase);
+            return values.val[iphase] - value;
         };
+        f.species = speciesInPhases({iphase});
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a phase mass constraint to the inverse equilibrium problem.
@@ -330,18 +354,19 @@ struct EquilibriumInverseProblem::Impl
         // The index of the species
         const Index iphase = system.indexPhaseWithError(phase);
 
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar mass;
-
         // Define the phase volume constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            mass = state.properties().phaseMasses()[iphase];
-            return mass - value;
+            const ChemicalVector values = properties.phaseMasses();
+            ddn = values.ddn.row(iphase);
+            return values.val[iphase] - value;
         };
+        f.species = speciesInPhases({iphase});
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a phase volume constraint to the inverse equilibrium problem.
@@ -350,18 +375,19 @@ struct EquilibriumInverseProblem::Impl
         // The index of the phase
         const Index iphase = system.indexPhaseWithError(phase);
 
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar Vp;
-
         // Define the phase volume constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            Vp = state.properties().phaseVolumes()[iphase];
-            return Vp - value;
+            const ChemicalVector values = properties.phaseVolumes();
+            ddn = values.ddn.row(iphase);
+            return values.val[iphase] - value;
         };
+        f.species = speciesInPhases({iphase});
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Add a sum of phase volumes constraint to the inverse equilibrium problem.
@@ -370,18 +396,19 @@ struct EquilibriumInverseProblem::Impl
         // The indices of the phases
         const Indices iphases = system.indicesPhases(phases);
 
-        // Auxiliary chemical scalar to avoid memory reallocation
-        ChemicalScalar Vp;
-
         // Define the phase volume constraint function
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            Vp = sum(rows(state.properties().phaseVolumes(), iphases));
-            return Vp - value;
+            const ChemicalScalar Vp = sum(rows(properties.phaseVolumes(), iphases));
+            ddn = Vp.ddn;
+            return Vp.val - value;
         };
+        f.species = speciesInPhases(iphases);
+        f.properties = true;
 
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, value);
     }
 
     /// Return the index of a titrant.
@@ -464,45 +491,135 @@ struct EquilibriumInverseProblem::Impl
         const double tau = 1e-20;
 
         // Define the mutually exclusive constraint function
-        ResidualEquilibriumConstraint res;
-        EquilibriumConstraint f = [=](VectorConstRef x, const ChemicalState& state) mutable
+        EquilibriumConstraint f;
+        f.function = [=](double value, VectorConstRef x, const ChemicalState& state, const ChemicalProperties& properties, RowVectorStridedRef ddx, RowVectorStridedRef ddn)
         {
-            const Index Nt = x.rows();
-
-            res.ddx.resize(Nt);
-
             const double x1 = x[i1];
             const double x2 = x[i2];
 
-            res.val = x1*x2 - tau;
-            res.ddx = x1 * unit(Nt, i2) + x2 * unit(Nt, i1);
+            ddx[i1] = x2;
+            ddx[i2] = x1;
 
-            return res;
+            return x1*x2 - value;
         };
 
+        // The smoothing parameter is not a target of the problem
+        f.internal = true;
+
         // Update the list of constraint functions
-        constraints.push_back(f);
+        addConstraint(f, tau);
+    }
+
+    /// Return the indices of the species in given phases.
+    auto speciesInPhases(const Indices& iphases) const -> Indices
+    {
+        return system.indicesSpeciesInPhases(iphases);
+    }
+
+    /// Add a constraint with given value to the inverse equilibrium problem, updating the data used to evaluate all constraints at once.
+    auto addConstraint(const EquilibriumConstraint& constraint, double value) -> void
+    {
+        constraints.push_back(constraint);
+        constraints.back().value = value;
+        constraints_species = unify(constraints_species, constraint.species);
+        constraints_properties = constraints_properties || constraint.properties;
+    }
+
+    /// Calculate the residual of the equilibrium constraints and their partial molar derivatives.
+    auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ResidualEquilibriumConstraints& res) const -> void
+    {
+        ChemicalProperties properties(system);
+        residualEquilibriumConstraints(x, state, properties, res);
     }
 
-    /// Return the residual of the equilibrium constraints and their partial molar derivatives.
-    auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state) const -> ResidualEquilibriumConstraints
+    /// Calculate the residual of the equilibrium constraints and their partial molar derivatives,
+    /// updating the given chemical properties with the state only if any of the constraints needs them.
+    auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ChemicalProperties& properties, ResidualEquilibriumConstraints& res) const -> void
     {
         const Index num_species = system.numSpecies();
         const Index num_constraints = constraints.size();
         const Index num_titrants = titrants.size();
-        ResidualEquilibriumConstraints res;
+
+        // Reset the residuals and their derivatives, reusing their memory if possible
         res.val.resize(num_constraints);
-        res.ddx.resize(num_constraints, num_titrants);
-        res.ddn.resize(num_constraints, num_species);
-        ResidualEquilibriumConstraint aux;
+        res.ddx.setZero(num_constraints, num_titrants);
+        res.ddn.setZero(num_constraints, num_species);
+
+        // Evaluate the chemical properties of the state once for all constraints, if needed
+        if(constraints_properties)
+            properties.update(state.temperature(), state.pressure(), state.speciesAmounts());
+
         for(Index i = 0; i < num_constraints; ++i)
+            res.val[i] = constraints[i].function(constraints[i].value, x, state, properties, res.ddx.row(i), res.ddn.row(i));
+    }
+
+    /// Return the values of the equilibrium constraints.
+    auto constraintValues() const -> Vector
+    {
+        Vector values(constraints.size());
+        for(Index i = 0; i < constraints.size(); ++i)
+            values[i] = constraints[i].value;
+        return values;
+    }
+
+    /// Set the values of the equilibrium constraints.
+    auto setConstraintValues(VectorConstRef values) -> void
+    {
+        Assert(Index(values.rows()) == constraints.size(),
+            "Could not set the values of the equilibrium constraints.",
+            "Expecting as many values as there are equilibrium constraints.");
+        for(Index i = 0; i < constraints.size(); ++i)
+            Assert(!constraints[i].internal || values[i] == constraints[i].value,
+                "Could not set the values of the equilibrium constraints.",
+                "The value of the constraint " + std::to_string(i) + " of two mutually exclusive titrants "
+                "is a fixed smoothing parameter and cannot be changed (use setConstraintTargets instead).");
+        for(Index i = 0; i < constraints.size(); ++i)
+            constraints[i].value = values[i];
+    }
+
+    /// Return the number of equilibrium constraints imposed by the user.
+    auto numConstraintTargets() const -> Index
+    {
+        Index count = 0;
+        for(const auto& constraint : constraints)
+            if(!constraint.internal)
+                ++count;
+        return count;
+    }
+
+    /// Set the values of the equilibrium constraints imposed by the user, as given when they were imposed.
+    auto setConstraintTargets(VectorConstRef values) -> void
+    {
+        Assert(Index(values.rows()) == numConstraintTargets(),
+            "Could not set the target values of the equilibrium constraints.",
+            "Expecting as many values as there are equilibrium constraints imposed by the user.");
+        Index k = 0;
+        for(auto& constraint : constraints)
         {
-            aux = constraints[i](x, state);
-            res.val[i]     = aux.val;
-            res.ddx.row(i) = aux.ddx.size() ? aux.ddx : zeros(num_titrants);
-            res.ddn.row(i) = aux.ddn.size() ? aux.ddn : zeros(num_species);
+            if(constraint.internal)
+                continue;
+            constraint.value = constraint.convert ? constraint.convert(values[k]) : values[k];
+            ++k;
         }
-        return res;
+    }
+
+    /// Set the function that converts the target value of a constraint, as given when it was imposed, into its value.
+    auto setConstraintConversion(Index iconstraint, const std::function<double(double)>& convert) -> void
+    {
+        constraints[iconstraint].convert = convert;
+    }
+
+    /// Calculate the Jacobian of the residuals of the equilibrium constraints w.r.t. the titrant amounts.
+    auto jacobianEquilibriumConstraints(const ResidualEquilibriumConstraints& res, MatrixConstRef dndb, MatrixRef J) const -> void
+    {
+        const auto& C = formula_matrix_titrants;
+        const auto& is = constraints_species;
+
+        // Only the species amounts the residuals depend on contribute to the Jacobian
+        if(is.size() == system.numSpecies())
+            J.noalias() = res.ddx + (res.ddn * dndb) * C;
+        else
+            J.noalias() = res.ddx + (cols(res.ddn, is) * rows(dndb, is)) * C;
     }
 
     /// Solve the inverse equilibrium problem.
@@ -516,9 +633,6 @@ struct EquilibriumInverseProblem::Impl
         solver.setOptions(options);
         solver.setPartition(system);
 
-        // The sensitivity of the calculation equilibrium states
-        EquilibriumSensitivity sensitivity;
-
         // Define auxiliary variables from the inverse problem definition
         const Index Nt = titrants.size();
         const Index Nc = constraints.size();
@@ -540,7 +654,7 @@ struct EquilibriumInverseProblem::Impl
         state.setPressure(P);
 
         // Define auxiliary instances to avoid memory reallocation
-        ChemicalProperties properties;
+        ChemicalProperties properties(system);
         ResidualEquilibriumConstraints res;
         NonlinearResidual nonlinear_residual;
 
@@ -548,6 +662,9 @@ struct EquilibriumInverseProblem::Impl
         auto& F = nonlinear_residual.val;
         auto& J = nonlinear_residual.jacobian;
 
+        // Allocate the Jacobian of the residuals once for all iterations
+        J.resize(Nc, Nt);
+
         // Set the options and partition in the equilibrium solver
         solver.setOptions(options);
         solver.setPartition(partition);
@@ -573,15 +690,12 @@ struct EquilibriumInverseProblem::Impl
             // Check if the equilibrium calculation succeeded
             nonlinear_residual.succeeded = result.optimum.succeeded;
 
-            // Update the sensitivity of the equilibrium state
-            sensitivity = solver.sensitivity();
-
             // Calculate the residuals of the equilibrium constraints
-            res = residualEquilibriumConstraints(x, state);
+            residualEquilibriumConstraints(x, state, properties, res);
 
-            // Calculate the residual vector `F` and its Jacobian `J`
+            // Calculate the residual vector `F` and its Jacobian `J` using the sensitivity of the equilibrium state
             F = res.val;
-            J = res.ddx + res.ddn * sensitivity.dndb * C;
+            jacobianEquilibriumConstraints(res, solver.sensitivity().dndb, J);
 
             return nonlinear_residual;
         };
@@ -668,6 +782,7 @@ auto EquilibriumInverseProblem::fixSpeciesAmount(std::string species, double val
 {
     value = units::convert(value, units, "mol");
     pimpl->addSpeciesAmountConstraint(species, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "mol"); });
     pimpl->addTitrant(titrant);
     pimpl->setTitrantInitialAmount(titrant, value);
     return *this;
@@ -683,7 +798,9 @@ auto EquilibriumInverseProblem::fixSpeciesMass(std::string species, double value
     const Index ispecies = pimpl->system.indexSpeciesWithError(species);
     const double molar_mass = pimpl->system.species(ispecies).molarMass();
     value = units::convert(value, units, "kg")/molar_mass;
-    return fixSpeciesAmount(species, value, "mol", titrant);
+    fixSpeciesAmount(species, value, "mol", titrant);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "kg")/molar_mass; });
+    return *this;
 }
 
 auto EquilibriumInverseProblem::fixSpeciesActivity(std::string species, double value) -> EquilibriumInverseProblem&
@@ -714,19 +831,24 @@ auto EquilibriumInverseProblem::fixSpeciesActivity(std::string species, double v
 auto EquilibriumInverseProblem::fixSpeciesFugacity(std::string species, double value, std::string units) -> EquilibriumInverseProblem&
 {
     value = units::convert(value, units, "bar");
-    return fixSpeciesActivity(species, value);
+    fixSpeciesActivity(species, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "bar"); });
+    return *this;
 }
 
 auto EquilibriumInverseProblem::fixSpeciesFugacity(std::string species, double value, std::string units, std::string titrant) -> EquilibriumInverseProblem&
 {
     value = units::convert(value, units, "bar");
-    return fixSpeciesActivity(species, value, titrant);
+    fixSpeciesActivity(species, value, titrant);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "bar"); });
+    return *this;
 }
 
 auto EquilibriumInverseProblem::fixPhaseAmount(std::string phase, double value, std::string units, std::string titrant) -> EquilibriumInverseProblem&
 {
     value = units::convert(value, units, "mol");
     pimpl->addPhaseAmountConstraint(phase, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "mol"); });
     pimpl->addTitrant(titrant);
     pimpl->setTitrantInitialAmount(titrant, value);
     return *this;
@@ -736,6 +858,7 @@ auto EquilibriumInverseProblem::fixPhaseMass(std::string phase, double value, st
 {
     value = units::convert(value, units, "kg");
     pimpl->addPhaseMassConstraint(phase, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "kg"); });
     pimpl->addTitrant(titrant);
 //    pimpl->setTitrantInitialAmount(titrant, value); // access to molar mass of titrant is needed here for setting adequate initial guess
     return *this;
@@ -745,6 +868,7 @@ auto EquilibriumInverseProblem::fixPhaseVolume(std::string phase, double value,
 {
     value = units::convert(value, units, "m3");
     pimpl->addPhaseVolumeConstraint(phase, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "m3"); });
     pimpl->addTitrant(titrant);
     pimpl->setTitrantInitialAmount(titrant, 1e3);
     return *this;
@@ -754,6 +878,7 @@ auto EquilibriumInverseProblem::fixPhaseSetVolume(const std::vector<std::string>
 {
     value = units::convert(value, units, "m3");
     pimpl->addSumPhaseVolumesConstraint(phases, value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "m3"); });
     pimpl->addTitrant(titrant);
     pimpl->setTitrantInitialAmount(titrant, 1e3);
     return *this;
@@ -762,19 +887,25 @@ auto EquilibriumInverseProblem::fixPhaseSetVolume(const std::vector<std::string>
 auto EquilibriumInverseProblem::pH(double value) -> EquilibriumInverseProblem&
 {
     const double aHplus = std::pow(10.0, -value);
-    return fixSpeciesActivity("H+", aHplus);
+    fixSpeciesActivity("H+", aHplus);
+    pimpl->setConstraintConversion(numConstraints() - 1, pHToActivity);
+    return *this;
 }
 
 auto EquilibriumInverseProblem::pH(double value, std::string titrant) -> EquilibriumInverseProblem&
 {
     const double aHplus = std::pow(10.0, -value);
-    return fixSpeciesActivity("H+", aHplus, titrant);
+    fixSpeciesActivity("H+", aHplus, titrant);
+    pimpl->setConstraintConversion(numConstraints() - 1, pHToActivity);
+    return *this;
 }
 
 auto EquilibriumInverseProblem::pH(double value, std::string titrant1, std::string titrant2) -> EquilibriumInverseProblem&
 {
     const double aHplus = std::pow(10.0, -value);
-    return fixSpeciesActivity("H+", aHplus, titrant1, titrant2);
+    fixSpeciesActivity("H+", aHplus, titrant1, titrant2);
+    pimpl->setConstraintConversion(numConstraints() - 2, pHToActivity); // the last constraint is the one of the mutually exclusive titrants
+    return *this;
 }
 
 auto EquilibriumInverseProblem::pE(double value) -> EquilibriumInverseProblem&
@@ -798,6 +929,7 @@ auto EquilibriumInverseProblem::Eh(double value, std::string units, std::string
 {
     value = units::convert(value, units, "V");
     pimpl->addEhConstraint(value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "V"); });
     pimpl->addTitrant(titrant);
     return *this;
 }
@@ -806,10 +938,23 @@ auto EquilibriumInverseProblem::alkalinity(double value, std::string units, std:
 {
     value = units::convert(value, units, "eq/L");
     pimpl->addAlkalinityConstraint(value);
+    pimpl->setConstraintConversion(numConstraints() - 1, [=](double target) { return units::convert(target, units, "eq/L"); });
     pimpl->addTitrant(titrant);
     return *this;
 }
 
+auto EquilibriumInverseProblem::setConstraintValues(VectorConstRef values) -> EquilibriumInverseProblem&
+{
+    pimpl->setConstraintValues(values);
+    return *this;
+}
+
+auto EquilibriumInverseProblem::setConstraintTargets(VectorConstRef values) -> EquilibriumInverseProblem&
+{
+    pimpl->setConstraintTargets(values);
+    return *this;
+}
+
 auto EquilibriumInverseProblem::system() const -> const ChemicalSystem&
 {
     return pimpl->system;
@@ -835,11 +980,21 @@ auto EquilibriumInverseProblem::numConstraints() const -> Index
     return pimpl->constraints.size();
 }
 
+auto EquilibriumInverseProblem::numConstraintTargets() const -> Index
+{
+    return pimpl->numConstraintTargets();
+}
+
 auto EquilibriumInverseProblem::numTitrants() const -> Index
 {
     return pimpl->titrants.size();
 }
 
+auto EquilibriumInverseProblem::constraintValues() const -> Vector
+{
+    return pimpl->constraintValues();
+}
+
 auto EquilibriumInverseProblem::formulaMatrixTitrants() const -> Matrix
 {
     return pimpl->formula_matrix_titrants;
@@ -857,7 +1012,24 @@ auto EquilibriumInverseProblem::titrantInitialAmounts() const -> Vector
 
 auto EquilibriumInverseProblem::residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state) const -> ResidualEquilibriumConstraints
 {
-    return pimpl->residualEquilibriumConstraints(x, state);
+    ResidualEquilibriumConstraints res;
+    pimpl->residualEquilibriumConstraints(x, state, res);
+    return res;
+}
+
+auto EquilibriumInverseProblem::residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ResidualEquilibriumConstraints& res) const -> void
+{
+    pimpl->residualEquilibriumConstraints(x, state, res);
+}
+
+auto EquilibriumInverseProblem::residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ChemicalProperties& properties, ResidualEquilibriumConstraints& res) const -> void
+{
+    pimpl->residualEquilibriumConstraints(x, state, properties, res);
+}
+
+auto EquilibriumInverseProblem::jacobianEquilibriumConstraints(const ResidualEquilibriumConstraints& res, MatrixConstRef dndb, MatrixRef J) const -> void
+{
+    pimpl->jacobianEquilibriumConstraints(res, dndb, J);
 }
 
 auto EquilibriumInverseProblem::solve(ChemicalState& state) -> EquilibriumResult
@@ -26,6 +26,7 @@
 namespace Reaktoro {
 
 // Forward declarations
+class ChemicalProperties;
 class ChemicalSystem;
 class ChemicalState;
 class Partition;
@@ -229,6 +230,26 @@ public:
     /// @param titrant The titrant that control the solution alkalinity.
     auto alkalinity(double value, std::string units, std::string titrant) -> EquilibriumInverseProblem&;
 
+    /// Set the values of the equilibrium constraints, in the order they were imposed.
+    /// This permits the same inverse problem, with its titrants and compiled constraints, to be solved
+    /// for different targets (e.g., the pH and alkalinity of many water samples).
+    /// The values are in the units used internally by each constraint: mol for species and phase
+    /// amounts (species masses are converted to amounts), kg for phase masses, m3 for phase volumes,
+    /// V for Eh, eq/L for alkalinity, and activities for species activities, fugacities (in bar) and pH (i.e., 10^-pH).
+    /// Two mutually exclusive titrants introduce an additional constraint whose value is a small smoothing parameter,
+    /// which must be given unchanged (as returned by @ref constraintValues).
+    /// @param values The values of the equilibrium constraints
+    /// @see constraintValues, setConstraintTargets
+    auto setConstraintValues(VectorConstRef values) -> EquilibriumInverseProblem&;
+
+    /// Set the target values of the equilibrium constraints imposed by the user, in the order they were imposed.
+    /// Each value is given as in the method that imposed the constraint, in the same units (e.g., a pH value for
+    /// the constraint imposed with @ref pH, or a mass in g for a species mass imposed in g). The constraints
+    /// introduced by mutually exclusive titrants are not targets and take no value here.
+    /// @param values The target values of the equilibrium constraints imposed by the user
+    /// @see numConstraintTargets, setConstraintValues
+    auto setConstraintTargets(VectorConstRef values) -> EquilibriumInverseProblem&;
+
     /// Return a reference to the ChemicalSystem instance used to create this EquilibriumProblem instance
     auto system() const -> const ChemicalSystem&;
 
@@ -244,6 +265,14 @@ public:
     /// Return the number of constraints used in the inverse equilibrium problem.
     auto numConstraints() const -> Index;
 
+    /// Return the number of constraints imposed by the user, excluding those of mutually exclusive titrants.
+    /// @see setConstraintTargets
+    auto numConstraintTargets() const -> Index;
+
+    /// Return the values of the equilibrium constraints, in the order they were imposed.
+    /// @see setConstraintValues
+    auto constraintValues() const -> Vector;
+
     /// Return the number of titrants used in the inverse equilibrium problem.
     auto numTitrants() const -> Index;
 
@@ -266,6 +295,31 @@ public:
     /// @param state The chemical state of the system
     auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state) const -> ResidualEquilibriumConstraints;
 
+    /// Calculate the residuals of the equilibrium constraints and their partial derivatives.
+    /// The chemical properties of the state are evaluated at most once for all constraints,
+    /// and the memory of the given residual instance is reused across calls.
+    /// @param x The amounts of the titrants (in units of mol)
+    /// @param state The chemical state of the system
+    /// @param[out] res The residuals of the equilibrium constraints and their partial derivatives
+    auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ResidualEquilibriumConstraints& res) const -> void;
+
+    /// Calculate the residuals of the equilibrium constraints and their partial derivatives.
+    /// The given chemical properties are updated with the state only if any of the constraints needs them.
+    /// Their chemical system may be a copy of the one of the state, so that threads sharing the same
+    /// inverse problem evaluate the models of their own copies (see ChemicalSystem::clone).
+    /// @param x The amounts of the titrants (in units of mol)
+    /// @param state The chemical state of the system
+    /// @param properties The chemical properties used to evaluate the constraints
+    /// @param[out] res The residuals of the equilibrium constraints and their partial derivatives
+    auto residualEquilibriumConstraints(VectorConstRef x, const ChemicalState& state, ChemicalProperties& properties, ResidualEquilibriumConstraints& res) const -> void;
+
+    /// Calculate the Jacobian of the residuals of the equilibrium constraints w.r.t. the titrant amounts.
+    /// Only the columns of `res.ddn` of the species the constraints depend on are used in the product.
+    /// @param res The residuals of the equilibrium constraints and their partial derivatives
+    /// @param dndb The sensitivity of the species amounts w.r.t. the element amounts
+    /// @param[out] J The Jacobian matrix, with dimensions (number of constraints) x (number of titrants)
+    auto jacobianEquilibriumConstraints(const ResidualEquilibriumConstraints& res, MatrixConstRef dndb, MatrixRef J) const -> void;
+
     /// Solve the inverse equilibrium problem.
     /// @param state The initial guess for the final chemical state solution.
     auto solve(ChemicalState& state) -> EquilibriumResult;
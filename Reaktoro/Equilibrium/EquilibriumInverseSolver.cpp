@@ -45,9 +45,6 @@ struct EquilibriumInverseSolver::Impl
     /// The solver for the equilibrium calculations
     EquilibriumSolver solver;
 
-    /// The sensitivity of the equilibrium state
-    EquilibriumSensitivity sensitivity;
-
     /// Construct a Impl instance
     Impl(const ChemicalSystem& system)
     : system(system), solver(system)
@@ -93,7 +90,7 @@ struct EquilibriumInverseSolver::Impl
         state.setPressure(P);
 
         // Define auxiliary instances to avoid memory reallocation
-        ChemicalProperties properties;
+        ChemicalProperties properties(system);
         ResidualEquilibriumConstraints res;
         NonlinearResidual nonlinear_residual;
 
@@ -101,6 +98,9 @@ struct EquilibriumInverseSolver::Impl
         auto& F = nonlinear_residual.val;
         auto& J = nonlinear_residual.jacobian;
 
+        // Allocate the Jacobian of the residuals once for all iterations
+        J.resize(Nc, Nt);
+
         // Set the options and partition in the equilibrium solver
         solver.setOptions(options);
         solver.setPartition(partition);
@@ -134,15 +134,12 @@ struct EquilibriumInverseSolver::Impl
             // Check if the function evaluation was successful
             nonlinear_residual.succeeded = result.optimum.succeeded;
 
-            // Update the sensitivity of the equilibrium state
-            sensitivity = solver.sensitivity();
-
             // Calculate the residuals of the equilibrium constraints
-            res = problem.residualEquilibriumConstraints(x, state);
+            problem.residualEquilibriumConstraints(x, state, properties, res);
 
             // Calculate the residual vector `F` and its Jacobian `J`
             F = res.val;
-            J = res.ddx + res.ddn * sensitivity.dndb * C;
+            problem.jacobianEquilibriumConstraints(res, solver.sensitivity().dndb, J);
 
             return nonlinear_residual;
         };
@@ -50,6 +50,57 @@ struct SmartEquilibriumOptions
     double abstol = 1e-14;
 };
 
+/// The options for the selection of initial guesses from providers.
+/// @see EquilibriumInitialGuess
+struct EquilibriumInitialGuessOptions
+{
+    /// The maximum relative mismatch of the element amounts in an initial guess.
+    /// The mismatch of an initial guess with species amounts `n` is `max(abs(Ae*ne - be))/max(abs(be))`.
+    /// Initial guesses from providers with a larger mismatch are discarded, and a cold-start
+    /// is performed if no initial guess remains.
+    double mismatch = 1.0;
+};
+
+/// The options for a stage of the escalation policy of failed equilibrium calculations.
+/// @see EquilibriumRetryOptions
+struct EquilibriumRetryStageOptions
+{
+    /// The maximum number of iterations in this stage. The stage is skipped if zero.
+    unsigned max_iterations = 0;
+
+    /// The maximum wall time of this stage (in units of s). No limit is imposed if zero.
+    double max_time = 0.0;
+};
+
+/// The options for the escalation policy of failed equilibrium calculations.
+/// When an equilibrium calculation fails to converge within `optimum.max_iterations`
+/// iterations, the following stages are attempted in order until one succeeds:
+/// a warm restart from the last iterate with reset dual potentials, a restart from
+/// the initial guess with an alternative optimisation method, and a cold-start from
+/// a simplex approximation. All retry stages are disabled by default.
+struct EquilibriumRetryOptions
+{
+    /// The number of iterations in each optimisation pass.
+    /// The wall time limits are checked between consecutive passes.
+    unsigned pass_iterations = 10;
+
+    /// The maximum wall time of the whole calculation, including all stages (in units of s).
+    /// No limit is imposed if zero.
+    double max_time = 0.0;
+
+    /// The options of the warm restart stage.
+    EquilibriumRetryStageOptions warmrestart;
+
+    /// The options of the alternative method stage.
+    EquilibriumRetryStageOptions alternative;
+
+    /// The optimisation method used in the alternative method stage.
+    OptimumMethod alternative_method = OptimumMethod::IpOpt;
+
+    /// The options of the cold-start stage.
+    EquilibriumRetryStageOptions coldstart;
+};
+
 /// The options for the equilibrium calculations
 struct EquilibriumOptions
 {
@@ -87,6 +138,38 @@ struct EquilibriumOptions
 
     /// The options for the smart equilibrium calculation.
     SmartEquilibriumOptions smart;
+
+    /// The options for the selection of initial guesses from providers.
+    EquilibriumInitialGuessOptions initialguess;
+
+    /// The options for the escalation policy of failed equilibrium calculations.
+    EquilibriumRetryOptions retry;
+
+    /// The boolean flag that indicates if the time spent in the thermodynamic and chemical
+    /// models should be measured for each phase (see EquilibriumResult::properties).
+    bool phase_timing = false;
+};
+
+/// The options for the inverse equilibrium calculations of a batch of samples.
+/// @see EquilibriumInverseBatchSolver
+struct EquilibriumInverseBatchOptions
+{
+    /// The options for the inverse equilibrium calculation of each sample.
+    EquilibriumOptions equilibrium;
+
+    /// The number of threads used to solve the samples (zero for the number of hardware threads).
+    unsigned num_threads = 0;
+
+    /// The number of consecutive samples, after ordering, solved by the same thread.
+    unsigned chunk_size = 64;
+
+    /// The boolean flag that indicates if the samples are ordered so that nearby samples are solved consecutively.
+    /// The samples are ordered by temperature, pressure, constraint values and element amounts, in this order.
+    bool ordering = true;
+
+    /// The boolean flag that indicates if a sample is warm-started from the previous sample in its chunk.
+    /// A sample whose warm-started calculation fails is solved again from its given chemical state.
+    bool warmstart = true;
 };
 
 } // namespace Reaktoro
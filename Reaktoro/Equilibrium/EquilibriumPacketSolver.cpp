@@ -0,0 +1,775 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumPacketSolver.hpp"
+
+// C++ includes
+#include <array>
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The number of lanes in a packet of equilibrium problems
+constexpr unsigned W = EquilibriumPacketSolver::lanes;
+
+/// Return the position of the `i`-th entry of lane `l` in an interleaved array
+inline auto at(Index i, Index l) -> Index
+{
+    return i*W + l;
+}
+
+} // namespace
+
+struct EquilibriumPacketSolver::Impl
+{
+    /// The chemical system instance
+    ChemicalSystem system;
+
+    /// The partition of the chemical system
+    Partition partition;
+
+    /// The options of the equilibrium solver
+    EquilibriumOptions options;
+
+    /// The equilibrium solver for cold-start approximations and for lanes that failed in lockstep
+    EquilibriumSolver solver;
+
+    /// The chemical properties of the chemical system in each lane
+    std::vector<ChemicalProperties> properties;
+
+    /// The normalized standard chemical potentials of the species in each lane
+    std::vector<Vector> u0;
+
+    /// The normalized chemical potentials of the species in each lane
+    std::vector<Vector> u;
+
+    /// The molar amounts of the species in each lane
+    std::vector<Vector> n;
+
+    /// The interleaved primal variables `x` and dual variables `y` and `z`
+    std::vector<double> x, y, z;
+
+    /// The interleaved gradient and diagonal Hessian of the objective function
+    std::vector<double> g, h;
+
+    /// The interleaved right-hand side vectors of the KKT equations
+    std::vector<double> rx, ry, rz;
+
+    /// The interleaved solution vectors of the KKT equations
+    std::vector<double> dx, dy, dz;
+
+    /// The interleaved vectors `inv(D)` and `r` of the reduced KKT equations, with `D = H + Z/X + γ²I` and `r = rx + rz/x`
+    std::vector<double> invD, r;
+
+    /// The interleaved trial iterate for `x`
+    std::vector<double> xtrial;
+
+    /// The interleaved Cholesky factor of the matrix `A·inv(D)·tr(A) + δ²I` (lower triangle, row-major)
+    std::vector<double> L;
+
+    /// The interleaved molar amounts of the elements in the equilibrium partition
+    std::vector<double> b;
+
+    /// The optimality, feasibility, centrality and total errors in each lane
+    std::array<double, W> errorf, errorh, errorc, error;
+
+    /// The scaling factors of the feasibility errors in each lane
+    std::array<double, W> bnorm;
+
+    /// The step lengths for `x` and `z` in each lane
+    std::array<double, W> alphax, alphaz;
+
+    /// The flags that indicate if a lane is occupied, still iterating, or failed in lockstep
+    std::array<bool, W> used, active, failed;
+
+    /// The molar amounts of the equilibrium species used to evaluate the objective function
+    Vector ne;
+
+    /// The indices of the species in the equilibrium partition
+    Indices ies;
+
+    /// The indices of the elements in the equilibrium partition
+    Indices iee;
+
+    /// The indices of the inert species (i.e., the species in disequilibrium)
+    Indices iis;
+
+    /// The number of species and elements in the system
+    unsigned N, E;
+
+    /// The number of species and elements in the equilibrium partition
+    unsigned Ne, Ee;
+
+    /// The formula matrix of the species in the system
+    Matrix A;
+
+    /// The formula matrix of the species in the equilibrium partition
+    Matrix Ae;
+
+    /// The formula matrix of the inert species
+    Matrix Ai;
+
+    /// Construct a default Impl instance
+    Impl()
+    {}
+
+    /// Construct a Impl instance with given Partition
+    Impl(const Partition& partition)
+    : system(partition.system()), solver(partition)
+    {
+        // Initialize the formula matrix
+        A = system.formulaMatrix();
+
+        // Initialize the number of species and elements in the system
+        N = system.numSpecies();
+        E = system.numElements();
+
+        // Initialize the chemical properties and chemical potentials of each lane
+        properties.assign(W, ChemicalProperties(system));
+        u0.assign(W, zeros(N));
+        u.assign(W, zeros(N));
+        n.assign(W, zeros(N));
+
+        // Set the partition of the chemical system
+        setPartition(partition);
+    }
+
+    /// Set the options of the equilibrium solver
+    auto setOptions(const EquilibriumOptions& options_) -> void
+    {
+        options = options_;
+        solver.setOptions(options);
+    }
+
+    /// Set the partition of the chemical system
+    auto setPartition(const Partition& partition_) -> void
+    {
+        // Set the partition of the chemical system
+        partition = partition_;
+        solver.setPartition(partition);
+
+        // Initialize the number of species and elements in the equilibrium partition
+        Ne = partition.numEquilibriumSpecies();
+        Ee = partition.numEquilibriumElements();
+
+        // Initialize the formula matrix of the equilibrium species
+        Ae = partition.formulaMatrixEquilibriumPartition();
+
+        // Initialize the indices of the equilibrium species and elements
+        ies = partition.indicesEquilibriumSpecies();
+        iee = partition.indicesEquilibriumElements();
+
+        // Initialize the indices of the inert species
+        iis.clear();
+        iis.reserve(partition.numInertSpecies() + partition.numKineticSpecies());
+        iis.insert(iis.end(), partition.indicesInertSpecies().begin(), partition.indicesInertSpecies().end());
+        iis.insert(iis.end(), partition.indicesKineticSpecies().begin(), partition.indicesKineticSpecies().end());
+
+        // Initialize the formula matrix of the inert species
+        Ai = cols(A, iis);
+
+        // Allocate the interleaved arrays of the packet
+        for(auto vec : {&x, &z, &g, &h, &rx, &rz, &dx, &dz, &invD, &r, &xtrial})
+            vec->assign(Ne*W, 0.0);
+        for(auto vec : {&y, &ry, &dy, &b})
+            vec->assign(Ee*W, 0.0);
+        L.assign(Ee*Ee*W, 0.0);
+        ne.resize(Ne);
+    }
+
+    /// Evaluate the gradient and diagonal Hessian of the Gibbs energy function of a lane.
+    /// @param l The index of the lane
+    /// @param xl The interleaved array from which the amounts of the equilibrium species in lane `l` are read
+    /// @return True if the evaluation resulted in finite values
+    auto evaluate(Index l, const std::vector<double>& xl) -> bool
+    {
+        // Set the molar amounts of the equilibrium species of the lane
+        for(Index i = 0; i < Ne; ++i)
+            ne[i] = xl[at(i, l)];
+        n[l](ies) = ne;
+
+        // Update the chemical properties of the chemical system in the lane
+        properties[l].update(n[l]);
+
+        // Set the normalized chemical potentials of the species
+        const auto& lna = properties[l].lnActivities();
+        u[l] = u0[l] + lna.val;
+
+        // Set the gradient and diagonal Hessian of the objective function
+        switch(options.hessian)
+        {
+        case GibbsHessian::Exact:
+        case GibbsHessian::ExactDiagonal:
+            for(Index i = 0; i < Ne; ++i)
+                h[at(i, l)] = lna.ddn(ies[i], ies[i]);
+            break;
+        case GibbsHessian::Approximation:
+        case GibbsHessian::ApproximationDiagonal:
+            const ChemicalVector xs = properties[l].moleFractions();
+            for(Index i = 0; i < Ne; ++i)
+                h[at(i, l)] = xs.ddn(ies[i], ies[i])/xs.val[ies[i]];
+            break;
+        }
+
+        bool finite = true;
+        for(Index i = 0; i < Ne; ++i)
+        {
+            g[at(i, l)] = u[l][ies[i]];
+            finite = finite && std::isfinite(g[at(i, l)]) && std::isfinite(h[at(i, l)]);
+        }
+
+        return finite;
+    }
+
+    /// Remove a lane from the lockstep iterations so that it is later solved with the standard solver.
+    auto fail(Index l) -> void
+    {
+        active[l] = false;
+        failed[l] = true;
+    }
+
+    /// Return true if any lane is still iterating.
+    auto anyactive() const -> bool
+    {
+        for(Index l = 0; l < W; ++l)
+            if(active[l]) return true;
+        return false;
+    }
+
+    /// Compute the residuals of the KKT equations and their error norms in all lanes.
+    auto update_residuals(double mu, double gamma, double delta) -> void
+    {
+        const double gamma2 = gamma*gamma;
+        const double delta2 = delta*delta;
+
+        // Compute the optimality residual rx = -(g - tr(A)*y - z + γ²)
+        for(Index i = 0; i < Ne; ++i)
+        {
+            for(Index l = 0; l < W; ++l)
+                rx[at(i, l)] = z[at(i, l)] - g[at(i, l)] - gamma2;
+            for(Index k = 0; k < Ee; ++k)
+            {
+                const double aki = Ae(k, i);
+                if(aki == 0.0) continue;
+                for(Index l = 0; l < W; ++l)
+                    rx[at(i, l)] += aki * y[at(k, l)];
+            }
+        }
+
+        // Compute the feasibility residual ry = -(A*x + δ²y - b)
+        for(Index k = 0; k < Ee; ++k)
+        {
+            for(Index l = 0; l < W; ++l)
+                ry[at(k, l)] = b[at(k, l)] - delta2 * y[at(k, l)];
+            for(Index i = 0; i < Ne; ++i)
+            {
+                const double aki = Ae(k, i);
+                if(aki == 0.0) continue;
+                for(Index l = 0; l < W; ++l)
+                    ry[at(k, l)] -= aki * x[at(i, l)];
+            }
+        }
+
+        // Compute the centrality residual rz = -(x*z - μ)
+        for(Index i = 0; i < Ne*W; ++i)
+            rz[i] = mu - x[i] * z[i];
+
+        // Calculate the optimality, feasibility and centrality errors
+        errorf.fill(0.0);
+        errorh.fill(0.0);
+        errorc.fill(0.0);
+        for(Index i = 0; i < Ne; ++i)
+            for(Index l = 0; l < W; ++l)
+            {
+                errorf[l] = std::max(errorf[l], std::abs(rx[at(i, l)]));
+                errorc[l] = std::max(errorc[l], std::abs(rz[at(i, l)]));
+            }
+        for(Index k = 0; k < Ee; ++k)
+            for(Index l = 0; l < W; ++l)
+                errorh[l] = std::max(errorh[l], std::abs(ry[at(k, l)]));
+        for(Index l = 0; l < W; ++l)
+        {
+            errorh[l] /= bnorm[l];
+            error[l] = std::max({errorf[l], errorh[l], errorc[l]});
+        }
+    }
+
+    /// Compute the Newton step in all lanes using a rangespace reduction of the KKT equations.
+    auto compute_newton_step(double gamma, double delta) -> void
+    {
+        const double gamma2 = gamma*gamma;
+        const double delta2 = delta*delta;
+
+        // The flags that indicate if the Cholesky factorization succeeded in each lane
+        std::array<bool, W> ok;
+        ok.fill(true);
+
+        // Compute inv(D) and r = rx + rz/x
+        for(Index i = 0; i < Ne*W; ++i)
+        {
+            invD[i] = 1.0/(h[i] + z[i]/x[i] + gamma2);
+            r[i] = rx[i] + rz[i]/x[i];
+        }
+
+        // Assemble the lower triangle of the matrix A·inv(D)·tr(A) + δ²I
+        for(Index k = 0; k < Ee; ++k)
+            for(Index j = 0; j <= k; ++j)
+            {
+                double* Lkj = &L[at(k*Ee + j, 0)];
+                for(Index l = 0; l < W; ++l)
+                    Lkj[l] = (k == j) ? delta2 : 0.0;
+                for(Index i = 0; i < Ne; ++i)
+                {
+                    const double akj = Ae(k, i) * Ae(j, i);
+                    if(akj == 0.0) continue;
+                    for(Index l = 0; l < W; ++l)
+                        Lkj[l] += akj * invD[at(i, l)];
+                }
+            }
+
+        // Perform the Cholesky factorization of the assembled matrix in all lanes
+        for(Index j = 0; j < Ee; ++j)
+        {
+            double* Ljj = &L[at(j*Ee + j, 0)];
+            for(Index p = 0; p < j; ++p)
+            {
+                const double* Ljp = &L[at(j*Ee + p, 0)];
+                for(Index l = 0; l < W; ++l)
+                    Ljj[l] -= Ljp[l] * Ljp[l];
+            }
+            for(Index l = 0; l < W; ++l)
+            {
+                ok[l] = ok[l] && Ljj[l] > 0.0;
+                Ljj[l] = std::sqrt(Ljj[l] > 0.0 ? Ljj[l] : 1.0);
+            }
+            for(Index k = j + 1; k < Ee; ++k)
+            {
+                double* Lkj = &L[at(k*Ee + j, 0)];
+                for(Index p = 0; p < j; ++p)
+                {
+                    const double* Lkp = &L[at(k*Ee + p, 0)];
+                    const double* Ljp = &L[at(j*Ee + p, 0)];
+                    for(Index l = 0; l < W; ++l)
+                        Lkj[l] -= Lkp[l] * Ljp[l];
+                }
+                for(Index l = 0; l < W; ++l)
+                    Lkj[l] /= Ljj[l];
+            }
+        }
+
+        // Compute the right-hand side ry - A·inv(D)·r of the reduced equations for dy
+        for(Index k = 0; k < Ee; ++k)
+        {
+            for(Index l = 0; l < W; ++l)
+                dy[at(k, l)] = ry[at(k, l)];
+            for(Index i = 0; i < Ne; ++i)
+            {
+                const double aki = Ae(k, i);
+                if(aki == 0.0) continue;
+                for(Index l = 0; l < W; ++l)
+                    dy[at(k, l)] -= aki * r[at(i, l)] * invD[at(i, l)];
+            }
+        }
+
+        // Solve the lower triangular system in all lanes
+        for(Index k = 0; k < Ee; ++k)
+        {
+            for(Index p = 0; p < k; ++p)
+                for(Index l = 0; l < W; ++l)
+                    dy[at(k, l)] -= L[at(k*Ee + p, l)] * dy[at(p, l)];
+            for(Index l = 0; l < W; ++l)
+                dy[at(k, l)] /= L[at(k*Ee + k, l)];
+        }
+
+        // Solve the upper triangular system in all lanes
+        for(Index k = Ee; k-- > 0;)
+        {
+            for(Index p = k + 1; p < Ee; ++p)
+                for(Index l = 0; l < W; ++l)
+                    dy[at(k, l)] -= L[at(p*Ee + k, l)] * dy[at(p, l)];
+            for(Index l = 0; l < W; ++l)
+                dy[at(k, l)] /= L[at(k*Ee + k, l)];
+        }
+
+        // Compute dx = inv(D)·(r + tr(A)·dy) and dz = (rz - z·dx)/x
+        for(Index i = 0; i < Ne; ++i)
+        {
+            for(Index l = 0; l < W; ++l)
+                dx[at(i, l)] = r[at(i, l)];
+            for(Index k = 0; k < Ee; ++k)
+            {
+                const double aki = Ae(k, i);
+                if(aki == 0.0) continue;
+                for(Index l = 0; l < W; ++l)
+                    dx[at(i, l)] += aki * dy[at(k, l)];
+            }
+            for(Index l = 0; l < W; ++l)
+            {
+                dx[at(i, l)] *= invD[at(i, l)];
+                dz[at(i, l)] = (rz[at(i, l)] - z[at(i, l)] * dx[at(i, l)])/x[at(i, l)];
+            }
+        }
+
+        // Remove the lanes whose Newton step could not be computed
+        for(Index l = 0; l < W; ++l)
+        {
+            if(!active[l]) continue;
+            bool finite = ok[l];
+            for(Index i = 0; i < Ne && finite; ++i)
+                finite = std::isfinite(dx[at(i, l)]) && std::isfinite(dz[at(i, l)]);
+            for(Index k = 0; k < Ee && finite; ++k)
+                finite = std::isfinite(dy[at(k, l)]);
+            if(!finite) fail(l);
+        }
+    }
+
+    /// Compute the fraction-to-the-boundary step length of an interleaved array in all lanes.
+    auto fractionToTheBoundary(const std::vector<double>& p, const std::vector<double>& dp, unsigned size, double tau, std::array<double, W>& alpha) -> void
+    {
+        alpha.fill(1.0);
+        for(Index i = 0; i < size; ++i)
+            for(Index l = 0; l < W; ++l)
+                if(dp[at(i, l)] < 0.0)
+                    alpha[l] = std::min(alpha[l], -tau*p[at(i, l)]/dp[at(i, l)]);
+    }
+
+    /// Evaluate the objective function at the trial iterate of a lane, backtracking until it is finite.
+    /// @return The number of evaluations performed, or zero if no finite trial iterate was found
+    auto backtrack(Index l, double alpha, double factor, bool first) -> unsigned
+    {
+        unsigned tentatives = 0;
+        if(first && evaluate(l, xtrial))
+            return 1;
+        for(; tentatives < 10; ++tentatives)
+        {
+            for(Index i = 0; i < Ne; ++i)
+                xtrial[at(i, l)] = x[at(i, l)] + alpha * dx[at(i, l)];
+            if(evaluate(l, xtrial))
+                return tentatives + 1 + first;
+            alpha *= factor;
+        }
+        return 0;
+    }
+
+    /// Update the iterates `x`, `y`, `z` of the lanes still iterating.
+    auto update_iterates(double tau, EquilibriumResult* results) -> void
+    {
+        const bool aggressive = options.optimum.ipnewton.step == Aggressive;
+
+        // Compute the fraction-to-the-boundary step lengths in all lanes
+        fractionToTheBoundary(x, dx, Ne, tau, alphax);
+        fractionToTheBoundary(z, dz, Ne, tau, alphaz);
+
+        // Calculate the trial iterate for x in the aggressive mode
+        if(aggressive)
+            for(Index i = 0; i < Ne*W; ++i)
+                xtrial[i] = (x[i] + dx[i] > 0.0) ? x[i] + dx[i] : x[i]*(1.0 - tau);
+
+        // Evaluate the objective function at the trial iterates (one lane at a time)
+        for(Index l = 0; l < W; ++l)
+        {
+            if(!active[l]) continue;
+            const unsigned evals = aggressive ?
+                backtrack(l, alphax[l], 0.5, true) :
+                backtrack(l, alphax[l], 0.01, false);
+            if(evals == 0) fail(l);
+            results[l].optimum.num_objective_evals += evals;
+        }
+
+        // Update the iterates of the lanes still iterating
+        for(Index i = 0; i < Ne; ++i)
+            for(Index l = 0; l < W; ++l)
+            {
+                const Index il = at(i, l);
+                const double znew = aggressive ?
+                    z[il] + ((z[il] + dz[il] > 0.0) ? dz[il] : -tau * z[il]) :
+                    z[il] + alphaz[l] * dz[il];
+                x[il] = active[l] ? xtrial[il] : x[il];
+                z[il] = active[l] ? znew : z[il];
+            }
+        for(Index k = 0; k < Ee; ++k)
+            for(Index l = 0; l < W; ++l)
+                y[at(k, l)] += active[l] ? dy[at(k, l)] : 0.0;
+    }
+
+    /// Update a chemical state from the interleaved iterates of a lane.
+    auto updateChemicalState(Index l, ChemicalState& state) -> void
+    {
+        // The temperature and the RT factor
+        const double T  = state.temperature();
+        const double RT = universalGasConstant*T;
+
+        // Update the molar amounts of the equilibrium species
+        for(Index i = 0; i < Ne; ++i)
+            n[l][ies[i]] = x[at(i, l)];
+
+        // Update the normalized dual potentials of the elements
+        Vector yl = zeros(E);
+        for(Index k = 0; k < Ee; ++k)
+            yl[iee[k]] = y[at(k, l)];
+
+        // Update the normalized dual potentials of the equilibrium and inert species
+        Vector zl = zeros(N);
+        for(Index i = 0; i < Ne; ++i)
+            zl[ies[i]] = z[at(i, l)];
+        zl(iis) = u[l](iis) - tr(Ai) * yl;
+
+        // Update the chemical state, with dual potentials in units of J/mol
+        state.setSpeciesAmounts(n[l]);
+        state.setElementDualPotentials(yl * RT);
+        state.setSpeciesDualPotentials(zl * RT);
+    }
+
+    /// Solve a packet with at most `W` equilibrium problems in lockstep.
+    auto solvePacket(ChemicalState* states, Index size, const double* T, const double* P, const double* be, EquilibriumResult* results) -> void
+    {
+        // Start timing the calculation
+        Time begin = time();
+
+        // Define auxiliary references to general options
+        const auto tol = options.optimum.tolerance;
+        const auto tolx = options.optimum.tolerancex;
+        const auto tolh = options.optimum.tolerance_linear_constraints;
+        const auto maxiters = options.optimum.max_iterations;
+
+        // The parameters of the IpNewton algorithm (see EquilibriumSolver for the use of epsilon as μ)
+        const auto mu = options.epsilon;
+        const auto tau = options.optimum.ipnewton.tau;
+
+        // The regularization parameters delta and gamma, set to mu in case they are zero
+        auto gamma = options.optimum.regularization.gamma;
+        auto delta = options.optimum.regularization.delta;
+        gamma = gamma ? gamma : mu;
+        delta = delta ? delta : mu;
+
+        // Initialize the lanes of the packet
+        for(Index l = 0; l < W; ++l)
+        {
+            used[l] = active[l] = l < size;
+            failed[l] = false;
+
+            // Set benign values for the unused lanes
+            if(!used[l])
+            {
+                for(Index i = 0; i < Ne; ++i)
+                    { x[at(i, l)] = z[at(i, l)] = h[at(i, l)] = 1.0; g[at(i, l)] = 0.0; }
+                for(Index k = 0; k < Ee; ++k)
+                    y[at(k, l)] = b[at(k, l)] = 0.0;
+                bnorm[l] = 1.0;
+                continue;
+            }
+
+            ChemicalState& state = states[l];
+            const VectorConstMap bel(be + l*Ee, Ee);
+            const double RT = universalGasConstant*T[l];
+
+            results[l] = EquilibriumResult();
+
+            // Set temperature and pressure of the chemical state
+            state.setTemperature(T[l]);
+            state.setPressure(P[l]);
+
+            // Select the initial guess, performing a simplex cold-start approximation if needed
+            results[l].initialguess = solver.initialGuess(state, T[l], P[l], bel);
+
+            // Update the standard thermodynamic properties of the chemical system in the lane
+            properties[l].update(T[l], P[l]);
+            u0[l] = properties[l].standardPartialMolarGibbsEnergies().val/RT;
+
+            // Initialize the interleaved iterates of the lane
+            n[l] = state.speciesAmounts();
+            const Vector& yl = state.elementDualPotentials();
+            const Vector& zl = state.speciesDualPotentials();
+            for(Index i = 0; i < Ne; ++i)
+            {
+                x[at(i, l)] = n[l][ies[i]];
+                z[at(i, l)] = zl[ies[i]]/RT;
+            }
+            for(Index k = 0; k < Ee; ++k)
+            {
+                y[at(k, l)] = yl[iee[k]]/RT;
+                b[at(k, l)] = bel[k];
+            }
+
+            // In case max(abs(b)) is zero, set bnorm to 1
+            const double bmax = bel.size() ? bel.cwiseAbs().maxCoeff() : 0.0;
+            bnorm[l] = bmax > 0.0 ? bmax : 1.0;
+        }
+
+        // Ensure the initial guesses for `x` and `z` are inside their feasible domain
+        for(Index i = 0; i < Ne*W; ++i)
+        {
+            x[i] = (x[i] > 0.0) ? x[i] : mu;
+            z[i] = (z[i] > 0.0) ? z[i] : mu/x[i];
+        }
+
+        // Evaluate the objective function at the initial guesses
+        for(Index l = 0; l < W; ++l)
+        {
+            if(!active[l]) continue;
+            if(!evaluate(l, x)) fail(l);
+            results[l].optimum.num_objective_evals += 1;
+        }
+
+        update_residuals(mu, gamma, delta);
+
+        for(unsigned iterations = 1; iterations <= maxiters && anyactive(); ++iterations)
+        {
+            compute_newton_step(gamma, delta);
+            update_iterates(tau, results);
+
+            for(Index l = 0; l < W; ++l)
+            {
+                if(!active[l]) continue;
+
+                auto& optimum = results[l].optimum;
+                optimum.iterations = iterations;
+                optimum.error = error[l];
+
+                // Prevent successfull convergence if linear constraints have not converged yet
+                if(errorh[l] > tolh)
+                    continue;
+
+                // Check if the calculation should stop based on max variation of x or optimality conditions
+                double dxmax = 0.0;
+                for(Index i = 0; i < Ne; ++i)
+                    dxmax = std::max(dxmax, std::abs(dx[at(i, l)]));
+                if((tolx && dxmax < tolx) || error[l] < tol)
+                {
+                    optimum.succeeded = true;
+                    optimum.time = elapsed(begin);
+                    active[l] = false;
+                }
+            }
+
+            update_residuals(mu, gamma, delta);
+        }
+
+        // The lanes that did not converge within the maximum number of iterations are also solved again
+        for(Index l = 0; l < W; ++l)
+            if(active[l]) fail(l);
+
+        // Update the chemical states, solving the failed lanes with the standard equilibrium solver
+        for(Index l = 0; l < size; ++l)
+        {
+            if(failed[l])
+            {
+                const VectorConstMap bel(be + l*Ee, Ee);
+                results[l] = solver.solve(states[l], T[l], P[l], bel);
+                continue;
+            }
+            updateChemicalState(l, states[l]);
+        }
+    }
+
+    /// Solve a batch of equilibrium problems in packets of `W` problems.
+    auto solve(ChemicalState* states, Index size, const double* T, const double* P, const double* be, EquilibriumResult* results) -> void
+    {
+        // Solve each problem with the standard solver if the IpNewton algorithm is not used
+        if(options.method != OptimumMethod::IpNewton)
+        {
+            for(Index k = 0; k < size; ++k)
+                results[k] = solver.solve(states[k], T[k], P[k], be + k*Ee);
+            return;
+        }
+
+        for(Index offset = 0; offset < size; offset += W)
+        {
+            const Index count = std::min<Index>(W, size - offset);
+            solvePacket(states + offset, count, T + offset, P + offset, be + offset*Ee, results + offset);
+        }
+    }
+};
+
+EquilibriumPacketSolver::EquilibriumPacketSolver()
+: pimpl(new Impl())
+{}
+
+EquilibriumPacketSolver::EquilibriumPacketSolver(const ChemicalSystem& system)
+: pimpl(new Impl(Partition(system)))
+{}
+
+EquilibriumPacketSolver::EquilibriumPacketSolver(const Partition& partition)
+: pimpl(new Impl(partition))
+{}
+
+EquilibriumPacketSolver::EquilibriumPacketSolver(const EquilibriumPacketSolver& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumPacketSolver::~EquilibriumPacketSolver()
+{}
+
+auto EquilibriumPacketSolver::operator=(EquilibriumPacketSolver other) -> EquilibriumPacketSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumPacketSolver::setOptions(const EquilibriumOptions& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto EquilibriumPacketSolver::setPartition(const Partition& partition) -> void
+{
+    pimpl->setPartition(partition);
+}
+
+auto EquilibriumPacketSolver::solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> std::vector<EquilibriumResult>
+{
+    const Index size = states.size();
+
+    Assert(Index(T.size()) == size && Index(P.size()) == size && Index(be.cols()) == size,
+        "Cannot proceed with method EquilibriumPacketSolver::solve.",
+        "The number of temperatures, pressures, and columns of element "
+        "amounts does not match the number of chemical states.");
+
+    Assert(unsigned(be.rows()) == pimpl->Ee,
+        "Cannot proceed with method EquilibriumPacketSolver::solve.",
+        "The number of rows of the given matrix of molar amounts of the "
+        "elements does not match the number of elements in the "
+        "equilibrium partition.");
+
+    // Ensure the element amounts of each problem are stored contiguously
+    const Matrix bmat = be;
+
+    std::vector<EquilibriumResult> results(size);
+    pimpl->solve(states.data(), size, T.data(), P.data(), bmat.data(), results.data());
+    return results;
+}
+
+auto EquilibriumPacketSolver::solve(ChemicalState* states, Index size, const double* T, const double* P, const double* be, EquilibriumResult* results) -> void
+{
+    pimpl->solve(states, size, T, P, be, results);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,106 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+class Partition;
+struct EquilibriumOptions;
+struct EquilibriumResult;
+
+/// A solver class that advances packets of small equilibrium problems in lockstep.
+/// All problems in a packet share the same chemical system and partition, and
+/// their primal and dual variables are stored interleaved across the lanes of
+/// the packet so that the Newton steps of the IpNewton algorithm are computed
+/// for all lanes at once. Lanes that converge early are masked out of the
+/// remaining iterations. Lanes whose Newton step cannot be computed, or that do
+/// not converge within the maximum number of iterations, are solved again with a
+/// standard EquilibriumSolver, whose escalation policy then applies. Only the
+/// results of these lanes have their EquilibriumResult::retry counters set.
+/// This solver targets systems with few species and elements, in which
+/// most of the time of a single equilibrium calculation is spent on
+/// overhead and operations on tiny matrices.
+/// @see EquilibriumSolver
+class EquilibriumPacketSolver
+{
+public:
+    /// The number of equilibrium problems advanced in lockstep in each packet.
+    static constexpr unsigned lanes = 8;
+
+    /// Construct a default EquilibriumPacketSolver instance
+    EquilibriumPacketSolver();
+
+    /// Construct an EquilibriumPacketSolver instance
+    explicit EquilibriumPacketSolver(const ChemicalSystem& system);
+
+    /// Construct an EquilibriumPacketSolver instance with given partition
+    explicit EquilibriumPacketSolver(const Partition& partition);
+
+    /// Construct a copy of an EquilibriumPacketSolver instance
+    EquilibriumPacketSolver(const EquilibriumPacketSolver& other);
+
+    /// Destroy this EquilibriumPacketSolver instance
+    virtual ~EquilibriumPacketSolver();
+
+    /// Assign a copy of an EquilibriumPacketSolver instance
+    auto operator=(EquilibriumPacketSolver other) -> EquilibriumPacketSolver&;
+
+    /// Set the options of the equilibrium solver.
+    /// Only diagonal Hessian approximations are used in the lockstep iterations, so that
+    /// `GibbsHessian::Exact` and `GibbsHessian::Approximation` are treated as their
+    /// diagonal counterparts. If the optimisation method is not `OptimumMethod::IpNewton`,
+    /// each problem is solved with a standard EquilibriumSolver instead.
+    auto setOptions(const EquilibriumOptions& options) -> void;
+
+    /// Set the partition of the chemical system
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Solve a batch of equilibrium problems in packets of `lanes` problems.
+    /// @param states[in,out] The initial guesses and the final states of the equilibrium calculations
+    /// @param T The temperatures of each problem (in units of K)
+    /// @param P The pressures of each problem (in units of Pa)
+    /// @param be The molar amounts of the elements in the equilibrium partition, one column per problem
+    /// @return The results of the equilibrium calculations, one per problem
+    auto solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> std::vector<EquilibriumResult>;
+
+    /// Solve a batch of equilibrium problems in packets of `lanes` problems.
+    /// @param states[in,out] The initial guesses and the final states of the equilibrium calculations
+    /// @param size The number of equilibrium problems
+    /// @param T The temperatures of each problem (in units of K)
+    /// @param P The pressures of each problem (in units of Pa)
+    /// @param be The molar amounts of the elements in the equilibrium partition, stored contiguously for each problem
+    /// @param results[out] The results of the equilibrium calculations, one per problem
+    auto solve(ChemicalState* states, Index size, const double* T, const double* P, const double* be, EquilibriumResult* results) -> void;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
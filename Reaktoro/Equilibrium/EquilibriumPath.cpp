@@ -18,9 +18,15 @@
 #include "EquilibriumPath.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <list>
+#include <mutex>
+#include <thread>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalPlot.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -50,119 +56,163 @@ struct EquilibriumPath::Impl
     /// The plots of the equilibrium path calculation
     std::vector<ChemicalPlot> plots;
 
+    /// The equilibrium solver, kept among path calculations
+    EquilibriumSolver equilibrium;
+
+    /// The ODE solver, whose integration memory is kept among path calculations
+    ODESolver ode;
+
+    /// The chemical state updated throughout the path calculation
+    ChemicalState state;
+
+    /// The temperatures at the initial and final chemical states of the current path
+    double T_i = 0.0, T_f = 0.0;
+
+    /// The pressures at the initial and final chemical states of the current path
+    double P_i = 0.0, P_f = 0.0;
+
+    /// The molar amounts of the elements in the equilibrium partition at the initial and final chemical states of the current path
+    Vector be_i, be_f;
+
+    /// The path parameter at the previous evaluation of the ODE function
+    double tprev = 0.0;
+
+    /// The result of the current path calculation
+    EquilibriumPathResult result;
+
+    /// The copies of this instance used by the threads that solve many paths at once
+    std::vector<std::unique_ptr<Impl>> workers;
+
     /// Construct a EquilibriumPath::Impl instance
     explicit Impl(const ChemicalSystem& system)
-    : system(system), partition(system)
-    {}
+    : system(system), partition(system), equilibrium(system), state(system)
+    {
+        setOptions(options);
+        setPartition(partition);
+    }
+
+    /// Construct a copy of a EquilibriumPath::Impl instance
+    Impl(const Impl& other)
+    : Impl(other.system)
+    {
+        setOptions(other.options);
+        setPartition(other.partition);
+        output = other.output;
+        plots = other.plots;
+    }
 
     /// Set the options for the equilibrium path calculation and visualization
     auto setOptions(const EquilibriumPathOptions& options_) -> void
     {
         options = options_;
+
+        // Ensure the iteration algorithm is not Newton
+        options.ode.iteration = ODEIterationMode::Functional;
+
+        equilibrium.setOptions(options.equilibrium);
+        ode.setOptions(options.ode);
+        workers.clear();
     }
 
     /// Set the partition of the chemical system
     auto setPartition(const Partition& partition_) -> void
     {
         partition = partition_;
-    }
 
-    /// Solve the path of equilibrium states between two chemical states
-    auto solve(const ChemicalState& state_i, const ChemicalState& state_f) -> EquilibriumPathResult
-    {
-        // The result of this equilibrium path calculation
-        EquilibriumPathResult result;
+        equilibrium.setPartition(partition);
 
-        // The number of equilibrium species
-        const unsigned Ne = partition.numEquilibriumSpecies();
+        // The ODE function describing the equilibrium path
+        ODEFunction f = [this](double t, VectorConstRef ne, VectorRef res) -> int
+        {
+            return function(t, res);
+        };
 
-        // The indices of species and elements in the equilibrium partition
-        const Indices& ies = partition.indicesEquilibriumSpecies();
+        // Initialize the ODE problem
+        ODEProblem problem;
+        problem.setNumEquations(partition.numEquilibriumSpecies());
+        problem.setFunction(f);
 
-        /// The temperatures at the initial and final chemical states
-        const double T_i = state_i.temperature();
-        const double T_f = state_f.temperature();
+        ode.setProblem(problem);
+        workers.clear();
+    }
 
-        /// The pressures at the initial and final chemical states
-        const double P_i = state_i.pressure();
-        const double P_f = state_f.pressure();
+    /// Evaluate the right-hand side function of the ODE describing the equilibrium path
+    auto function(double t, VectorRef res) -> int
+    {
+        // Skip if the step from the previous evaluation is too large
+        if(t > 0.0 && std::abs(t - tprev) >= options.maxstep) return 1;
 
-        /// The molar amounts of the elements in the equilibrium partition at the initial and final chemical states
-        const Vector be_i = state_i.elementAmountsInSpecies(ies);
-        const Vector be_f = state_f.elementAmountsInSpecies(ies);
+        // Update tprev
+        tprev = t;
 
-        // The equilibrium solver
-        EquilibriumSolver equilibrium(system);
-        equilibrium.setOptions(options.equilibrium);
-        equilibrium.setPartition(partition);
+        // Skip if t is greater or equal than 1
+        if(t >= 1) return 0;
 
-        /// The sensitivity of the equilibrium state
-        EquilibriumSensitivity sensitivity;
+        // Calculate T, P, be at current t
+        const double T  = T_i + t * (T_f - T_i);
+        const double P  = P_i + t * (P_f - P_i);
+        const Vector be = be_i + t * (be_f - be_i);
 
-        // The chemical state updated throughout the path calculation
-        ChemicalState state = state_i;
+        // Perform the equilibrium calculation at T, P, be
+        result.equilibrium += equilibrium.solve(state, T, P, be);
 
-        // The ODE function describing the equilibrium path
-        ODEFunction f = [&](double t, VectorConstRef ne, VectorRef res) -> int
-        {
-            static double tprev = t;
+        // Check if the calculation succeeded
+        if(!result.equilibrium.optimum.succeeded) return 1;
 
-            // Skip if t is greater or equal than 1
-            if(t > 0.0 && std::abs(t - tprev) >= options.maxstep) return 1;
+        // The sensitivity of the equilibrium state
+        const EquilibriumSensitivity& sensitivity = equilibrium.sensitivity();
 
-            // Update tprev
-            tprev = t;
+        // Calculate the right-hand side vector of the ODE
+        res = sensitivity.dndT * (T_f - T_i) +
+              sensitivity.dndP * (P_f - P_i) +
+              sensitivity.dndb * (be_f - be_i);
 
-            // Skip if t is greater or equal than 1
-            if(t >= 1) return 0;
+        return 0;
+    }
 
-            // Calculate T, P, be at current t
-            const double T  = T_i + t * (T_f - T_i);
-            const double P  = P_i + t * (P_f - P_i);
-            const Vector be = be_i + t * (be_f - be_i);
+    /// Update the output and plots with the current state
+    auto update(const ChemicalState& current, double t) -> void
+    {
+        // Update the output with current state
+        if(output) output.update(current, t);
 
-            // Perform the equilibrium calculation at T, P, be
-            result.equilibrium += equilibrium.solve(state, T, P, be);
+        // Update the plots with current state
+        for(auto& plot : plots) plot.update(current, t);
+    }
 
-            // Calculate the sensitivity of the equilibrium state
-            sensitivity = equilibrium.sensitivity();
+    /// Solve the path of equilibrium states between two chemical states
+    auto solve(const ChemicalState& state_i, const ChemicalState& state_f) -> EquilibriumPathResult
+    {
+        // Reset the result of this equilibrium path calculation
+        result = {};
 
-            // Check if the calculation succeeded
-            if(!result.equilibrium.optimum.succeeded) return 1;
+        // The indices of species and elements in the equilibrium partition
+        const Indices& ies = partition.indicesEquilibriumSpecies();
 
-            // Calculate the right-hand side vector of the ODE
-            res = sensitivity.dndT * (T_f - T_i) +
-                  sensitivity.dndP * (P_f - P_i) +
-                  sensitivity.dndb * (be_f - be_i);
+        // The temperatures and pressures at the initial and final chemical states
+        T_i = state_i.temperature();
+        T_f = state_f.temperature();
+        P_i = state_i.pressure();
+        P_f = state_f.pressure();
 
-            return 0;
-        };
+        // The molar amounts of the elements in the equilibrium partition at the initial and final chemical states
+        be_i = state_i.elementAmountsInSpecies(ies);
+        be_f = state_f.elementAmountsInSpecies(ies);
 
-        // Initialize the ODE problem
-        ODEProblem problem;
-        problem.setNumEquations(Ne);
-        problem.setFunction(f);
+        // The chemical state updated throughout the path calculation
+        state = state_i;
+        tprev = 0.0;
 
         // The initial and final molar amounts of equilibrium species
-        Vector ne_i = rows(state_i.speciesAmounts(), ies);
-        Vector ne_f = rows(state_i.speciesAmounts(), ies);
+        Vector ne = rows(state_i.speciesAmounts(), ies);
+        const Vector ne_f = rows(state_f.speciesAmounts(), ies);
 
         // Adjust the absolute tolerance parameters for each component
-        options.ode.abstols = options.ode.abstol * ((ne_i + ne_f)/2.0 + 1.0);
-
-        // Ensure the iteration algorithm is not Newton
-        options.ode.iteration = ODEIterationMode::Functional;
-
-        ODESolver ode;
-        ode.setOptions(options.ode);
-        ode.setProblem(problem);
+        ode.setTolerances(options.ode.reltol, options.ode.abstol * ((ne + ne_f)/2.0 + 1.0));
 
-        // Initialize initial conditions
+        // Initialize the ODE solver, reusing its memory from a previous path calculation
         double t = 0.0;
-        Vector& ne = ne_i;
-
-        // Initialize the ODE solver
-        ode.initialize(t, ne);
+        ode.reinitialize(t, ne);
 
         // Initialize the output of the equilibrium path calculation
         if(output) output.open();
@@ -170,26 +220,116 @@ struct EquilibriumPath::Impl
         // Initialize the plots of the equilibrium path calculation
         for(auto& plot : plots) plot.open();
 
+        // The number of steps performed so far and the path parameter of the next output
+        unsigned num_steps = 0;
+        double tout = 0.0;
+
         // Perform the integration from t = 0 to t = 1
         while(t < 1.0)
         {
-            // Update the output with current state
-            if(output) output.update(state, t);
+            // Update the output and plots at fixed intervals of t, or every few steps
+            if(options.output_interval > 0.0)
+            {
+                if(t >= tout)
+                {
+                    update(state, t);
+                    while(tout <= t) tout += options.output_interval;
+                }
+
+                // Integrate one time step only, without going over the next output
+                ode.integrate(t, ne, std::min(tout, 1.0));
+            }
+            else
+            {
+                if(num_steps % std::max(options.output_decimation, 1u) == 0)
+                    update(state, t);
+
+                // Integrate one time step only
+                ode.integrate(t, ne);
+            }
+
+            ++num_steps;
+        }
 
-            // Update the plots with current state
-            for(auto& plot : plots) plot.update(state, t);
+        // Update the output and plots with the final state
+        update(state_f, 1.0);
 
-            // Integrate one time step only
-            ode.integrate(t, ne);
-        }
+        return result;
+    }
 
-        // Update the output with the final state
-        if(output) output.update(state_f, 1.0);
+    /// Return the number of threads used to solve many paths at once
+    auto numThreads(Index num_paths) const -> Index
+    {
+        if(!system.hasReentrantModels())
+            return 1;
+        Index num_threads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, num_paths));
+    }
 
-        // Update the plots with the final state
-        for(auto& plot : plots) plot.update(state_f, 1.0);
+    /// Create a worker, with its own copy of the chemical system, but without output and plots
+    auto createWorker() const -> std::unique_ptr<Impl>
+    {
+        const ChemicalSystem copy = system.clone();
+        std::unique_ptr<Impl> worker(new Impl(copy));
+        worker->setOptions(options);
+        worker->setPartition(partition.clone(copy));
+        return worker;
+    }
 
-        return result;
+    /// Solve many independent paths of equilibrium states in parallel
+    auto solve(const std::vector<ChemicalState>& states_i, const std::vector<ChemicalState>& states_f) -> std::vector<EquilibriumPathResult>
+    {
+        Assert(states_i.size() == states_f.size(),
+            "Could not solve the equilibrium paths.",
+            "Expecting as many initial as final chemical states.");
+
+        const Index num_paths = states_i.size();
+
+        std::vector<EquilibriumPathResult> results(num_paths);
+
+        // Create the workers if needed
+        const Index num_threads = numThreads(num_paths);
+        while(workers.size() < num_threads)
+            workers.push_back(createWorker());
+
+        // The index of the next path to be solved
+        std::atomic<Index> next(0);
+
+        // The first exception thrown by a worker, if any
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        // The function executed by each thread, in which the paths are solved one at a time
+        auto run = [&](Impl& worker)
+        {
+            try {
+                for(Index k = next++; k < num_paths; k = next++)
+                    results[k] = worker.solve(states_i[k], states_f[k]);
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) error = std::current_exception();
+                next = num_paths;
+            }
+        };
+
+        // Solve the paths in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(*workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::ref(*workers[i]));
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        if(error)
+            std::rethrow_exception(error);
+
+        return results;
     }
 };
 
@@ -225,6 +365,11 @@ auto EquilibriumPath::solve(const ChemicalState& state_i, const ChemicalState& s
     return pimpl->solve(state_i, state_f);
 }
 
+auto EquilibriumPath::solve(const std::vector<ChemicalState>& states_i, const std::vector<ChemicalState>& states_f) -> std::vector<EquilibriumPathResult>
+{
+    return pimpl->solve(states_i, states_f);
+}
+
 auto EquilibriumPath::output() -> ChemicalOutput
 {
     pimpl->output = ChemicalOutput(pimpl->system);
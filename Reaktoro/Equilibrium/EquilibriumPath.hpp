@@ -47,6 +47,16 @@ struct EquilibriumPathOptions
 
     /// The maximum step length during the equilibrium path calculation.
     double maxstep = 0.1;
+
+    /// The interval of the path parameter (between 0 and 1) between consecutive updates of the output and plots.
+    /// The output and plots are updated at every `output_decimation` steps if this is zero.
+    double output_interval = 0.0;
+
+    /// The number of steps between consecutive updates of the output and plots if no output interval is given.
+    unsigned output_decimation = 1;
+
+    /// The number of threads used to solve many equilibrium paths at once (zero for the number of hardware threads).
+    unsigned num_threads = 0;
 };
 
 /// A struct that describes the result of an equilibrium path calculation.
@@ -81,6 +91,13 @@ public:
     /// Solve the path of equilibrium states between two chemical states
     auto solve(const ChemicalState& state_i, const ChemicalState& state_f) -> EquilibriumPathResult;
 
+    /// Solve many independent paths of equilibrium states in parallel.
+    /// The paths are distributed among threads, each with its own copy of the chemical system,
+    /// and the output and plots of this instance are not updated during their calculation.
+    /// @param states_i The initial chemical states of the paths
+    /// @param states_f The final chemical states of the paths
+    auto solve(const std::vector<ChemicalState>& states_i, const std::vector<ChemicalState>& states_f) -> std::vector<EquilibriumPathResult>;
+
     /// Return a ChemicalPlot instance.
     /// The returned ChemicalOutput instance must be properly configured
     /// before the method EquilibriumPath::solve is called.
@@ -19,9 +19,48 @@
 
 namespace Reaktoro {
 
+auto SmartEquilibriumResult::operator+=(const SmartEquilibriumResult& other) -> SmartEquilibriumResult&
+{
+    succeeded      = other.succeeded;
+    num_lookups   += other.num_lookups;
+    num_accepted  += other.num_accepted;
+    num_learned   += other.num_learned;
+    time_lookup   += other.time_lookup;
+    time_estimate += other.time_estimate;
+    time_learn    += other.time_learn;
+
+    return *this;
+}
+
+auto EquilibriumRetryStageResult::operator+=(const EquilibriumRetryStageResult& other) -> EquilibriumRetryStageResult&
+{
+    attempts   += other.attempts;
+    successes  += other.successes;
+    iterations += other.iterations;
+    time       += other.time;
+
+    return *this;
+}
+
+auto EquilibriumRetryResult::operator+=(const EquilibriumRetryResult& other) -> EquilibriumRetryResult&
+{
+    stage        = other.stage;
+    timeout      = timeout || other.timeout;
+    first       += other.first;
+    warmrestart += other.warmrestart;
+    alternative += other.alternative;
+    coldstart   += other.coldstart;
+
+    return *this;
+}
+
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optimum += other.optimum;
+    initialguess = other.initialguess;
+    retry += other.retry;
+    smart += other.smart;
+    properties += other.properties;
     return *this;
 }
 
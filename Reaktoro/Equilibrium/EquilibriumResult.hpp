@@ -17,7 +17,14 @@
 
 #pragma once
 
+// C++ includes
+#include <string>
+#include <vector>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Optimization/OptimumResult.hpp>
 
 namespace Reaktoro {
@@ -27,6 +34,106 @@ struct SmartEquilibriumResult
 {
     /// The boolean flag that indicates if smart equilibrium calculation was used.
     bool succeeded = false;
+
+    /// The number of searches for the nearest reference equilibrium state
+    unsigned num_lookups = 0;
+
+    /// The number of estimates that passed the acceptance test
+    unsigned num_accepted = 0;
+
+    /// The number of full equilibrium calculations stored as reference equilibrium states
+    unsigned num_learned = 0;
+
+    /// The wall time spent for the searches of the nearest reference equilibrium state (in units of s)
+    double time_lookup = 0;
+
+    /// The wall time spent for the estimates, including the searches (in units of s)
+    double time_estimate = 0;
+
+    /// The wall time spent for the full equilibrium calculations and their storage (in units of s)
+    double time_learn = 0;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const SmartEquilibriumResult& other) -> SmartEquilibriumResult&;
+};
+
+/// A type used to describe the result of the selection of the initial guess of an equilibrium calculation.
+/// @see EquilibriumInitialGuess
+struct EquilibriumInitialGuessResult
+{
+    /// The name of the provider of the initial guess used in the equilibrium calculation.
+    /// This is `coldstart` if the initial guess was calculated with a simplex approximation,
+    /// `warmstart` if the chemical state was used as given, or the name of the provider otherwise.
+    std::string provider;
+
+    /// The relative mismatch of the element amounts in the initial guess.
+    double mismatch = 0;
+
+    /// The number of iterations saved compared to the average of the cold-started calculations.
+    /// This is zero if the initial guess was not given by a provider or if no cold-started
+    /// calculation has been performed yet by the equilibrium solver.
+    double iterations_saved = 0;
+};
+
+/// The stages of the escalation policy of failed equilibrium calculations.
+/// @see EquilibriumRetryOptions
+enum class EquilibriumRetryStage
+{
+    /// The first attempt of the equilibrium calculation.
+    First,
+
+    /// The warm restart from the last iterate with reset dual potentials.
+    WarmRestart,
+
+    /// The restart from the initial guess with an alternative optimisation method.
+    Alternative,
+
+    /// The cold-start from a simplex approximation.
+    ColdStart,
+};
+
+/// A type used to describe the counters of a stage of the escalation policy.
+struct EquilibriumRetryStageResult
+{
+    /// The number of times this stage was attempted
+    unsigned attempts = 0;
+
+    /// The number of times this stage succeeded
+    unsigned successes = 0;
+
+    /// The number of iterations performed in this stage
+    unsigned iterations = 0;
+
+    /// The wall time spent in this stage (in units of s)
+    double time = 0;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const EquilibriumRetryStageResult& other) -> EquilibriumRetryStageResult&;
+};
+
+/// A type used to describe the result of the escalation policy of an equilibrium calculation.
+struct EquilibriumRetryResult
+{
+    /// The last stage attempted in the equilibrium calculation
+    EquilibriumRetryStage stage = EquilibriumRetryStage::First;
+
+    /// The boolean flag that indicates if a wall time limit interrupted the calculation
+    bool timeout = false;
+
+    /// The counters of the first attempt
+    EquilibriumRetryStageResult first;
+
+    /// The counters of the warm restart stage
+    EquilibriumRetryStageResult warmrestart;
+
+    /// The counters of the alternative method stage
+    EquilibriumRetryStageResult alternative;
+
+    /// The counters of the cold-start stage
+    EquilibriumRetryStageResult coldstart;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const EquilibriumRetryResult& other) -> EquilibriumRetryResult&;
 };
 
 /// A type used to describe the result of an equilibrium calculation
@@ -39,8 +146,55 @@ struct EquilibriumResult
     /// The boolean flag that indicates if smart equilibrium calculation was used.
     SmartEquilibriumResult smart;
 
+    /// The result of the selection of the initial guess for the equilibrium calculation.
+    EquilibriumInitialGuessResult initialguess;
+
+    /// The result of the escalation policy of the equilibrium calculation.
+    EquilibriumRetryResult retry;
+
+    /// The counters of the evaluations of the thermodynamic and chemical models.
+    ChemicalPropertiesCounters properties;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
 
+/// A type used to describe the result of the inverse equilibrium calculations of a batch of samples.
+/// @see EquilibriumInverseBatchSolver
+struct EquilibriumInverseBatchResult
+{
+    /// The amounts of the titrants of each sample, one row per sample (in units of mol)
+    Matrix titrants;
+
+    /// The number of iterations of the non-linear solver for each sample
+    std::vector<unsigned> iterations;
+
+    /// The indices of the samples whose calculations failed
+    Indices failed;
+
+    /// The number of samples in the last calculation
+    unsigned num_samples = 0;
+
+    /// The number of samples whose calculations succeeded
+    unsigned num_succeeded = 0;
+
+    /// The number of samples whose calculations failed
+    unsigned num_failed = 0;
+
+    /// The number of samples warm-started from the previous sample in their chunk
+    unsigned num_warmstarts = 0;
+
+    /// The number of warm-started samples solved again from their given chemical states
+    unsigned num_retries = 0;
+
+    /// The accumulated results of the equilibrium calculations of all samples
+    EquilibriumResult total;
+
+    /// The wall time spent in the last calculation (in units of s)
+    double time = 0;
+
+    /// The number of samples solved per second of wall time in the last calculation
+    double throughput = 0;
+};
+
 } // namespace Reaktoro
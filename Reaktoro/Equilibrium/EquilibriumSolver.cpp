@@ -22,12 +22,14 @@
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Connectivity.hpp>
 #include <Reaktoro/Core/Partition.hpp>
 #include <Reaktoro/Core/ThermoProperties.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInitialGuess.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
@@ -98,6 +100,9 @@ struct EquilibriumSolver::Impl
     /// The state of the optimisation calculation
     OptimumState optimum_state;
 
+    /// The initial state of the optimisation calculation (used by the alternative method retry stage)
+    OptimumState optimum_state0;
+
     /// The options for the optimisation calculation
     OptimumOptions optimum_options;
 
@@ -125,6 +130,18 @@ struct EquilibriumSolver::Impl
     /// The formula matrix of the inert species
     Matrix Ai;
 
+    /// The providers of initial guesses for the equilibrium calculations
+    std::vector<EquilibriumInitialGuessProvider> providers;
+
+    /// The initial guesses calculated by each provider
+    std::vector<EquilibriumInitialGuess> guesses;
+
+    /// The number of cold-started equilibrium calculations
+    unsigned num_coldstarts = 0;
+
+    /// The total number of iterations in the cold-started equilibrium calculations
+    unsigned coldstart_iterations = 0;
+
     /// Construct a default Impl instance
     Impl()
     {}
@@ -446,6 +463,132 @@ struct EquilibriumSolver::Impl
         return zero || !options.warmstart;
     }
 
+    /// Set the providers of initial guesses for the equilibrium calculations
+    auto setInitialGuessProviders(const std::vector<EquilibriumInitialGuessProvider>& providers_) -> void
+    {
+        providers = providers_;
+        guesses.assign(providers.size(), EquilibriumInitialGuess());
+    }
+
+    /// Select the initial guess for the equilibrium calculation, performing a cold-start if needed.
+    auto selectInitialGuess(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumInitialGuessResult
+    {
+        EquilibriumInitialGuessResult res;
+
+        // Use the chemical state as given if no provider has been set, unless cold-start is needed
+        if(providers.empty() || !options.warmstart)
+        {
+            if(coldstart(state))
+            {
+                initialguess(state, T, P, be);
+                res.provider = "coldstart";
+            }
+            else res.provider = "warmstart";
+            return res;
+        }
+
+        // The value used for scaling the mismatch of the element amounts
+        const double bmax = be.size() ? norminf(be) : 0.0;
+        const double bnorm = bmax > 0.0 ? bmax : 1.0;
+
+        // Find the initial guess with the smallest mismatch (the first one in case of ties)
+        const Index none = providers.size();
+        Index ibest = none;
+        double best = options.initialguess.mismatch;
+        for(Index k = 0; k < providers.size(); ++k)
+        {
+            auto& guess = guesses[k];
+            if(!providers[k].function(state, T, P, be, guess))
+                continue;
+            if(unsigned(guess.n.size()) != N || !guess.n.allFinite())
+                continue;
+            const double mismatch = norminf(Ae*guess.n(ies) - be)/bnorm;
+            if(ibest == none ? mismatch <= best : mismatch < best)
+            {
+                best = mismatch;
+                ibest = k;
+            }
+        }
+
+        // Perform a cold-start if no initial guess has been accepted
+        if(ibest == none)
+        {
+            initialguess(state, T, P, be);
+            res.provider = "coldstart";
+            return res;
+        }
+
+        // Update the chemical state with the selected initial guess
+        const auto& guess = guesses[ibest];
+        state.setSpeciesAmounts(guess.n);
+        if(unsigned(guess.y.size()) == E) state.setElementDualPotentials(guess.y);
+        if(unsigned(guess.z.size()) == N) state.setSpeciesDualPotentials(guess.z);
+
+        res.provider = providers[ibest].name;
+        res.mismatch = best;
+        return res;
+    }
+
+    /// Return true if a retry stage should be attempted after the previous stages.
+    auto attempt(const EquilibriumResult& result, const EquilibriumRetryStageOptions& stage) -> bool
+    {
+        return !result.optimum.succeeded && !result.retry.timeout && stage.max_iterations > 0;
+    }
+
+    /// Perform a stage of the equilibrium calculation in optimisation passes until convergence.
+    /// @param result The result of the equilibrium calculation updated with the stage results
+    /// @param stage The stage of the escalation policy
+    /// @param method The optimisation method used in the stage
+    /// @param max_iterations The maximum number of iterations in the stage
+    /// @param max_time The maximum wall time of the stage (zero means no limit)
+    /// @param begin The time point in which the equilibrium calculation started
+    auto runStage(EquilibriumResult& result, EquilibriumRetryStage stage, OptimumMethod method, unsigned max_iterations, double max_time, Time begin) -> void
+    {
+        // Start timing the stage
+        const Time start = time();
+
+        // The counters of the current stage
+        auto& counters =
+            stage == EquilibriumRetryStage::First       ? result.retry.first :
+            stage == EquilibriumRetryStage::WarmRestart ? result.retry.warmrestart :
+            stage == EquilibriumRetryStage::Alternative ? result.retry.alternative :
+                                                          result.retry.coldstart;
+
+        result.retry.stage = stage;
+        counters.attempts += 1;
+
+        // Set the method for the optimisation calculation
+        solver.setMethod(method);
+
+        // Set the maximum number of iterations in each optimization pass
+        optimum_options.max_iterations = options.retry.pass_iterations;
+
+        // Start the several opmization passes (stop if convergence attained)
+        unsigned counter = 0;
+        while(counter < max_iterations)
+        {
+            // Solve the optimisation problem
+            const OptimumResult pass = solver.solve(optimum_problem, optimum_state, optimum_options);
+            result.optimum += pass;
+            counters.iterations += pass.iterations;
+
+            // Exit this loop if last solve succeeded
+            if(result.optimum.succeeded)
+                break;
+
+            counter += optimum_options.max_iterations;
+
+            // Exit this loop if the wall time limits of the stage or of the whole calculation were exceeded
+            if(max_time && elapsed(start) > max_time)
+                break;
+            if(options.retry.max_time && elapsed(begin) > options.retry.max_time)
+                { result.retry.timeout = true; break; }
+        }
+
+        counters.successes += result.optimum.succeeded;
+        counters.time += elapsed(start);
+    }
+
     /// Solve the equilibrium problem, passing all elements that has on chemical system
     auto solve_with_all_element_amounts(ChemicalState& state, double T, double P, VectorConstRef b) -> EquilibriumResult
     {
@@ -468,6 +611,9 @@ struct EquilibriumSolver::Impl
     /// Solve the equilibrium problem
     auto solve(ChemicalState& state, double T, double P, const double* _be) -> EquilibriumResult
     {
+        // Start timing the calculation to check the wall time limits of the escalation policy
+        const Time begin = time();
+
         // Set the molar amounts of the elements
         be = Vector::Map(_be, Ee);
 
@@ -475,13 +621,16 @@ struct EquilibriumSolver::Impl
         state.setTemperature(T);
         state.setPressure(P);
 
-        // Check if a simplex cold-start approximation must be performed
-        if(coldstart(state))
-            initialguess(state, T, P, be);
-
         // The result of the equilibrium calculation
         EquilibriumResult result;
 
+        // Start counting the evaluations of the chemical properties in this calculation
+        properties.setPhaseTiming(options.phase_timing);
+        properties.resetCounters();
+
+        // Select the initial guess, performing a simplex cold-start approximation if needed
+        result.initialguess = selectInitialGuess(state, T, P, be);
+
         // Update the optimum options
         updateOptimumOptions();
 
@@ -491,29 +640,58 @@ struct EquilibriumSolver::Impl
         // Update the optimum state
         updateOptimumState(state);
 
-        // Set the method for the optimisation calculation
-        solver.setMethod(options.method);
+        // The options of the retry stages
+        const auto& retry = options.retry;
 
-        // Set the maximum number of iterations in each optimization pass
-        optimum_options.max_iterations = 10;
+        // Save the initial optimum state in case the warm restart or alternative method stages are attempted
+        if(retry.warmrestart.max_iterations || retry.alternative.max_iterations)
+            optimum_state0 = optimum_state;
 
-        // Start the several opmization passes (stop if convergence attained)
-        auto counter = 0;
-        while(counter < options.optimum.max_iterations)
+        // Perform the first attempt of the calculation
+        runStage(result, EquilibriumRetryStage::First, options.method, options.optimum.max_iterations, 0.0, begin);
+
+        // Restart from the last iterate with reset dual potentials
+        if(attempt(result, retry.warmrestart))
         {
-            // Solve the optimisation problem
-            result.optimum += solver.solve(optimum_problem, optimum_state, optimum_options);
+            if(!optimum_state.x.allFinite())
+                optimum_state.x = optimum_state0.x;
+            optimum_state.y.fill(0.0);
+            optimum_state.z.fill(0.0);
+            runStage(result, EquilibriumRetryStage::WarmRestart, options.method, retry.warmrestart.max_iterations, retry.warmrestart.max_time, begin);
+        }
 
-            // Exit this loop if last solve succeeded
-            if(result.optimum.succeeded)
-                break;
+        // Restart from the initial guess with an alternative optimisation method
+        if(attempt(result, retry.alternative))
+        {
+            optimum_state = optimum_state0;
+            runStage(result, EquilibriumRetryStage::Alternative, retry.alternative_method, retry.alternative.max_iterations, retry.alternative.max_time, begin);
+        }
 
-            counter += optimum_options.max_iterations;
+        // Restart from a simplex approximation
+        if(attempt(result, retry.coldstart))
+        {
+            initialguess(state, T, P, be);
+            updateOptimumOptions();
+            updateOptimumProblem(state);
+            updateOptimumState(state);
+            runStage(result, EquilibriumRetryStage::ColdStart, options.method, retry.coldstart.max_iterations, retry.coldstart.max_time, begin);
         }
 
+        // Update the average number of iterations of cold-started calculations, or compare with it
+        if(result.initialguess.provider == "coldstart")
+        {
+            num_coldstarts += 1;
+            coldstart_iterations += result.optimum.iterations;
+        }
+        else if(!providers.empty() && num_coldstarts > 0)
+            result.initialguess.iterations_saved = double(coldstart_iterations)/num_coldstarts - result.optimum.iterations;
+
         // Update the chemical state from the optimum state
         updateChemicalState(state);
 
+        // Set the counters of the evaluations of the chemical properties
+        result.properties = properties.counters();
+
         return result;
     }
 
@@ -612,6 +790,18 @@ auto EquilibriumSolver::setPartition(const Partition& partition) -> void
     pimpl->setPartition(partition);
 }
 
+auto EquilibriumSolver::setInitialGuessProviders(const std::vector<EquilibriumInitialGuessProvider>& providers) -> void
+{
+    pimpl->setInitialGuessProviders(providers);
+}
+
+auto EquilibriumSolver::initialGuess(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumInitialGuessResult
+{
+    state.setTemperature(T);
+    state.setPressure(P);
+    return pimpl->selectInitialGuess(state, T, P, be);
+}
+
 auto EquilibriumSolver::approximate(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult
 {
     return pimpl->approximate(state, T, P, be);
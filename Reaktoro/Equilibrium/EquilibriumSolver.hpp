@@ -17,6 +17,7 @@
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
@@ -29,6 +30,8 @@ class ChemicalState;
 class ChemicalSystem;
 class Partition;
 class EquilibriumProblem;
+struct EquilibriumInitialGuessProvider;
+struct EquilibriumInitialGuessResult;
 struct EquilibriumOptions;
 struct EquilibriumResult;
 struct EquilibriumSensitivity;
@@ -61,6 +64,23 @@ public:
     /// Set the partition of the chemical system
     auto setPartition(const Partition& partition) -> void;
 
+    /// Set the providers of initial guesses for the equilibrium calculations.
+    /// Before each equilibrium calculation, the initial guesses of all providers are
+    /// compared with the given amounts of the elements, and the one with the smallest
+    /// mismatch is used. A cold-start is performed if no initial guess is accepted.
+    /// If no provider is set, the chemical state is used as initial guess when possible.
+    /// @see EquilibriumInitialGuessOptions, EquilibriumInitialGuessResult
+    auto setInitialGuessProviders(const std::vector<EquilibriumInitialGuessProvider>& providers) -> void;
+
+    /// Select the initial guess for an equilibrium problem, as done at the start of each equilibrium calculation.
+    /// The initial guesses of the providers are used if any is accepted, otherwise a cold-start
+    /// approximation is performed when the chemical state cannot be used as initial guess.
+    /// @param state[in,out] The chemical state to be updated with the selected initial guess
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param be The molar amounts of the elements in the equilibrium partition
+    auto initialGuess(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumInitialGuessResult;
+
     /// Find an initial feasible guess for an equilibrium problem.
     /// @param state[in,out] The initial guess and the final state of the equilibrium approximation
     /// @param be The molar amounts of the elements in the equilibrium partition
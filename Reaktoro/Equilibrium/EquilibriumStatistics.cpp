@@ -0,0 +1,61 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumStatistics.hpp"
+
+// C++ includes
+#include <algorithm>
+
+namespace Reaktoro {
+
+auto EquilibriumStatistics::add(const EquilibriumResult& result) -> void
+{
+    num_calculations += 1;
+    num_failures += !result.optimum.succeeded;
+    num_timeouts += result.retry.timeout;
+    num_restarts += result.retry.warmrestart.attempts + result.retry.alternative.attempts + result.retry.coldstart.attempts;
+    num_smart_estimates += result.smart.succeeded;
+    max_iterations = std::max(max_iterations, result.optimum.iterations);
+    max_time = std::max(max_time, result.optimum.time);
+    total += result;
+}
+
+auto EquilibriumStatistics::averageIterations() const -> double
+{
+    return num_calculations ? double(total.optimum.iterations)/num_calculations : 0.0;
+}
+
+auto EquilibriumStatistics::averageTime() const -> double
+{
+    return num_calculations ? total.optimum.time/num_calculations : 0.0;
+}
+
+auto EquilibriumStatistics::operator+=(const EquilibriumStatistics& other) -> EquilibriumStatistics&
+{
+    num_calculations    += other.num_calculations;
+    num_failures        += other.num_failures;
+    num_timeouts        += other.num_timeouts;
+    num_restarts        += other.num_restarts;
+    num_smart_estimates += other.num_smart_estimates;
+    max_iterations       = std::max(max_iterations, other.max_iterations);
+    max_time             = std::max(max_time, other.max_time);
+    total               += other.total;
+
+    return *this;
+}
+
+} // namespace Reaktoro
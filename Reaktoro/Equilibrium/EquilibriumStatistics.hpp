@@ -0,0 +1,71 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+
+namespace Reaktoro {
+
+/// A type used to aggregate the results of many equilibrium calculations.
+/// Adding a result only updates counters and sums, so that an instance can be
+/// kept next to a solver in production runs. In multithreaded runs, use one
+/// instance per thread and merge them at the end with the addition assignment.
+/// @see EquilibriumResult
+struct EquilibriumStatistics
+{
+    /// The number of equilibrium calculations
+    unsigned num_calculations = 0;
+
+    /// The number of equilibrium calculations that failed to converge
+    unsigned num_failures = 0;
+
+    /// The number of equilibrium calculations interrupted by a wall time limit
+    unsigned num_timeouts = 0;
+
+    /// The number of retry stages attempted after failed first attempts
+    unsigned num_restarts = 0;
+
+    /// The number of equilibrium calculations that used a smart estimate
+    unsigned num_smart_estimates = 0;
+
+    /// The maximum number of iterations in an equilibrium calculation
+    unsigned max_iterations = 0;
+
+    /// The maximum wall time spent in an equilibrium calculation (in units of s)
+    double max_time = 0;
+
+    /// The sum of the results of all equilibrium calculations.
+    /// The counters and times in this result are totals. Its flags and errors
+    /// are those of the last calculation added.
+    EquilibriumResult total;
+
+    /// Add the result of an equilibrium calculation
+    auto add(const EquilibriumResult& result) -> void;
+
+    /// Return the average number of iterations per equilibrium calculation
+    auto averageIterations() const -> double;
+
+    /// Return the average wall time per equilibrium calculation (in units of s)
+    auto averageTime() const -> double;
+
+    /// Merge the statistics of another instance into this one
+    auto operator+=(const EquilibriumStatistics& other) -> EquilibriumStatistics&;
+};
+
+} // namespace Reaktoro
@@ -24,6 +24,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -83,8 +84,11 @@ struct SmartEquilibriumSolver::Impl
     /// Learn how to perform a full equilibrium calculation.
     auto learn(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult
     {
+        const Time begin = time();
         EquilibriumResult res = solver.solve(state, T, P, be);
         tree.emplace_back(be, state, solver.properties(), solver.sensitivity());
+        res.smart.num_learned += 1;
+        res.smart.time_learn += elapsed(begin);
         return res;
     }
 
@@ -95,6 +99,8 @@ struct SmartEquilibriumSolver::Impl
 
         using TreeNodeType = std::tuple<Vector, ChemicalState, ChemicalProperties, EquilibriumSensitivity>;
 
+        const Time begin = time();
+
         EquilibriumResult res;
 
         auto comp = [&](const TreeNodeType& a, const TreeNodeType& b)
@@ -106,6 +112,9 @@ struct SmartEquilibriumSolver::Impl
 
         auto it = std::min_element(tree.begin(), tree.end(), comp);
 
+        res.smart.num_lookups += 1;
+        res.smart.time_lookup += elapsed(begin);
+
         const auto& be0 = std::get<0>(*it);
         const ChemicalState& state0 = std::get<1>(*it);
         const ChemicalProperties& properties0 = std::get<2>(*it);
@@ -162,6 +171,8 @@ struct SmartEquilibriumSolver::Impl
             state.setSpeciesAmounts(n);
             res.optimum.succeeded = true;
             res.smart.succeeded = true;
+            res.smart.num_accepted += 1;
+            res.smart.time_estimate += elapsed(begin);
             return res;
         }
 
@@ -191,6 +202,8 @@ struct SmartEquilibriumSolver::Impl
         //     std::cout << std::endl;
         // }
 
+        res.smart.time_estimate += elapsed(begin);
+
         return res;
     }
 
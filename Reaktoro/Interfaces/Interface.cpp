@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <mutex>
 #include <vector>
 
 // Reaktoro includes
@@ -52,11 +53,120 @@ auto speciesInPhase(const Interface& interface, std::vector<Species> species, In
     return std::vector<Species>(begin, end);
 }
 
+/// A pool of independent Interface instances shared by the threads evaluating the models of a chemical system.
+/// A thread takes an idle instance from the pool, uses it, and gives it back, so that the pool holds at most
+/// as many instances as threads that ever evaluated the models at the same time. A new replica of the primary
+/// instance is created only the first time all instances are busy, so that no replica is created if the models
+/// are never evaluated concurrently. If the interfaced code cannot be replicated, all threads use the primary
+/// instance one at a time.
+class InterfacePool
+{
+public:
+    /// Construct an InterfacePool instance with given primary Interface instance
+    explicit InterfacePool(const std::shared_ptr<Interface>& primary)
+    : primary(primary), idle{primary}, replicable(primary->isReplicable())
+    {}
+
+    /// Apply a function on an Interface instance not used by any other thread
+    template<typename Function>
+    auto apply(const Function& f) -> void
+    {
+        std::shared_ptr<Interface> interface = acquire();
+
+        // Use the primary instance one thread at a time if no instance is available
+        if(!interface)
+        {
+            std::lock_guard<std::mutex> lock(primary_mutex);
+            f(*primary);
+            return;
+        }
+
+        try {
+            if(interface == primary)
+            {
+                std::lock_guard<std::mutex> lock(primary_mutex);
+                f(*primary);
+            }
+            else f(*interface);
+        }
+        catch(...) {
+            release(interface);
+            throw;
+        }
+
+        release(interface);
+    }
+
+private:
+    /// Take an idle Interface instance from the pool, or replicate the primary one, or return null if it cannot be replicated
+    auto acquire() -> std::shared_ptr<Interface>
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!idle.empty())
+            {
+                std::shared_ptr<Interface> interface = idle.back();
+                idle.pop_back();
+                return interface;
+            }
+            if(!replicable)
+                return {};
+        }
+
+        // Replicate the primary instance without blocking the pool, but not while another thread uses it
+        std::shared_ptr<Interface> replica;
+        {
+            std::lock_guard<std::mutex> lock(primary_mutex);
+            replica = primary->replicate();
+        }
+
+        if(!replica)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            replicable = false;
+        }
+
+        return replica;
+    }
+
+    /// Give an Interface instance back to the pool
+    auto release(const std::shared_ptr<Interface>& interface) -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle.push_back(interface);
+    }
+
+    /// The primary Interface instance
+    std::shared_ptr<Interface> primary;
+
+    /// The Interface instances not currently used by any thread
+    std::vector<std::shared_ptr<Interface>> idle;
+
+    /// The boolean flag that indicates if the primary instance can be replicated
+    bool replicable;
+
+    /// The mutex that protects the idle instances and the replicable flag
+    std::mutex mutex;
+
+    /// The mutex that serializes the uses of the primary instance, including its replication
+    std::mutex primary_mutex;
+};
+
 } // namespace
 
 Interface::~Interface()
 {}
 
+auto Interface::replicate() const -> std::shared_ptr<Interface>
+{
+    return {};
+}
+
+auto Interface::isReplicable() const -> bool
+{
+    return false;
+}
+
 auto Interface::formulaMatrix() const -> Matrix
 {
     const unsigned E = numElements();
@@ -170,20 +280,24 @@ auto Interface::system() const -> ChemicalSystem
         phases[i].setChemicalModel(phase_chemical_model);
     }
 
+    // Create the pool of Interface instances used by the threads evaluating the models below, which replicates the interface only when needed
+    std::shared_ptr<InterfacePool> pool = std::make_shared<InterfacePool>(interface);
+
     // Create the ThermoModel function for the chemical system
     ThermoModel thermo_model = [=](ThermoModelResult& res, Temperature T, Pressure P) -> void
     {
-        interface->properties(res, T, P);
+        pool->apply([&](Interface& x) { x.properties(res, T, P); });
     };
 
     // Create the ChemicalModel function for the chemical system
     ChemicalModel chemical_model = [=](ChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) -> void
     {
-        interface->properties(res, T, P, n);
+        pool->apply([&](Interface& x) { x.properties(res, T, P, n); });
     };
 
-    // Create the ChemicalSystem instance
+    // Create the ChemicalSystem instance, whose models can be evaluated concurrently only if the interface can be replicated
     ChemicalSystem system(phases, thermo_model, chemical_model);
+    system.setReentrantModels(interface->isReplicable());
 
     return system;
 }
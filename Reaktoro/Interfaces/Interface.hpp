@@ -90,6 +90,18 @@ public:
     /// Return a clone of this Interface instance.
     virtual auto clone() const -> std::shared_ptr<Interface> = 0;
 
+    /// Return an independent copy of this Interface instance that shares no internal state with it.
+    /// The chemical system created with method @ref system uses such copies to evaluate its
+    /// models concurrently in different threads, one copy per thread evaluating them at the same time.
+    /// The default implementation returns a null pointer, in which case the evaluations of the models
+    /// are serialized and the chemical system does not declare its models reentrant.
+    virtual auto replicate() const -> std::shared_ptr<Interface>;
+
+    /// Return true if method @ref replicate creates independent copies of this Interface instance.
+    /// This method must be cheap, since it is used to decide, without replicating the interfaced
+    /// code, if the models of the chemical system created with method @ref system are reentrant.
+    virtual auto isReplicable() const -> bool;
+
     /// Return the formula matrix of the species
     auto formulaMatrix() const -> Matrix;
 
@@ -18,6 +18,7 @@
 #include "Phreeqc.hpp"
 
 // C++ includes
+#include <limits>
 #include <map>
 
 // Eigen includes
@@ -96,6 +97,9 @@ struct Phreeqc::Impl
     // The name of the database file loaded into this instance
     std::string database;
 
+    // The input scripts executed in this instance, in the order they were executed
+    std::vector<std::string> inputs;
+
     // The set of elements composing the species
     std::vector<element*> elements;
 
@@ -123,6 +127,9 @@ struct Phreeqc::Impl
     // The index of H2O species in the list of aqueous species
     unsigned iH2O;
 
+    // The index of the aqueous phase and the index of its first species among all species
+    Index iaqueous = 0, ifirst_aqueous = 0;
+
     // The elements that are used as redox couples and their redox couples, e.g., N: {N(-3), N(5)}
     std::map<std::string, std::set<std::string>> redox_elements;
 
@@ -192,6 +199,16 @@ struct Phreeqc::Impl
     // The molar volumes of the phases (aqueous, gaseous, minerals, etc.)
     Vector phase_molar_volumes;
 
+    // The derivatives of the ln activity coefficients of the aqueous species w.r.t. their amounts
+    Matrix ln_activity_coefficients_aqueous_species_ddn;
+
+    // The derivatives of the ln activities of the aqueous species w.r.t. their amounts
+    Matrix ln_activities_aqueous_species_ddn;
+
+    // The temperature, pressure and species amounts at which the above derivatives were last calculated
+    double ddn_T = 0.0, ddn_P = 0.0;
+    Vector ddn_n;
+
     // Construct a default Phreeqc::Impl instance
     Impl();
 
@@ -254,6 +271,14 @@ struct Phreeqc::Impl
     // Set the temperature, pressure and species composition
     auto set(double T, double P, const Vector& n) -> void;
 
+    // Set the temperature, pressure and species composition, and also update
+    // the derivatives of the ln activities of the aqueous species w.r.t. their amounts
+    auto setWithDerivatives(double T, double P, const Vector& n) -> void;
+
+    // Calculate the ln activity coefficients and ln activities of the aqueous species,
+    // including the ionic strength corrections, at the current state of PHREEQC
+    auto aqueousActivities(Vector& ln_g, Vector& ln_a) -> void;
+
     // Update the properties with T and P dependency.
     auto updateThermoProperties() -> void;
 
@@ -339,6 +364,9 @@ auto Phreeqc::Impl::execute(std::string input, std::string output) -> void
     // Execute the given input script file
     PhreeqcUtils::execute(phreeqc, input, output);
 
+    // Record the input script so that independent copies of this instance can be created
+    inputs.push_back(input);
+
     // Initialize the data members after executing the PHREEQC script
     initialize();
 }
@@ -556,6 +584,10 @@ auto Phreeqc::Impl::initializeNames() -> void
 
     for(auto x : mineral_species)
         phase_names.push_back(x->name);
+
+    // Look up the aqueous phase and its first species, which are used to locate the aqueous block of derivatives
+    iaqueous = index(std::string("Aqueous"), phase_names);
+    ifirst_aqueous = aqueous_species.size() ? index(aqueous_species.front()->name, species_names) : 0;
 }
 
 auto Phreeqc::Impl::initializeSpeciesCharges() -> void
@@ -728,6 +760,153 @@ auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
     updateChemicalProperties();
 }
 
+auto Phreeqc::Impl::setWithDerivatives(double T, double P, const Vector& n) -> void
+{
+    // Check if the derivatives were already calculated at the given conditions
+    const bool cached = T == ddn_T && P == ddn_P && ddn_n.size() == n.size() && ddn_n == n;
+
+    // Calculate the properties with the given conditions if the derivatives are cached
+    if(cached)
+        return set(T, P, n);
+
+    // Set the temperature, pressure and species amounts without updating the chemical properties yet
+    this->T = T;
+    this->P = P;
+    phreeqc.tk_x = T;
+    phreeqc.tc_x = T - 273.15;
+    phreeqc.patm_x = P * pascal_to_atm;
+    setSpeciesAmounts(n);
+    updateThermoProperties();
+
+    // The number of aqueous species
+    const unsigned Naq = aqueous_species.size();
+
+    // The amounts of the aqueous species, their total and the amount and mass of water
+    const auto n_aqueous = n.segment(ifirst_aqueous, Naq);
+    const double n_total = sum(n_aqueous);
+    const double nH2O = n_aqueous[iH2O];
+    const double massH2O = nH2O * waterMolarMass;
+
+    // The matrices of derivatives of ln activity coefficients and ln activities
+    Matrix& dlng = ln_activity_coefficients_aqueous_species_ddn;
+    Matrix& dlna = ln_activities_aqueous_species_ddn;
+    dlng = zeros(Naq, Naq);
+    dlna = zeros(Naq, Naq);
+
+    // The ln activity coefficients and ln activities at perturbed conditions
+    Vector ln_g, ln_a;
+
+    // The square root of the machine epsilon used to calculate finite difference steps
+    const double sqrteps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    // Skip the derivative calculation if there is no water, since there are no molalities
+    if(Naq && massH2O > 0.0)
+    {
+        if(phreeqc.pitzer_model || phreeqc.sit_model)
+        {
+            // Pitzer and SIT activity coefficients depend on the molalities of all species.
+            // Thus, perturb each aqueous species in turn and store the perturbed values in
+            // the columns of the matrices, which are converted to derivatives further below.
+            Vector np = n;
+            for(unsigned j = 0; j < Naq; ++j)
+            {
+                const double h = sqrteps * std::max(n_aqueous[j], 1e-10);
+                np[ifirst_aqueous + j] = n_aqueous[j] + h;
+                setSpeciesAmounts(np);
+                aqueousActivities(ln_g, ln_a);
+                dlng.col(j) = ln_g/h;
+                dlna.col(j) = ln_a/h;
+                np[ifirst_aqueous + j] = n_aqueous[j];
+            }
+            setSpeciesAmounts(n);
+        }
+        else
+        {
+            // The conventional PHREEQC activity models depend on composition only through
+            // the ionic strength. Thus, a single perturbation of ionic strength suffices.
+            const double h = sqrteps * std::max(I, 1e-6);
+            phreeqc.mu_x = I + h;
+            aqueousActivities(ln_g, ln_a);
+            phreeqc.mu_x = I;
+            dlng.col(0) = ln_g/h;
+            dlna.col(0) = ln_a/h;
+        }
+    }
+
+    // Calculate the chemical properties at the unperturbed conditions
+    updateChemicalProperties();
+
+    // Save the conditions at which the derivatives are calculated
+    ddn_T = T;
+    ddn_P = P;
+    ddn_n = n;
+
+    if(!Naq || massH2O <= 0.0)
+        return;
+
+    // The ln activity coefficients and ln activities at the unperturbed conditions
+    const double RT = universalGasConstant * T;
+    ln_g = ln_activity_coefficients_aqueous_species;
+    ln_a = ln_activities_aqueous_species + (standard_molar_gibbs_energies_TPI - standard_molar_gibbs_energies).segment(ifirst_aqueous, Naq)/RT;
+
+    if(phreeqc.pitzer_model || phreeqc.sit_model)
+    {
+        // Convert the perturbed values into forward finite difference derivatives
+        for(unsigned j = 0; j < Naq; ++j)
+        {
+            const double h = sqrteps * std::max(n_aqueous[j], 1e-10);
+            dlng.col(j) -= ln_g/h;
+            dlna.col(j) -= ln_a/h;
+        }
+    }
+    else
+    {
+        // The derivatives of ln activity coefficients and ln activities w.r.t. ionic strength
+        const double h = sqrteps * std::max(I, 1e-6);
+        const Vector dlngdI = dlng.col(0) - ln_g/h;
+        const Vector dlnadI = dlna.col(0) - ln_a/h;
+
+        // The derivatives of ionic strength w.r.t. the amounts of the aqueous species
+        Vector dIdn(Naq);
+        for(unsigned j = 0; j < Naq; ++j)
+            dIdn[j] = 0.5 * aqueous_species[j]->z * aqueous_species[j]->z/massH2O;
+        dIdn[iH2O] -= I/nH2O;
+
+        // Apply the chain rule on the ionic strength dependence
+        dlng = dlngdI * tr(dIdn);
+        dlna = dlnadI * tr(dIdn);
+
+        // Add the derivatives of the ln molalities of the solutes and ln mole fraction of water
+        for(unsigned i = 0; i < Naq; ++i)
+        {
+            if(i == iH2O || !std::isfinite(aqueous_species[i]->lm))
+                continue;
+            dlna(i, i) += 1.0/n_aqueous[i];
+            dlna(i, iH2O) -= 1.0/nH2O;
+        }
+        dlna(iH2O, iH2O) += 1.0/nH2O;
+        dlna.row(iH2O).array() -= 1.0/n_total;
+    }
+}
+
+auto Phreeqc::Impl::aqueousActivities(Vector& ln_g, Vector& ln_a) -> void
+{
+    // Update the equilibrium constants of reactions with T, P, and I corrections
+    phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
+
+    // Update the standard Gibbs energies of the species with T, P, and I corrections
+    standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
+
+    // Update the activity coefficients and activities of the aqueous species
+    updateAqueousProperties();
+
+    // Transfer the ionic strength corrections of the equilibrium constants to the activities
+    const unsigned Naq = aqueous_species.size();
+    const double RT = universalGasConstant * T;
+    ln_g = ln_activity_coefficients_aqueous_species;
+    ln_a = ln_activities_aqueous_species + (standard_molar_gibbs_energies_TPI - standard_molar_gibbs_energies).segment(ifirst_aqueous, Naq)/RT;
+}
+
 auto Phreeqc::Impl::updateThermoProperties() -> void
 {
     // Set ionic strength to zero to eliminate ionic strength corrections in
@@ -1311,8 +1490,9 @@ auto Phreeqc::properties(ThermoModelResult& res, double T, double P) -> void
 
 auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void
 {
-    // Update the temperature, pressure, and species amounts of the Phreeqc instance
-    set(T, P, n);
+    // Update the temperature, pressure, and species amounts of the Phreeqc instance,
+    // as well as the derivatives of the activities of the aqueous species
+    pimpl->setWithDerivatives(T, P, n);
 
     // Set the molar volumes of the phases, ln activity coefficients and ln activities of all species
     res.phaseMolarVolumes().val = pimpl->phase_molar_volumes;
@@ -1322,12 +1502,29 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
     // The number of phases
     const Index num_phases = numPhases();
 
-    // Set the molar derivatives of the activities
-    Index offset = 0;
+    // The number of aqueous species
+    const Index num_aqueous = pimpl->aqueous_species.size();
+
+    // The index of the aqueous phase and of its first species
+    const Index iaqueous = pimpl->iaqueous;
+    const Index ifirst = pimpl->ifirst_aqueous;
+
+    // Set the molar derivatives of the activities of the aqueous species
+    if(num_aqueous)
+    {
+        res.lnActivityCoefficients().ddn.block(ifirst, ifirst, num_aqueous, num_aqueous) = pimpl->ln_activity_coefficients_aqueous_species_ddn;
+        res.lnActivities().ddn.block(ifirst, ifirst, num_aqueous, num_aqueous) = pimpl->ln_activities_aqueous_species_ddn;
+    }
+
+    // Set the molar derivatives of the activities of the species in the other phases
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
-        // The number of species in the current phase
+        if(iphase == iaqueous)
+            continue;
+
+        // The number of species in the current phase and the index of its first species
         const Index size = numSpeciesInPhase(iphase);
+        const Index offset = indexFirstSpeciesInPhase(iphase);
 
         // The species amounts in the current phase
         const auto np = n.segment(offset, size);
@@ -1335,8 +1532,6 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
         // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions
         res.lnActivities().ddn.block(offset, offset, size, size) = -1.0/sum(np) * ones(size, size);
         res.lnActivities().ddn.block(offset, offset, size, size).diagonal() += 1.0/np;
-
-        offset += size;
     }
 }
 
@@ -1345,6 +1540,23 @@ auto Phreeqc::clone() const -> std::shared_ptr<Interface>
     return std::make_shared<Phreeqc>(*this);
 }
 
+auto Phreeqc::replicate() const -> std::shared_ptr<Interface>
+{
+    // The Impl instance holds pointers into its PHREEQC instance and cannot be copied.
+    // Thus, load the database and execute the input scripts again in a new instance.
+    std::shared_ptr<Phreeqc> copy = std::make_shared<Phreeqc>();
+    if(!pimpl->database.empty())
+        copy->pimpl->load(pimpl->database);
+    for(const std::string& input : pimpl->inputs)
+        copy->pimpl->execute(input, {});
+    return copy;
+}
+
+auto Phreeqc::isReplicable() const -> bool
+{
+    return true;
+}
+
 auto Phreeqc::phreeqc() -> PHREEQC&
 {
     return pimpl->phreeqc;
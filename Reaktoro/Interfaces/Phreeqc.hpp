@@ -84,6 +84,9 @@ public:
     virtual auto properties(ThermoModelResult& res, double T, double P) -> void;
 
     /// Return the chemical properties of the phases and its species.
+    /// The derivatives of the ln activities and ln activity coefficients of the aqueous species
+    /// w.r.t. their amounts are calculated by finite differences on the PHREEQC activity models.
+    /// These are reused while the temperature, pressure and species amounts remain unchanged.
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The amounts of the species (in units of mol)
@@ -92,6 +95,13 @@ public:
     /// Return a clone of this Phreeqc instance
     virtual auto clone() const -> std::shared_ptr<Interface>;
 
+    /// Return an independent copy of this Phreeqc instance with its own low-level PHREEQC instance.
+    /// The copy is created by loading the same database and executing the same input scripts again.
+    virtual auto replicate() const -> std::shared_ptr<Interface>;
+
+    /// Return true, since Phreeqc instances can always be replicated.
+    virtual auto isReplicable() const -> bool;
+
     /// Set the temperature and pressure of the interfaced code.
     /// This method should be used to update all thermodynamic properties
     /// that depend only on temperature and pressure, such as standard thermodynamic
@@ -17,8 +17,18 @@
 
 #include "Interpreter.hpp"
 
+// C++ includes
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
@@ -26,9 +36,231 @@
 #include <Reaktoro/Thermodynamics/Core/ChemicalEditor.hpp>
 #include <Reaktoro/Thermodynamics/Core/Database.hpp>
 
-#include <fstream>
-
 namespace Reaktoro {
+namespace {
+
+/// Return the chemical system defined in a json node using a given database.
+auto createChemicalSystem(const Database& database, json node) -> ChemicalSystem
+{
+    auto elements = node["elements"].get<std::vector<std::string>>();
+
+    ChemicalEditor editor(database);
+    editor.initializePhasesWithElements(elements);
+
+    return ChemicalSystem(editor);
+}
+
+/// Return the chemical state in equilibrium with the conditions of a json node.
+auto equilibriumState(const ChemicalSystem& system, json node) -> ChemicalState
+{
+    EquilibriumProblem problem(system);
+    problem.setTemperature(node["temperature"]["value"], node["temperature"]["units"]);
+    problem.setPressure(node["pressure"]["value"], node["pressure"]["units"]);
+    for(auto item : node["substances"])
+        problem.add(item["substance"], item["quantity"], item["units"]);
+
+    return equilibrate(problem);
+}
+
+/// Return the state reference name of a calculation in a json node.
+auto stateReference(const json& node) -> std::string
+{
+    return node.count("stateReference") ? node["stateReference"].get<std::string>() : "default";
+}
+
+/// Return the chemical state given explicitly in a json node.
+/// The species amounts are given either as an array with all species or as an object of species names and amounts.
+auto explicitState(const ChemicalSystem& system, json node) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.setTemperature(node["temperature"]["value"], node["temperature"]["units"]);
+    state.setPressure(node["pressure"]["value"], node["pressure"]["units"]);
+
+    json amounts = node["speciesAmounts"];
+    if(amounts.is_array())
+    {
+        auto n = amounts.get<std::vector<double>>();
+        Assert(n.size() == system.numSpecies(), "Could not set the chemical state.",
+            "Expecting as many species amounts as species in the system.");
+        state.setSpeciesAmounts(Vector::Map(n.data(), n.size()));
+    }
+    else for(auto it = amounts.begin(); it != amounts.end(); ++it)
+        state.setSpeciesAmount(it.key(), it.value().get<double>());
+
+    return state;
+}
+
+/// Return the json result of a calculation, or the error that prevented it.
+auto calculate(const ChemicalSystem& system, json node) -> json
+{
+    json result;
+
+    try {
+        ChemicalState state(system);
+
+        if(node.count("equilibrium"))
+        {
+            state = equilibriumState(system, node["equilibrium"]);
+            result["stateReference"] = stateReference(node["equilibrium"]);
+        }
+        else if(node.count("state"))
+            state = explicitState(system, node["state"]);
+        else
+        {
+            result["error"] = "The calculation is not supported.";
+            return result;
+        }
+
+        const Vector& n = state.speciesAmounts();
+        result["temperature"] = state.temperature();
+        result["pressure"] = state.pressure();
+        result["speciesAmounts"] = std::vector<double>(n.data(), n.data() + n.size());
+
+        // Evaluate the requested quantities at the calculated chemical state
+        if(node.count("quantities"))
+        {
+            ChemicalQuantity quantity(state);
+            json values;
+            for(auto str : node["quantities"])
+                values[str.get<std::string>()] = quantity.value(str);
+            result["quantities"] = values;
+        }
+    }
+    catch(const std::exception& e) {
+        result["error"] = e.what();
+    }
+
+    return result;
+}
+
+/// The chemical systems cached by the server mode of the interpreter.
+/// The chemical systems are keyed by the `database` and `elements` entries of their json specification,
+/// the only ones used to construct them, so that the database parsing and the construction of the system,
+/// including its interpolation tables, happen only once. Any other entry is rejected, rather than ignored.
+class SystemCache
+{
+public:
+    /// A cached chemical system with the idle copies used to execute requests concurrently
+    struct Entry
+    {
+        /// The flag used to construct the chemical system only once
+        std::once_flag created;
+
+        /// The cached chemical system
+        ChemicalSystem system;
+
+        /// The copies of the chemical system not in use by any thread
+        std::vector<ChemicalSystem> idle;
+
+        /// The mutex that protects `idle`, or the system itself if its models are not reentrant
+        std::mutex mutex;
+    };
+
+    /// Return the cache entry of a chemical system defined in a json node, constructing the system if needed.
+    /// @param node The json specification of the chemical system
+    /// @param[out] cached The flag that indicates if the system was already in the cache
+    auto entry(json node, bool& cached) -> std::shared_ptr<Entry>
+    {
+        const std::string name = key(node);
+
+        std::shared_ptr<Entry> res;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& item = entries[name];
+            if(!item) item = std::make_shared<Entry>();
+            res = item;
+        }
+
+        // Construct the system only once, even if requested concurrently (retried if construction fails)
+        cached = true;
+        std::call_once(res->created, [&]()
+        {
+            res->system = createChemicalSystem(database(node["database"].get<std::string>()), node);
+            cached = false;
+        });
+
+        return res;
+    }
+
+    /// Return the result of a function evaluated with a chemical system of a cache entry that no other thread is using.
+    template<typename Function>
+    auto execute(Entry& entry, Function f) -> json
+    {
+        // Serialize the requests if the models of the system cannot be evaluated concurrently
+        if(!entry.system.hasReentrantModels())
+        {
+            std::lock_guard<std::mutex> lock(entry.mutex);
+            return f(entry.system);
+        }
+
+        ChemicalSystem system;
+        {
+            std::lock_guard<std::mutex> lock(entry.mutex);
+            if(entry.idle.empty())
+                system = entry.system.clone();
+            else
+            {
+                system = entry.idle.back();
+                entry.idle.pop_back();
+            }
+        }
+
+        json res = f(system);
+
+        std::lock_guard<std::mutex> lock(entry.mutex);
+        entry.idle.push_back(system);
+
+        return res;
+    }
+
+private:
+    /// Return the key of a chemical system in the cache, after checking its json specification
+    static auto key(const json& node) -> std::string
+    {
+        Assert(node.is_object() && node.count("database") && node.count("elements"),
+            "Could not get the chemical system of the request.",
+            "The `system` entry must be an object with the `database` and `elements` entries.");
+
+        for(auto it = node.begin(); it != node.end(); ++it)
+            Assert(it.key() == "database" || it.key() == "elements",
+                "Could not get the chemical system of the request.",
+                "The entry `" + it.key() + "` of the `system` entry is not supported, "
+                "only `database` and `elements` are.");
+
+        Assert(node["database"].is_string() && node["elements"].is_array(),
+            "Could not get the chemical system of the request.",
+            "The `database` entry must be a string and the `elements` entry an array of element names.");
+
+        json res;
+        res["database"] = node["database"];
+        res["elements"] = node["elements"];
+        return res.dump();
+    }
+
+    /// Return the cached database with given name, parsing it if needed
+    auto database(std::string name) -> Database
+    {
+        std::lock_guard<std::mutex> lock(database_mutex);
+        auto it = databases.find(name);
+        if(it == databases.end())
+            it = databases.insert({name, Database(name)}).first;
+        return it->second;
+    }
+
+    /// The cached chemical systems keyed by the dump of their database and elements
+    std::map<std::string, std::shared_ptr<Entry>> entries;
+
+    /// The cached databases keyed by their names
+    std::map<std::string, Database> databases;
+
+    /// The mutex that protects `entries`
+    std::mutex mutex;
+
+    /// The mutex that protects `databases`
+    std::mutex database_mutex;
+};
+
+} // namespace
 
 struct Interpreter::Impl
 {
@@ -36,6 +268,12 @@ struct Interpreter::Impl
 
     std::map<std::string, ChemicalState> states;
 
+    /// The copies of the chemical system used by the worker threads of the stream execution
+    std::vector<ChemicalSystem> workers;
+
+    /// The chemical systems cached by the server mode (shared by copies of the interpreter)
+    std::shared_ptr<SystemCache> cache = std::make_shared<SystemCache>();
+
     auto execute(json input) -> void
     {
         initializeChemicalSystem(input["system"]);
@@ -52,6 +290,7 @@ struct Interpreter::Impl
         editor.initializePhasesWithElements(elements);
 
         system = ChemicalSystem(editor);
+        workers.clear();
     }
 
     auto executeCalculations(json node) -> void
@@ -65,19 +304,182 @@ struct Interpreter::Impl
 
     auto calculateEquilibrium(json node) -> void
     {
-        EquilibriumProblem problem(system);
-        problem.setTemperature(node["temperature"]["value"], node["temperature"]["units"]);
-        problem.setPressure(node["pressure"]["value"], node["pressure"]["units"]);
-        for(auto item : node["substances"])
-            problem.add(item["substance"], item["quantity"], item["units"]);
+        states.insert({stateReference(node), equilibriumState(system, node)});
+    }
 
-        ChemicalState state = equilibrate(problem);
+    /// Return the json response of a request in the server mode
+    auto request(const std::string& line) const -> json
+    {
+        const Time begin = time();
+
+        json response;
+
+        try {
+            json node = json::parse(line);
+
+            if(node.count("id"))
+                response["id"] = node["id"];
+
+            Assert(node.count("system"), "Could not execute the request.",
+                "The request has no `system` entry with the specification of the chemical system.");
 
-        std::string stateref = "default";
-        if(node.count("stateReference"))
-            stateref = node["stateReference"];
+            // Get the chemical system from the cache, constructing it if needed
+            bool cached = false;
+            const Time begin_system = time();
+            auto entry = cache->entry(node["system"], cached);
+            const double time_system = elapsed(begin_system);
+
+            // Execute the calculation with a chemical system not in use by other requests
+            const Time begin_calculation = time();
+            json result = cache->execute(*entry, [&](const ChemicalSystem& system) { return calculate(system, node); });
+            const double time_calculation = elapsed(begin_calculation);
+
+            response.update(result);
+            response["cached"] = cached;
+            response["time"]["system"] = time_system;
+            response["time"]["calculation"] = time_calculation;
+        }
+        catch(const std::exception& e) {
+            response["error"] = e.what();
+        }
 
-        states.insert({stateref, equilibrate(problem)});
+        response["time"]["total"] = elapsed(begin);
+
+        return response;
+    }
+
+    /// Return the number of threads used to execute a batch of calculations
+    auto numThreads(const InterpreterStreamOptions& options) const -> Index
+    {
+        if(!system.hasReentrantModels())
+            return 1;
+        return options.num_threads ? options.num_threads : std::max<Index>(1, std::thread::hardware_concurrency());
+    }
+
+    auto executeStream(std::istream& input, std::ostream& output, const InterpreterStreamOptions& options) -> void
+    {
+        // The calculations read from the input stream whose results have not been output yet
+        std::vector<json> batch;
+
+        // The index of the next calculation read from the input stream
+        Index index = 0;
+
+        // The number of the current line in the input stream
+        Index lineno = 0;
+
+        // Execute the calculations read so far and output their results
+        auto flush = [&]()
+        {
+            executeBatch(batch, index - batch.size(), output, options);
+            batch.clear();
+        };
+
+        // Add a calculation to the batch, executing the batch once the read-ahead limit is reached
+        auto add = [&](json calculation)
+        {
+            batch.push_back(std::move(calculation));
+            ++index;
+            if(batch.size() >= numThreads(options) * std::max<Index>(1, options.window))
+                flush();
+        };
+
+        std::string line;
+        while(std::getline(input, line))
+        {
+            ++lineno;
+
+            if(trim(line).empty())
+                continue;
+
+            try {
+                json node = json::parse(line);
+
+                // Initialize the chemical system only after all previous calculations are done
+                if(node.count("system"))
+                {
+                    flush();
+                    initializeChemicalSystem(node["system"]);
+
+                    json result;
+                    result["line"] = lineno;
+                    result["species"] = speciesNames();
+                    output << result.dump() << std::endl;
+                }
+
+                if(node.count("calculations"))
+                    for(auto item : node["calculations"])
+                        add(item);
+
+                if(!node.count("system") && !node.count("calculations"))
+                    add(node);
+            }
+            catch(const std::exception& e) {
+                flush();
+                json result;
+                result["line"] = lineno;
+                result["error"] = e.what();
+                output << result.dump() << std::endl;
+            }
+        }
+
+        flush();
+    }
+
+    /// Return the names of the species in the chemical system
+    auto speciesNames() const -> std::vector<std::string>
+    {
+        std::vector<std::string> names;
+        names.reserve(system.numSpecies());
+        for(const auto& species : system.species())
+            names.push_back(species.name());
+        return names;
+    }
+
+    /// Execute a batch of calculations in parallel and output their results in order
+    auto executeBatch(const std::vector<json>& batch, Index offset, std::ostream& output, const InterpreterStreamOptions& options) -> void
+    {
+        const Index num_calculations = batch.size();
+
+        if(num_calculations == 0)
+            return;
+
+        std::vector<json> results(num_calculations);
+
+        // Create the copies of the chemical system used by the workers if needed
+        const Index num_threads = std::min(numThreads(options), num_calculations);
+        while(workers.size() < num_threads)
+            workers.push_back(system.clone());
+
+        // The index of the next calculation to be executed
+        std::atomic<Index> next(0);
+
+        // The function executed by each thread, in which the calculations are executed one at a time.
+        // Errors in a calculation are reported in its result, so that the remaining ones still run.
+        auto run = [&](const ChemicalSystem& worker)
+        {
+            for(Index k = next++; k < num_calculations; k = next++)
+            {
+                results[k] = calculate(worker, batch[k]);
+                results[k]["index"] = offset + k;
+            }
+        };
+
+        // Execute the calculations in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::cref(workers[i]));
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        for(const auto& result : results)
+            output << result.dump() << '\n';
+        output.flush();
     }
 };
 
@@ -118,6 +520,40 @@ auto Interpreter::executeJsonFile(std::string input) -> void
     executeJsonObject(jsoninput);
 }
 
+auto Interpreter::executeJsonStream(std::istream& input, std::ostream& output) -> void
+{
+    executeJsonStream(input, output, {});
+}
+
+auto Interpreter::executeJsonStream(std::istream& input, std::ostream& output, const InterpreterStreamOptions& options) -> void
+{
+    pimpl->executeStream(input, output, options);
+}
+
+auto Interpreter::executeJsonStreamFile(std::string input, std::string output, const InterpreterStreamOptions& options) -> void
+{
+    std::ifstream infile(input, std::ios_base::in);
+    Assert(infile.is_open(), "Could not execute the json stream file `" + input + "`.",
+        "The file could not be opened.");
+    std::ofstream outfile(output, std::ios_base::out | std::ios_base::trunc);
+    Assert(outfile.is_open(), "Could not execute the json stream file `" + input + "`.",
+        "The output file `" + output + "` could not be opened.");
+    executeJsonStream(infile, outfile, options);
+}
+
+auto Interpreter::executeJsonRequest(std::string request) const -> std::string
+{
+    return pimpl->request(request).dump();
+}
+
+auto Interpreter::executeJsonServer(std::istream& input, std::ostream& output) const -> void
+{
+    std::string line;
+    while(std::getline(input, line))
+        if(!trim(line).empty())
+            output << executeJsonRequest(line) << std::endl;
+}
+
 auto Interpreter::system() -> const ChemicalSystem&
 {
     return pimpl->system;
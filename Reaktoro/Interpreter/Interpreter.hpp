@@ -22,8 +22,10 @@
 #include <memory>
 #include <string>
 #include <fstream>
+#include <iostream>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/Json.hpp>
 
 namespace Reaktoro {
@@ -32,6 +34,18 @@ namespace Reaktoro {
 class ChemicalState;
 class ChemicalSystem;
 
+/// The options for the execution of streams of newline-delimited json requests.
+/// @see Interpreter::executeJsonStream
+struct InterpreterStreamOptions
+{
+    /// The number of threads used to execute the calculations (zero to use all hardware threads).
+    /// A single thread is used if the chemical system does not have reentrant models.
+    Index num_threads = 0;
+
+    /// The maximum number of calculations read ahead per thread before their results are output.
+    Index window = 16;
+};
+
 /// Used to interpret json files containing defined calculations.
 class Interpreter
 {
@@ -60,6 +74,53 @@ public:
     /// @param input The name of the json-formatted input file.
     auto executeJsonFile(std::string input) -> void;
 
+    /// Execute a stream of newline-delimited json requests.
+    /// Each line of the input stream is a json object containing either a `system` entry,
+    /// which (re)initializes the chemical system, a single calculation such as `equilibrium`,
+    /// or a `calculations` array. The calculations are executed by a pool of worker threads
+    /// sharing the chemical system, and their results are written to the output stream as
+    /// newline-delimited json objects, in the order the calculations were read. The resulting
+    /// chemical states are not saved, so that memory use does not grow with the input.
+    /// @param input The input stream of newline-delimited json requests.
+    /// @param output The output stream of newline-delimited json results.
+    auto executeJsonStream(std::istream& input, std::ostream& output) -> void;
+
+    /// Execute a stream of newline-delimited json requests.
+    /// @param input The input stream of newline-delimited json requests.
+    /// @param output The output stream of newline-delimited json results.
+    /// @param options The options for the execution of the stream.
+    auto executeJsonStream(std::istream& input, std::ostream& output, const InterpreterStreamOptions& options) -> void;
+
+    /// Execute a file of newline-delimited json requests.
+    /// @param input The name of the input file.
+    /// @param output The name of the output file.
+    /// @param options The options for the execution of the stream.
+    /// @see executeJsonStream
+    auto executeJsonStreamFile(std::string input, std::string output, const InterpreterStreamOptions& options) -> void;
+
+    /// Execute a request in the server mode and return its json response.
+    /// The request is a json object with a `system` entry specifying the chemical system with
+    /// its `database` name and `elements` array (no other entries are supported), and
+    /// either an `equilibrium` entry with the conditions of an equilibrium calculation or a `state`
+    /// entry with the temperature, pressure and species amounts of a given chemical state.
+    /// An optional `quantities` array lists the chemical quantities to be evaluated at the
+    /// resulting state (e.g., `"pH"`, `"speciesMolality(Ca++)"`), and an optional `id` entry
+    /// is echoed in the response. The chemical systems are cached by their specification, so
+    /// that only the first request for a system pays for its construction. The response contains
+    /// the wall times (in units of s) spent getting the system, in the calculation, and in total.
+    /// This method can be called concurrently from many threads.
+    /// @param request The json-formatted request string.
+    /// @return The json-formatted response string.
+    /// @see ChemicalQuantity
+    auto executeJsonRequest(std::string request) const -> std::string;
+
+    /// Execute newline-delimited json requests in the server mode until the input stream ends.
+    /// Each response is written on its own line and flushed as soon as it is ready.
+    /// @param input The input stream of newline-delimited json requests.
+    /// @param output The output stream of newline-delimited json responses.
+    /// @see executeJsonRequest
+    auto executeJsonServer(std::istream& input, std::ostream& output) const -> void;
+
     /// Return the constructed chemical system.
     auto system() -> const ChemicalSystem&;
 
@@ -0,0 +1,266 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KineticBatchSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include <Reaktoro/Kinetics/KineticSolver.hpp>
+#include <Reaktoro/Math/ODE.hpp>
+
+namespace Reaktoro {
+
+struct KineticBatchSolver::Impl
+{
+    /// The kinetic solver and the data used by a thread to integrate a subset of the chemical states.
+    struct Worker
+    {
+        /// The chemical system of the worker
+        ChemicalSystem system;
+
+        /// The reaction system of the worker
+        ReactionSystem reactions;
+
+        /// The kinetic solver of the worker
+        KineticSolver solver;
+
+        /// The accumulated result of the calculations performed by the worker
+        KineticResult result;
+
+        /// Construct a Worker instance with given reaction system
+        Worker(const ChemicalSystem& system, const ReactionSystem& reactions)
+        : system(system), reactions(reactions), solver(this->reactions)
+        {}
+    };
+
+    /// The kinetically-controlled chemical reactions
+    ReactionSystem reactions;
+
+    /// The chemical system instance
+    ChemicalSystem system;
+
+    /// The partition of the species in the chemical system
+    Partition partition;
+
+    /// The options of the batch kinetic solver
+    KineticBatchOptions options;
+
+    /// The number of chemical states
+    Index size = 0;
+
+    /// The ODE integrators of the chemical states, created on their first integration
+    std::vector<std::unique_ptr<ODESolver>> integrators;
+
+    /// The workers that integrate the chemical states, one for each thread
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// The result of the last calculation
+    KineticBatchResult result;
+
+    /// Construct a default Impl instance
+    Impl()
+    {}
+
+    /// Construct an Impl instance with given reaction system
+    Impl(const ReactionSystem& reactions, Index size)
+    : reactions(reactions), system(reactions.system()), partition(system), size(size), integrators(size)
+    {}
+
+    /// Set the options of the batch kinetic solver
+    auto setOptions(const KineticBatchOptions& options_) -> void
+    {
+        options = options_;
+        workers.clear();
+        reset();
+    }
+
+    /// Set the partition of the chemical system
+    auto setPartition(const Partition& partition_) -> void
+    {
+        partition = partition_;
+        workers.clear();
+        reset();
+    }
+
+    /// Discard the memory of the ODE integrators of all chemical states
+    auto reset() -> void
+    {
+        for(auto& integrator : integrators)
+            integrator.reset();
+    }
+
+    /// Return the number of threads used to integrate the chemical states
+    auto numThreads() const -> Index
+    {
+        if(!system.hasReentrantModels())
+            return 1;
+        Index num_threads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, size));
+    }
+
+    /// Create a worker, with its own copy of the chemical system unless it is the first one
+    auto createWorker(bool first) -> std::unique_ptr<Worker>
+    {
+        const ChemicalSystem copy = first ? system : system.clone();
+        std::unique_ptr<Worker> worker(new Worker(copy, first ? reactions : reactions.clone(copy)));
+        worker->solver.setOptions(options.kinetics);
+        worker->solver.setPartition(first ? partition : partition.clone(copy));
+        return worker;
+    }
+
+    /// Solve the chemical kinetics problems of all chemical states
+    auto solve(std::vector<ChemicalState>& states, double t, double dt) -> void
+    {
+        Assert(states.size() == size,
+            "Could not solve the chemical kinetics problems.",
+            "Expecting as many chemical states as the size of the KineticBatchSolver instance.");
+
+        const Time begin = time();
+
+        // Create the workers if needed and reset their results
+        const Index num_threads = numThreads();
+        while(workers.size() < num_threads)
+            workers.push_back(createWorker(workers.empty()));
+        for(auto& worker : workers)
+            worker->result = {};
+
+        result.num_steps.assign(size, 0);
+        result.num_function_evals.assign(size, 0);
+
+        // The index of the next chemical state to be integrated
+        std::atomic<Index> next(0);
+
+        // The first exception thrown by a worker, if any
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        // The function executed by each thread, in which chemical states are integrated one at a time
+        auto run = [&](Worker& worker)
+        {
+            try {
+                for(Index k = next++; k < size; k = next++)
+                {
+                    // Create the ODE integrator of the chemical state on its first integration
+                    if(!integrators[k])
+                    {
+                        integrators[k].reset(new ODESolver());
+                        integrators[k]->setOptions(options.kinetics.ode);
+                    }
+
+                    ODESolver& integrator = *integrators[k];
+
+                    worker.solver.solve(states[k], t, dt, integrator);
+
+                    result.num_steps[k] = integrator.numSteps();
+                    result.num_function_evals[k] = integrator.numFunctionEvals();
+                    worker.result += worker.solver.result();
+                }
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) error = std::current_exception();
+                next = size;
+            }
+        };
+
+        // Integrate the chemical states in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(*workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::ref(*workers[i]));
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        if(error)
+            std::rethrow_exception(error);
+
+        // Accumulate the results of the workers
+        result.total = {};
+        for(auto& worker : workers)
+            result.total += worker->result;
+
+        result.time = elapsed(begin);
+    }
+};
+
+KineticBatchSolver::KineticBatchSolver()
+: pimpl(new Impl())
+{}
+
+KineticBatchSolver::KineticBatchSolver(const ReactionSystem& reactions, Index size)
+: pimpl(new Impl(reactions, size))
+{}
+
+KineticBatchSolver::~KineticBatchSolver()
+{}
+
+auto KineticBatchSolver::operator=(KineticBatchSolver other) -> KineticBatchSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto KineticBatchSolver::setOptions(const KineticBatchOptions& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto KineticBatchSolver::setPartition(const Partition& partition) -> void
+{
+    pimpl->setPartition(partition);
+}
+
+auto KineticBatchSolver::size() const -> Index
+{
+    return pimpl->size;
+}
+
+auto KineticBatchSolver::reset() -> void
+{
+    pimpl->reset();
+}
+
+auto KineticBatchSolver::solve(std::vector<ChemicalState>& states, double t, double dt) -> void
+{
+    pimpl->solve(states, t, dt);
+}
+
+auto KineticBatchSolver::result() const -> const KineticBatchResult&
+{
+    return pimpl->result;
+}
+
+} // namespace Reaktoro
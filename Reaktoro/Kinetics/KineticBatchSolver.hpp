@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class Partition;
+class ReactionSystem;
+struct KineticBatchOptions;
+struct KineticBatchResult;
+
+/// A class that solves the chemical kinetics problems of many independent chemical states.
+/// Each chemical state (e.g., the state of a cell in a reactive transport simulation) keeps its own
+/// ODE integrator, whose memory persists between calls to `KineticBatchSolver::solve`, so that it is
+/// not created again at every time step. The chemical states are distributed dynamically over a pool
+/// of threads, each owning a kinetic solver with its own copy of the chemical system.
+/// @see KineticSolver
+class KineticBatchSolver
+{
+public:
+    /// Construct a default KineticBatchSolver instance.
+    KineticBatchSolver();
+
+    /// Construct a KineticBatchSolver instance.
+    /// @param reactions The kinetically-controlled reactions
+    /// @param size The number of chemical states
+    KineticBatchSolver(const ReactionSystem& reactions, Index size);
+
+    /// Construct a copy of a KineticBatchSolver instance.
+    KineticBatchSolver(const KineticBatchSolver& other) = delete;
+
+    /// Destroy the KineticBatchSolver instance.
+    virtual ~KineticBatchSolver();
+
+    /// Assign a KineticBatchSolver instance to this instance.
+    auto operator=(KineticBatchSolver other) -> KineticBatchSolver&;
+
+    /// Set the options for the chemical kinetics calculations.
+    auto setOptions(const KineticBatchOptions& options) -> void;
+
+    /// Set the partition of the chemical system.
+    /// Use this method to specify the equilibrium, kinetic, and inert species.
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Return the number of chemical states.
+    auto size() const -> Index;
+
+    /// Discard the memory of the ODE integrators of all chemical states.
+    auto reset() -> void;
+
+    /// Solve the chemical kinetics problems of all chemical states from a given initial time to a final time.
+    /// @param states The chemical states, one for each index between zero and `size() - 1`
+    /// @param t The start time of the integration (in units of seconds)
+    /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
+    auto solve(std::vector<ChemicalState>& states, double t, double dt) -> void;
+
+    /// Return the result of the last chemical kinetics calculation.
+    auto result() const -> const KineticBatchResult&;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -30,6 +30,28 @@ struct KineticOutputOptions
     std::string format;
 };
 
+/// The options for the first-order estimates of the equilibrium species in the right-hand side of the kinetic problem.
+/// When active, the equilibrium state `n0` of the last full equilibrium calculation, at the element amounts `be0`, is
+/// used as a reference, and the amounts of equilibrium species at new element amounts `be` are estimated with
+/// `n = n0 + dndb*(be - be0)`. The estimate is accepted if the variation of the ln activities of the equilibrium
+/// species satisfies `|delta(ln(a))| <= abstol + reltol*|ln(a0)|` and no estimated amount is below `-amount_tolerance`.
+/// Otherwise, a full equilibrium calculation is performed and it becomes the new reference state.
+/// @see KineticOptions
+struct KineticSmartEquilibriumOptions
+{
+    /// The boolean flag that activates the first-order estimates of the equilibrium states.
+    bool active = false;
+
+    /// The relative tolerance for the estimated ln activities of the equilibrium species.
+    double reltol = 0.1;
+
+    /// The absolute tolerance for the estimated ln activities of the equilibrium species.
+    double abstol = 1e-2;
+
+    /// The tolerance for negative estimated amounts of the equilibrium species (in units of mol).
+    double amount_tolerance = 1e-10;
+};
+
 /// A struct to describe the options for a chemical kinetics calculation.
 /// @see KineticProblem, KineticSolver
 struct KineticOptions
@@ -40,8 +62,40 @@ struct KineticOptions
     /// The options for the ODE solver.
     ODEOptions ode;
 
+    /// The options for the first-order estimates of the equilibrium states in the right-hand side function.
+    KineticSmartEquilibriumOptions smart;
+
     /// The options for the output of the chemical kinetics calculation
     KineticOutputOptions output;
 };
 
+/// A struct to describe the options for the chemical kinetics calculations of many independent chemical states.
+/// @see KineticBatchSolver
+struct KineticBatchOptions
+{
+    /// The options for the chemical kinetics calculation of each chemical state.
+    KineticOptions kinetics;
+
+    /// The number of threads used to integrate the chemical states (zero for the number of hardware threads).
+    unsigned num_threads = 0;
+};
+
+/// A struct to describe the options for the calculation of kinetic paths.
+/// @see KineticPath
+struct KineticPathOptions
+{
+    /// The options for the chemical kinetics calculation.
+    KineticOptions kinetics;
+
+    /// The time interval between consecutive updates of the output and plots (in units of s).
+    /// The output and plots are updated at every `output_decimation` steps if this is zero.
+    double output_interval = 0.0;
+
+    /// The number of steps between consecutive updates of the output and plots if no output interval is given.
+    unsigned output_decimation = 1;
+
+    /// The number of threads used to solve many kinetic paths at once (zero for the number of hardware threads).
+    unsigned num_threads = 0;
+};
+
 } // namespace Reaktoro
@@ -17,6 +17,14 @@
 
 #include "KineticPath.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Units.hpp>
@@ -27,12 +35,31 @@
 #include <Reaktoro/Core/Partition.hpp>
 #include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 #include <Reaktoro/Kinetics/KineticSolver.hpp>
 
 namespace Reaktoro {
 
 struct KineticPath::Impl
 {
+    /// The kinetic solver used by a thread to solve a subset of many kinetic paths
+    struct Worker
+    {
+        /// The chemical system of the worker
+        ChemicalSystem system;
+
+        /// The reaction system of the worker
+        ReactionSystem reactions;
+
+        /// The kinetic solver of the worker
+        KineticSolver solver;
+
+        /// Construct a Worker instance with given reaction system
+        Worker(const ChemicalSystem& system, const ReactionSystem& reactions)
+        : system(system), reactions(reactions), solver(this->reactions)
+        {}
+    };
+
     /// The kinetically-controlled chemical reactions
     ReactionSystem reactions;
 
@@ -42,11 +69,11 @@ struct KineticPath::Impl
     /// The partition of the species in the chemical system
     Partition partition;
 
-    /// The kinetic solver instance
+    /// The kinetic solver instance, whose integration memory is kept among path calculations
     KineticSolver solver;
 
     /// The options of the kinetic path
-    KineticOptions options;
+    KineticPathOptions options;
 
     /// The output instance of the kinetic path calculation
     ChemicalOutput output;
@@ -54,24 +81,51 @@ struct KineticPath::Impl
     /// The plots of the kinetic path calculation
     std::vector<ChemicalPlot> plots;
 
+    /// The functions that add the sources and sinks to a kinetic solver
+    std::vector<std::function<void(KineticSolver&)>> sources;
+
+    /// The workers used to solve many kinetic paths at once, one for each thread
+    std::vector<std::unique_ptr<Worker>> workers;
+
     Impl(const ReactionSystem& reactions)
-    : reactions(reactions), system(reactions.system()), solver(reactions)
+    : reactions(reactions), system(reactions.system()), partition(system), solver(reactions)
     {
-        solver.setPartition(Partition(system));
+        solver.setPartition(partition);
     }
 
-    auto setOptions(const KineticOptions& options_) -> void
+    auto setOptions(const KineticPathOptions& options_) -> void
     {
         // Initialise the options of the kinetic path
         options = options_;
 
         // Set the options of the kinetic solver
-        solver.setOptions(options);
+        solver.setOptions(options.kinetics);
+
+        workers.clear();
     }
 
-    auto setPartition(const Partition& partition) -> void
+    auto setPartition(const Partition& partition_) -> void
     {
+        partition = partition_;
         solver.setPartition(partition);
+        workers.clear();
+    }
+
+    auto addSource(const std::function<void(KineticSolver&)>& source) -> void
+    {
+        source(solver);
+        sources.push_back(source);
+        workers.clear();
+    }
+
+    /// Update the output and plots with the current state
+    auto update(const ChemicalState& state, double t) -> void
+    {
+        // Update the output with current state
+        if(output) output.update(state, t);
+
+        // Update the plots with current state
+        for(auto& plot : plots) plot.update(state, t);
     }
 
     auto solve(ChemicalState& state, double t0, double t1, std::string units) -> void
@@ -88,23 +142,118 @@ struct KineticPath::Impl
         // Initialize the plots of the equilibrium path calculation
         for(auto& plot : plots) plot.open();
 
+        // The number of steps performed so far and the time of the next output
+        unsigned num_steps = 0;
+        double tout = t0;
+
         while(t < t1)
         {
-            // Update the output with current state
-            if(output) output.update(state, t);
+            // Update the output and plots at fixed time intervals, or every few steps
+            if(options.output_interval > 0.0)
+            {
+                if(t >= tout)
+                {
+                    update(state, t);
+                    while(tout <= t) tout += options.output_interval;
+                }
+
+                // Integrate one time step only, without going over the next output
+                t = solver.step(state, t, std::min(tout, t1));
+            }
+            else
+            {
+                if(num_steps % std::max(options.output_decimation, 1u) == 0)
+                    update(state, t);
+
+                // Integrate one time step only
+                t = solver.step(state, t, t1);
+            }
+
+            ++num_steps;
+        }
+
+        // Update the output and plots with the final state
+        update(state, t1);
+    }
+
+    /// Return the number of threads used to solve many kinetic paths at once
+    auto numThreads(Index num_paths) const -> Index
+    {
+        if(!system.hasReentrantModels())
+            return 1;
+        Index num_threads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, num_paths));
+    }
+
+    /// Create a worker, with its own copy of the chemical system, sources and sinks
+    auto createWorker() const -> std::unique_ptr<Worker>
+    {
+        const ChemicalSystem copy = system.clone();
+        std::unique_ptr<Worker> worker(new Worker(copy, reactions.clone(copy)));
+        worker->solver.setOptions(options.kinetics);
+        worker->solver.setPartition(partition.clone(copy));
+        for(const auto& source : sources)
+            source(worker->solver);
+        return worker;
+    }
+
+    auto solve(std::vector<ChemicalState>& states, double t0, double t1, std::string units) -> std::vector<KineticResult>
+    {
+        t0 = units::convert(t0, units, "s");
+        t1 = units::convert(t1, units, "s");
+
+        const Index num_paths = states.size();
+
+        std::vector<KineticResult> results(num_paths);
+
+        // Create the workers if needed
+        const Index num_threads = numThreads(num_paths);
+        while(workers.size() < num_threads)
+            workers.push_back(createWorker());
+
+        // The index of the next kinetic path to be solved
+        std::atomic<Index> next(0);
 
-            // Update the plots with current state
-            for(auto& plot : plots) plot.update(state, t);
+        // The first exception thrown by a worker, if any
+        std::exception_ptr error;
+        std::mutex error_mutex;
 
-            // Integrate one time step only
-            t = solver.step(state, t, t1);
+        // The function executed by each thread, in which the kinetic paths are solved one at a time
+        auto run = [&](Worker& worker)
+        {
+            try {
+                for(Index k = next++; k < num_paths; k = next++)
+                {
+                    worker.solver.initialize(states[k], t0);
+                    for(double t = t0; t < t1; )
+                        t = worker.solver.step(states[k], t, t1);
+                    results[k] = worker.solver.result();
+                }
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) error = std::current_exception();
+                next = num_paths;
+            }
+        };
+
+        // Solve the kinetic paths in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(*workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::ref(*workers[i]));
+            for(auto& thread : threads)
+                thread.join();
         }
 
-        // Update the output with the final state
-        if(output) output.update(state, t1);
+        if(error)
+            std::rethrow_exception(error);
 
-        // Update the plots with the final state
-        for(auto& plot : plots) plot.update(state, t1);
+        return results;
     }
 };
 
@@ -122,6 +271,13 @@ auto KineticPath::operator=(KineticPath other) -> KineticPath&
 }
 
 auto KineticPath::setOptions(const KineticOptions& options) -> void
+{
+    KineticPathOptions path_options = pimpl->options;
+    path_options.kinetics = options;
+    pimpl->setOptions(path_options);
+}
+
+auto KineticPath::setOptions(const KineticPathOptions& options) -> void
 {
     pimpl->setOptions(options);
 }
@@ -133,22 +289,22 @@ auto KineticPath::setPartition(const Partition& partition) -> void
 
 auto KineticPath::addSource(const ChemicalState& state, double volumerate, std::string units) -> void
 {
-    pimpl->solver.addSource(state, volumerate, units);
+    pimpl->addSource([=](KineticSolver& solver) { solver.addSource(state, volumerate, units); });
 }
 
 auto KineticPath::addPhaseSink(std::string phase, double volumerate, std::string units) -> void
 {
-    pimpl->solver.addPhaseSink(phase, volumerate, units);
+    pimpl->addSource([=](KineticSolver& solver) { solver.addPhaseSink(phase, volumerate, units); });
 }
 
 auto KineticPath::addFluidSink(double volumerate, std::string units) -> void
 {
-    pimpl->solver.addFluidSink(volumerate, units);
+    pimpl->addSource([=](KineticSolver& solver) { solver.addFluidSink(volumerate, units); });
 }
 
 auto KineticPath::addSolidSink(double volumerate, std::string units) -> void
 {
-    pimpl->solver.addSolidSink(volumerate, units);
+    pimpl->addSource([=](KineticSolver& solver) { solver.addSolidSink(volumerate, units); });
 }
 
 auto KineticPath::solve(ChemicalState& state, double t0, double t1, std::string units) -> void
@@ -156,6 +312,16 @@ auto KineticPath::solve(ChemicalState& state, double t0, double t1, std::string
     pimpl->solve(state, t0, t1, units);
 }
 
+auto KineticPath::solve(std::vector<ChemicalState>& states, double t0, double t1, std::string units) -> std::vector<KineticResult>
+{
+    return pimpl->solve(states, t0, t1, units);
+}
+
+auto KineticPath::result() const -> const KineticResult&
+{
+    return pimpl->solver.result();
+}
+
 auto KineticPath::output() -> ChemicalOutput
 {
     pimpl->output = ChemicalOutput(pimpl->reactions);
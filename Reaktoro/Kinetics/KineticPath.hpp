@@ -33,6 +33,8 @@ class ChemicalState;
 class Partition;
 class ReactionSystem;
 struct KineticOptions;
+struct KineticPathOptions;
+struct KineticResult;
 
 /// A class that conveniently solves kinetic path calculations.
 class KineticPath
@@ -53,6 +55,9 @@ public:
     /// Set the options for the chemical kinetics calculation.
     auto setOptions(const KineticOptions& options) -> void;
 
+    /// Set the options for the kinetic path calculation, including those of the output sampling.
+    auto setOptions(const KineticPathOptions& options) -> void;
+
     /// Set the partition of the chemical system.
     /// Use this method to specify the equilibrium, kinetic, and inert species.
     auto setPartition(const Partition& partition) -> void;
@@ -92,6 +97,19 @@ public:
     /// @param units The time units of `t0` and `t1` (e.g., `s`, `minute`, `day`, `year`, etc.).
     auto solve(ChemicalState& state, double t0, double t1, std::string units = "s") -> void;
 
+    /// Solve many independent kinetic paths in parallel.
+    /// The chemical states are distributed among threads, each with its own copy of the chemical
+    /// system and kinetic solver, and the output and plots are not updated during the calculation.
+    /// @param[in,out] states The initial states of the paths as input, their final states as output
+    /// @param t0 The initial time of the kinetic paths
+    /// @param t1 The final time of the kinetic paths
+    /// @param units The time units of `t0` and `t1` (e.g., `s`, `minute`, `day`, `year`, etc.).
+    /// @return The results of the kinetic path calculations
+    auto solve(std::vector<ChemicalState>& states, double t0, double t1, std::string units = "s") -> std::vector<KineticResult>;
+
+    /// Return the result of the last kinetic path calculation.
+    auto result() const -> const KineticResult&;
+
     /// Return a ChemicalPlot instance.
     /// The returned ChemicalOutput instance must be properly configured
     /// before the method EquilibriumPath::solve is called.
@@ -15,14 +15,29 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
-#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include "KineticResult.hpp"
 
 namespace Reaktoro {
 
-KineticResult::KineticResult()
+auto KineticSmartEquilibriumResult::operator+=(const KineticSmartEquilibriumResult& other) -> KineticSmartEquilibriumResult&
 {
-	// TODO Auto-generated constructor stub
+    num_estimates                += other.num_estimates;
+    num_accepted                 += other.num_accepted;
+    num_equilibrium_calculations += other.num_equilibrium_calculations;
+    time_estimate                += other.time_estimate;
+    time_equilibrium             += other.time_equilibrium;
 
+    return *this;
+}
+
+auto KineticResult::operator+=(const KineticResult& other) -> KineticResult&
+{
+    num_function_evals += other.num_function_evals;
+    num_jacobian_evals += other.num_jacobian_evals;
+    smart              += other.smart;
+    equilibrium        += other.equilibrium;
+
+    return *this;
 }
 
 } // namespace Reaktoro
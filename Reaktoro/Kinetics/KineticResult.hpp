@@ -17,12 +17,72 @@
 
 #pragma once
 
+// C++ includes
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+
 namespace Reaktoro {
 
-class KineticResult
+/// A type used to describe the counters of the first-order estimates of the equilibrium states.
+/// @see KineticSmartEquilibriumOptions
+struct KineticSmartEquilibriumResult
+{
+    /// The number of first-order estimates of the equilibrium states that were attempted
+    unsigned num_estimates = 0;
+
+    /// The number of first-order estimates of the equilibrium states that passed the acceptance test
+    unsigned num_accepted = 0;
+
+    /// The number of full equilibrium calculations performed in the right-hand side function
+    unsigned num_equilibrium_calculations = 0;
+
+    /// The wall time spent for the first-order estimates, including the rejected ones (in units of s)
+    double time_estimate = 0;
+
+    /// The wall time spent for the full equilibrium calculations and their sensitivities (in units of s)
+    double time_equilibrium = 0;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const KineticSmartEquilibriumResult& other) -> KineticSmartEquilibriumResult&;
+};
+
+/// A type used to describe the result of a chemical kinetics calculation.
+/// @see KineticSolver
+struct KineticResult
 {
-public:
-	KineticResult();
+    /// The number of evaluations of the right-hand side function of the kinetic problem
+    unsigned num_function_evals = 0;
+
+    /// The number of evaluations of the Jacobian matrix of the kinetic problem
+    unsigned num_jacobian_evals = 0;
+
+    /// The counters of the first-order estimates of the equilibrium states
+    KineticSmartEquilibriumResult smart;
+
+    /// The accumulated results of the full equilibrium calculations
+    EquilibriumResult equilibrium;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const KineticResult& other) -> KineticResult&;
+};
+
+/// A type used to describe the result of the chemical kinetics calculations of many independent chemical states.
+/// @see KineticBatchSolver
+struct KineticBatchResult
+{
+    /// The number of steps taken by the ODE solver for each chemical state in the last calculation
+    std::vector<unsigned> num_steps;
+
+    /// The number of evaluations of the right-hand side function for each chemical state in the last calculation
+    std::vector<unsigned> num_function_evals;
+
+    /// The accumulated results of the chemical kinetics calculations of all chemical states in the last calculation
+    KineticResult total;
+
+    /// The wall time spent in the last calculation (in units of s)
+    double time = 0;
 };
 
 } // namespace Reaktoro
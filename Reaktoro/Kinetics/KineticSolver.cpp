@@ -24,8 +24,10 @@ using namespace std::placeholders;
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -38,9 +40,28 @@ using namespace std::placeholders;
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Kinetics/KineticProblem.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// A sink that drains the species of some phases at a volumetric rate.
+/// A sink whose phases have no volume (e.g., all of them have been depleted)
+/// has nothing left to drain and contributes nothing to the source rates.
+struct KineticSink
+{
+    /// The volumetric rate of the sink (in units of m3/s)
+    double volumerate = 0.0;
+
+    /// The indices of the drained phases
+    Indices iphases;
+
+    /// The indices of the species in the drained phases
+    Indices ispecies;
+};
+
+} // namespace
 
 struct KineticSolver::Impl
 {
@@ -125,14 +146,47 @@ struct KineticSolver::Impl
     /// The partial derivatives of the source rates `q` w.r.t. to `be`, `ne`, `nk`, `and `u = [be nk]`
     Matrix dqdbe, dqdne, dqdnk, dqdu;
 
-    /// The function that calculates the source term in the problem
-    std::function<ChemicalVector(const ChemicalProperties&)> source_fn;
+    /// The boolean flag that indicates if sources or sinks were added to the problem
+    bool has_sources = false;
+
+    /// The combined molar rates of the species from all sources (in units of mol/s)
+    Vector qsources;
+
+    /// The sinks that drain the species of some phases in the problem
+    std::vector<KineticSink> sinks;
+
+    /// The indices of the species drained by any of the sinks
+    Indices isinks;
+
+    /// The volumes of the phases used in the evaluation of the sinks
+    ChemicalVector phase_volumes;
+
+    /// The derivatives of the volume drained by a sink w.r.t. the amounts of the species
+    Vector dVdn;
+
+    /// The result of the chemical kinetics calculation since the last initialization
+    KineticResult result;
+
+    /// The boolean flag that indicates if the reference equilibrium state for the first-order estimates is valid
+    bool reference_valid = false;
+
+    /// The element amounts and the amounts of equilibrium species of the reference equilibrium state
+    Vector be0, ne0;
+
+    /// The ln activities of the equilibrium species of the reference equilibrium state
+    Vector lna0;
+
+    /// The derivatives of the ln activities of the equilibrium species w.r.t. their amounts in the reference state
+    Matrix dlnadne0;
+
+    /// The auxiliary vectors used in the first-order estimates of the equilibrium states
+    Vector dne, delta_lna;
 
     Impl()
     {}
 
     Impl(const ReactionSystem& reactions)
-    : reactions(reactions), system(reactions.system()), equilibrium(system)
+    : reactions(reactions), system(reactions.system()), equilibrium(system), properties(system)
     {
         setPartition(Partition(system));
     }
@@ -141,6 +195,9 @@ struct KineticSolver::Impl
     {
         // Initialise the options of the kinetic solver
         options = options_;
+
+        // Set the options of the ODE solver, which discards its integration memory
+        ode.setOptions(options.ode);
     }
 
     auto setPartition(const Partition& partition_) -> void
@@ -196,90 +253,118 @@ struct KineticSolver::Impl
 
         // Allocate memory for the partial derivatives of the source rates `q` w.r.t. to `u = [be nk]`
         dqdu.resize(system.numSpecies(), Ee + Nk);
+
+        // The reference equilibrium state is no longer consistent with the partition
+        reference_valid = false;
     }
 
-    auto addSource(ChemicalState state, double volumerate, std::string units) -> void
+    auto initializeSources() -> void
     {
+        // Allocate the source rates and their derivatives once for all sources and sinks
+        if(has_sources) return;
         const Index num_species = system.numSpecies();
+        qsources = zeros(num_species);
+        q = ChemicalVector(num_species);
+        dVdn = zeros(num_species);
+        has_sources = true;
+    }
+
+    auto addSource(ChemicalState state, double volumerate, std::string units) -> void
+    {
+        initializeSources();
         const double volume = units::convert(volumerate, units, "m3/s");
         state.scaleVolume(volume);
-        const Vector n = state.speciesAmounts();
-        auto old_source_fn = source_fn;
+        qsources += state.speciesAmounts();
+    }
 
-        source_fn = [=](const ChemicalProperties& properties)
-        {
-            ChemicalVector q(num_species);
-            q.val = n;
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+    auto addSink(const Indices& iphases, double volumerate, std::string units) -> void
+    {
+        initializeSources();
+        KineticSink sink;
+        sink.volumerate = units::convert(volumerate, units, "m3/s");
+        sink.iphases = iphases;
+        sink.ispecies = system.indicesSpeciesInPhases(iphases);
+        isinks = unify(isinks, sink.ispecies);
+        sinks.push_back(sink);
     }
 
     auto addPhaseSink(std::string phase, double volumerate, std::string units) -> void
     {
-        const double volume = units::convert(volumerate, units, "m3/s");
-        const Index iphase = system.indexPhaseWithError(phase);
-        const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
-        const Index size = system.numSpeciesInPhase(iphase);
-        auto old_source_fn = source_fn;
-        ChemicalScalar phasevolume;
-        ChemicalVector q(size);
-
-        source_fn = [=](const ChemicalProperties& properties) mutable
-        {
-            const auto n = properties.composition();
-            const auto np = rows(n, ifirst, size);
-            auto qp = rows(q, ifirst, size);
-            phasevolume = properties.phaseVolumes()[iphase];
-            qp = -volume*np/phasevolume;
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+        addSink({system.indexPhaseWithError(phase)}, volumerate, units);
     }
 
     auto addFluidSink(double volumerate, std::string units) -> void
     {
-        const double volume = units::convert(volumerate, units, "m3/s");
-        const Indices& isolid_species = partition.indicesSolidSpecies();
-        auto old_source_fn = source_fn;
-        ChemicalScalar fluidvolume;
-        ChemicalVector q;
-
-        source_fn = [=](const ChemicalProperties& properties) mutable
-        {
-            const auto n = properties.composition();
-            fluidvolume = properties.fluidVolume();
-            q = -volume*n/fluidvolume;
-            rows(q, isolid_species).fill(0.0);
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+        addSink(partition.indicesFluidPhases(), volumerate, units);
     }
 
     auto addSolidSink(double volumerate, std::string units) -> void
     {
-        const double volume = units::convert(volumerate, units, "m3/s");
-        const Indices& ifluid_species = partition.indicesFluidSpecies();
-        auto old_source_fn = source_fn;
-        ChemicalScalar solidvolume;
-        ChemicalVector q;
+        addSink(partition.indicesSolidPhases(), volumerate, units);
+    }
 
-        source_fn = [=](const ChemicalProperties& properties) mutable
+    /// Calculate the source rates `q` of all sources and sinks in place
+    auto updateSources(const ChemicalProperties& properties) -> void
+    {
+        // Start with the constant contribution of the sources
+        q.val = qsources;
+        q.ddT.fill(0.0);
+        q.ddP.fill(0.0);
+
+        if(sinks.empty())
+            return;
+
+        // Only the rows and columns of the drained species have non-zero molar derivatives
+        submatrix(q.ddn, isinks, isinks).fill(0.0);
+
+        // The amounts of the species and the volumes of the phases
+        VectorConstRef n = properties.composition().val;
+        phase_volumes = properties.phaseVolumes();
+
+        // Accumulate the contribution `-volumerate * ni/V` of each sink, where V is the drained volume
+        for(const KineticSink& sink : sinks)
         {
-            const auto n = properties.composition();
-            solidvolume = properties.solidVolume();
-            q = -volume*n/solidvolume;
-            rows(q, ifluid_species).fill(0.0);
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+            double V = 0.0, dVdT = 0.0, dVdP = 0.0;
+            for(Index iphase : sink.iphases)
+            {
+                V += phase_volumes.val[iphase];
+                dVdT += phase_volumes.ddT[iphase];
+                dVdP += phase_volumes.ddP[iphase];
+            }
+
+            // Skip the sink if its phases have no volume (see KineticSink)
+            if(V <= 0.0) continue;
+
+            // The volume of the phases depends only on the amounts of their species
+            for(Index j : sink.ispecies)
+            {
+                dVdn[j] = 0.0;
+                for(Index iphase : sink.iphases)
+                    dVdn[j] += phase_volumes.ddn(iphase, j);
+            }
+
+            const double c = sink.volumerate/V;
+
+            for(Index i : sink.ispecies)
+            {
+                const double qi = -c * n[i];
+                q.val[i] += qi;
+                q.ddT[i] -= qi/V * dVdT;
+                q.ddP[i] -= qi/V * dVdP;
+                q.ddn(i, i) -= c;
+                for(Index j : sink.ispecies)
+                    q.ddn(i, j) -= qi/V * dVdn[j];
+            }
+        }
     }
 
     auto initialize(ChemicalState& state, double tstart) -> void
+    {
+        // Reuse the integration memory of the ODE solver from a previous initialization if possible
+        initialize(state, tstart, ode);
+    }
+
+    auto initialize(ChemicalState& state, double tstart, ODESolver& integrator) -> void
     {
         // Initialise the temperature and pressure variables
         T = state.temperature();
@@ -313,16 +398,22 @@ struct KineticSolver::Impl
         problem.setFunction(ode_function);
         problem.setJacobian(ode_jacobian);
 
-        // Define the options for the ODE solver
-        ODEOptions options_ode = options.ode;
-
-        // Set the ODE problem and initialize the ODE solver
-        ode.setProblem(problem);
-        ode.setOptions(options_ode);
-        ode.initialize(tstart, benk);
-
-        // Set the options of the equilibrium solver
-        equilibrium.setOptions(options.equilibrium);
+        // Set the ODE problem and initialize the ODE solver, reusing its memory if possible
+        integrator.setProblem(problem);
+        integrator.reinitialize(tstart, benk);
+
+        // Set the options of the equilibrium solver, using a cold-start as fallback for
+        // failed equilibrium calculations if no retry stage has been configured
+        EquilibriumOptions options_equilibrium = options.equilibrium;
+        auto& retry = options_equilibrium.retry;
+        if(!retry.warmrestart.max_iterations && !retry.alternative.max_iterations && !retry.coldstart.max_iterations)
+            retry.coldstart.max_iterations = options_equilibrium.optimum.max_iterations;
+        equilibrium.setOptions(options_equilibrium);
+
+        // Reset the result of the calculation and the reference state of the first-order estimates,
+        // since temperature and pressure may have changed since the last initialization
+        result = {};
+        reference_valid = false;
     }
 
     auto step(ChemicalState& state, double t) -> double
@@ -354,7 +445,7 @@ struct KineticSolver::Impl
         state.setSpeciesAmounts(nk, iks);
 
         // Update the composition of the equilibrium species
-        equilibrium.solve(state, T, P, be);
+        result.equilibrium += equilibrium.solve(state, T, P, be);
 
         return t;
     }
@@ -375,7 +466,26 @@ struct KineticSolver::Impl
         state.setSpeciesAmounts(nk, iks);
 
         // Update the composition of the equilibrium species
-        equilibrium.solve(state, T, P, be);
+        result.equilibrium += equilibrium.solve(state, T, P, be);
+    }
+
+    auto solve(ChemicalState& state, double t, double dt, ODESolver& integrator) -> void
+    {
+        // Initialise the chemical kinetics solver, reusing the memory of the given ODE solver
+        initialize(state, t, integrator);
+
+        // Integrate the chemical kinetics ODE from `t` to `t + dt`
+        integrator.advance(t, t + dt, benk);
+
+        // Extract the `be` and `nk` entries of the vector `benk`
+        be = benk.head(Ee);
+        nk = benk.tail(Nk);
+
+        // Update the composition of the kinetic species
+        state.setSpeciesAmounts(nk, iks);
+
+        // Update the composition of the equilibrium species
+        result.equilibrium += equilibrium.solve(state, T, P, be);
     }
 
     auto function(ChemicalState& state, double t, VectorConstRef u, VectorRef res) -> int
@@ -389,26 +499,15 @@ struct KineticSolver::Impl
             if(!std::isfinite(u[i]))
                 return 1; // ensure the ode solver will reduce the time step
 
+        result.num_function_evals += 1;
+
         // Update the composition of the kinetic species in the member `state`
         state.setSpeciesAmounts(nk, iks);
 
-        // Solve the equilibrium problem using the elemental molar abundance `be`
-        auto result = equilibrium.solve(state, T, P, be);
-
-        // Check if the calculation failed, if so, use cold-start
-        if(!result.optimum.succeeded)
-        {
-            state.setSpeciesAmounts(0.0);
-            result = equilibrium.solve(state, T, P, be);
-        }
-
-        // Assert the equilibrium calculation did not fail
-        Assert(result.optimum.succeeded,
-            "Could not calculate the rates of the species.",
-            "The equilibrium calculation failed.");
-
-        // Update the chemical properties of the system
-        properties = state.properties();
+        // Update the composition of the equilibrium species and the chemical properties of the system,
+        // with a first-order estimate if possible or with a full equilibrium calculation otherwise
+        if(!options.smart.active || !estimate(state))
+            equilibrate(state);
 
         // Calculate the kinetic rates of the reactions
         r = reactions.rates(properties);
@@ -417,10 +516,10 @@ struct KineticSolver::Impl
         res = A * r.val;
 
         // Add the function contribution from the source rates
-        if(source_fn)
+        if(has_sources)
         {
-            // Evaluate the source function
-            q = source_fn(properties);
+            // Evaluate the source rates of the sources and sinks
+            updateSources(properties);
 
             // Add the contribution of the source rates
             res += B * q.val;
@@ -429,10 +528,89 @@ struct KineticSolver::Impl
         return 0;
     }
 
+    auto equilibrate(ChemicalState& state) -> void
+    {
+        const Time begin = time();
+
+        // Solve the equilibrium problem using the elemental molar abundance `be`
+        // (failed calculations are retried according to options.equilibrium.retry)
+        auto res = equilibrium.solve(state, T, P, be);
+
+        result.equilibrium += res;
+
+        // Assert the equilibrium calculation did not fail
+        Assert(res.optimum.succeeded,
+            "Could not calculate the rates of the species.",
+            "The equilibrium calculation failed.");
+
+        // Update the chemical properties of the system (using the system of this solver,
+        // not the one of the state, which may be shared with other threads)
+        properties.update(T, P, state.speciesAmounts());
+
+        // Store the new equilibrium state as the reference state of the first-order estimates
+        if(options.smart.active)
+        {
+            sensitivity = equilibrium.sensitivity();
+            be0 = be;
+            ne0 = state.speciesAmounts()(ies);
+            lna0 = properties.lnActivities().val(ies);
+            dlnadne0 = submatrix(properties.lnActivities().ddn, ies, ies);
+            reference_valid = true;
+
+            result.smart.num_equilibrium_calculations += 1;
+            result.smart.time_equilibrium += elapsed(begin);
+        }
+    }
+
+    auto estimate(ChemicalState& state) -> bool
+    {
+        if(!reference_valid)
+            return false;
+
+        const Time begin = time();
+
+        result.smart.num_estimates += 1;
+
+        // Calculate the first-order estimate of the amounts of equilibrium species
+        dne.noalias() = sensitivity.dndb * (be - be0);
+        ne.noalias() = ne0 + dne;
+
+        // Calculate the first-order variation of the ln activities of the equilibrium species
+        delta_lna.noalias() = dlnadne0 * dne;
+
+        // The estimated ln activities must not be too far away from the reference ones
+        const auto reltol = options.smart.reltol;
+        const auto abstol = options.smart.abstol;
+        const bool variation_check = (delta_lna.array().abs() <= abstol + reltol * lna0.array().abs()).all();
+
+        // The estimated amounts of the equilibrium species must not be significantly negative
+        const bool amount_check = Ne == 0 || ne.minCoeff() > -options.smart.amount_tolerance;
+
+        if(!variation_check || !amount_check)
+        {
+            result.smart.time_estimate += elapsed(begin);
+            return false;
+        }
+
+        // Update the composition of the equilibrium species and the chemical properties of the system
+        ne.noalias() = abs(ne);
+        state.setSpeciesAmounts(ne, ies);
+        properties.update(T, P, state.speciesAmounts());
+
+        result.smart.num_accepted += 1;
+        result.smart.time_estimate += elapsed(begin);
+
+        return true;
+    }
+
     auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
     {
-        // Calculate the sensitivity of the equilibrium state
-        sensitivity = equilibrium.sensitivity();
+        result.num_jacobian_evals += 1;
+
+        // Calculate the sensitivity of the equilibrium state, unless it is
+        // already available from the reference state of the first-order estimates
+        if(!options.smart.active)
+            sensitivity = equilibrium.sensitivity();
 
         // Extract the columns of the kinetic rates derivatives w.r.t. the equilibrium and kinetic species
         drdne = cols(r.ddn, ies);
@@ -448,7 +626,7 @@ struct KineticSolver::Impl
         res = A * drdu;
 
         // Add the Jacobian contribution from the source rates
-        if(source_fn)
+        if(has_sources)
         {
             // Extract the columns of the source rates derivatives w.r.t. the equilibrium and kinetic species
             dqdne = cols(q.ddn, ies);
@@ -515,6 +693,14 @@ auto KineticSolver::addSolidSink(double volumerate, std::string units) -> void
     pimpl->addSolidSink(volumerate, units);
 }
 
+auto KineticSolver::sourceRates(const ChemicalProperties& properties) -> ChemicalVector
+{
+    if(!pimpl->has_sources)
+        return ChemicalVector(pimpl->system.numSpecies());
+    pimpl->updateSources(properties);
+    return pimpl->q;
+}
+
 auto KineticSolver::initialize(ChemicalState& state, double tstart) -> void
 {
     pimpl->initialize(state, tstart);
@@ -535,4 +721,24 @@ auto KineticSolver::solve(ChemicalState& state, double t, double dt) -> void
     pimpl->solve(state, t, dt);
 }
 
+auto KineticSolver::solve(ChemicalState& state, double t, double dt, ODESolver& ode) -> void
+{
+    pimpl->solve(state, t, dt, ode);
+}
+
+auto KineticSolver::properties() const -> const ChemicalProperties&
+{
+    return pimpl->equilibrium.properties();
+}
+
+auto KineticSolver::sensitivity() -> const EquilibriumSensitivity&
+{
+    return pimpl->equilibrium.sensitivity();
+}
+
+auto KineticSolver::result() const -> const KineticResult&
+{
+    return pimpl->result;
+}
+
 } // namespace Reaktoro
@@ -21,14 +21,20 @@
 #include <memory>
 #include <string>
 
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalVector.hpp>
+
 namespace Reaktoro {
 
 // Forward declarations
+class ChemicalProperties;
 class ChemicalState;
-class ChemicalState;
+class ODESolver;
 class Partition;
 class ReactionSystem;
+struct EquilibriumSensitivity;
 struct KineticOptions;
+struct KineticResult;
 
 /// A class that represents a solver for chemical kinetics problems.
 /// @see KineticProblem
@@ -85,6 +91,11 @@ public:
     /// @param units The units of the volumetric rate (compatible with m3/s).
     auto addSolidSink(double volumerate, std::string units) -> void;
 
+    /// Calculate the molar rates of the species from all sources and sinks.
+    /// @param properties The chemical properties of the system
+    /// @return The source rates and their partial derivatives (in units of mol/s)
+    auto sourceRates(const ChemicalProperties& properties) -> ChemicalVector;
+
     /// Initialize the chemical kinetics solver before .
     /// This method should be invoked whenever the user intends to make a call to `KineticsSolver::step`.
     /// @param state The state of the chemical system
@@ -110,6 +121,27 @@ public:
     /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
     auto solve(ChemicalState& state, double t, double dt) -> void;
 
+    /// Solve the chemical kinetics problem from a given initial time to a final time using a given ODE solver.
+    /// The integration memory of the ODE solver is reused if it was already initialized for a problem of the
+    /// same size, which avoids its re-creation when the same chemical state is integrated repeatedly
+    /// (e.g., the state of a cell in a reactive transport simulation). The options of the ODE solver
+    /// must have been set to those used for the chemical kinetics calculation.
+    /// @param state The kinetic state of the system
+    /// @param t The start time of the integration (in units of seconds)
+    /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
+    /// @param ode The ODE solver with the integration memory of the chemical state
+    auto solve(ChemicalState& state, double t, double dt, ODESolver& ode) -> void;
+
+    /// Return the chemical properties of the chemical state at the end of the last chemical kinetics calculation.
+    auto properties() const -> const ChemicalProperties&;
+
+    /// Return the sensitivity of the equilibrium state at the end of the last chemical kinetics calculation.
+    /// The sensitivity is calculated from the final equilibrium calculation, without solving it again.
+    auto sensitivity() -> const EquilibriumSensitivity&;
+
+    /// Return the result of the chemical kinetics calculation since the last initialization.
+    auto result() const -> const KineticResult&;
+
 private:
     struct Impl;
 
@@ -17,9 +17,18 @@
 
 #include "ODE.hpp"
 
+// C++ includes
+#include <algorithm>
+
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/SparseLU>
+
 // Sundials includes
 #include <cvode/cvode.h>
+#include <cvode/cvode_band.h>
 #include <cvode/cvode_dense.h>
+#include <cvode/cvode_spbcgs.h>
+#include <cvode/cvode_spgmr.h>
 #include <nvector/nvector_serial.h>
 
 // Reaktoro includes
@@ -29,6 +38,7 @@ namespace Reaktoro {
 
 #define VecEntry(v, i)    NV_Ith_S(v, i)
 #define MatEntry(A, i, j) DENSE_ELEM(A, i, j)
+#define BandEntry(A, i, j) BAND_ELEM(A, i, j)
 
 #define CheckInitialize(r) \
     Assert(r == CV_SUCCESS, \
@@ -48,17 +58,42 @@ inline int CVODEMaxStepOrder(const ODEOptions& options);
 
 int CVODEFunction(realtype t, N_Vector y, N_Vector ydot, void* user_data);
 int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEJacobianBand(long int N, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEPreconditionerSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEPreconditionerSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp);
+int CVODESparseSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODESparseSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp);
+
+/// The auxiliary data used by the band, Krylov and sparse linear solvers.
+struct ODELinearData
+{
+    /// The auxiliary matrix for the Jacobian evaluation in band format
+    Matrix Jb;
+
+    /// The auxiliary matrix for the Jacobian evaluation in sparse format
+    SparseMatrix Js;
+
+    /// The identity matrix and the iteration matrix `I - gamma*J` in sparse format
+    SparseMatrix I, M;
+
+    /// The sparse LU factorization of the iteration matrix
+    Eigen::SparseLU<SparseMatrix> lu;
+
+    /// The boolean flag that indicates if the sparse Jacobian has been evaluated and can be reused
+    bool jacobian_available = false;
+};
 
 struct ODEData
 {
-    ODEData(const ODEProblem& problem, VectorRef y, VectorRef f, MatrixRef J)
-    : problem(problem), y(y), f(f), J(J), num_equations(problem.numEquations())
+    ODEData(const ODEProblem& problem, VectorRef y, VectorRef f, MatrixRef J, ODELinearData& linear)
+    : problem(problem), y(y), f(f), J(J), linear(linear), num_equations(problem.numEquations())
     {}
 
     const ODEProblem& problem;
     VectorRef y;
     VectorRef f;
     MatrixRef J;
+    ODELinearData& linear;
     int num_equations;
 };
 
@@ -72,6 +107,18 @@ struct ODEProblem::Impl
 
     /// The Jacobian of the right-hand side function of the system of ordinary differential equations
     ODEJacobian ode_jacobian;
+
+    /// The Jacobian of the right-hand side function in sparse format
+    ODEJacobianSparse ode_jacobian_sparse;
+
+    /// The Jacobian of the right-hand side function in band format
+    ODEJacobianBand ode_jacobian_band;
+
+    /// The function that prepares the preconditioner of the Krylov linear solvers
+    ODEPreconditionerSetup preconditioner_setup;
+
+    /// The function that solves a linear system with the preconditioner of the Krylov linear solvers
+    ODEPreconditionerSolve preconditioner_solve;
 };
 
 struct ODESolver::Impl
@@ -97,6 +144,12 @@ struct ODESolver::Impl
     /// The auxiliary matrix J for the Jacobian evaluation
     Matrix J;
 
+    /// The auxiliary data of the band, Krylov and sparse linear solvers
+    ODELinearData linear;
+
+    /// The boolean flag that indicates if the cvode context can be reused for a new integration
+    bool reusable = false;
+
     /// Construct a default ODESolver::Impl instance
     Impl()
     : cvode_mem(0), cvode_y(0)
@@ -156,16 +209,6 @@ struct ODESolver::Impl
         // Initialize the cvode context
         CheckInitialize(CVodeInit(cvode_mem, CVODEFunction, tstart, cvode_y));
 
-        // Initialize the vector of absolute tolerances
-        N_Vector abstols = N_VNew_Serial(num_equations);
-
-        if(options.abstols.size() == num_equations)
-            for(int i = 0; i < num_equations; ++i)
-                VecEntry(abstols, i) = options.abstols[i];
-        else
-            for(int i = 0; i < num_equations; ++i)
-                VecEntry(abstols, i) = options.abstol;
-
         // Set the parameters for the calculation
         CheckInitialize(CVodeSetStabLimDet(cvode_mem, options.stability_limit_detection));
         CheckInitialize(CVodeSetInitStep(cvode_mem, options.initial_step));
@@ -178,23 +221,144 @@ struct ODESolver::Impl
         CheckInitialize(CVodeSetMaxNonlinIters(cvode_mem, int(options.max_num_nonlinear_iterations)));
         CheckInitialize(CVodeSetMaxConvFails(cvode_mem, int(options.max_num_convergence_failures)));
         CheckInitialize(CVodeSetNonlinConvCoef(cvode_mem, options.nonlinear_convergence_coefficient));
-        CheckInitialize(CVodeSVtolerances(cvode_mem, options.reltol, abstols));
 
-        // Call CVDense to specify the CVDENSE dense linear solver
-        CheckInitialize(CVDense(cvode_mem, num_equations));
+        // Set the relative and absolute tolerances
+        initializeTolerances();
+
+        // Attach the linear solver used in the Newton iterations
+        initializeLinearSolver();
+
+        // The cvode context can now be reused while the options remain the same
+        reusable = true;
+    }
+
+    /// Set the relative and absolute tolerances in the cvode context
+    auto initializeTolerances() -> void
+    {
+        // The number of differential equations
+        const int num_equations = problem.numEquations();
+
+        // Initialize the vector of absolute tolerances
+        N_Vector abstols = N_VNew_Serial(num_equations);
+
+        if(options.abstols.size() == num_equations)
+            for(int i = 0; i < num_equations; ++i)
+                VecEntry(abstols, i) = options.abstols[i];
+        else
+            for(int i = 0; i < num_equations; ++i)
+                VecEntry(abstols, i) = options.abstol;
 
-        // Set the Jacobian function
-        CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
+        CheckInitialize(CVodeSVtolerances(cvode_mem, options.reltol, abstols));
 
-        // Free dynamic memory allocated for `yc`
+        // Free dynamic memory allocated for `abstols`
         N_VDestroy_Serial(abstols);
     }
 
+    /// Reinitializes the ODE solver reusing its integration memory if possible
+    auto reinitialize(double tstart, VectorConstRef y) -> void
+    {
+        // Initialize a new cvode context if the current one cannot be reused
+        if(!cvode_mem || !reusable || y.size() != NV_LENGTH_S(cvode_y) || problem.numEquations() != y.size())
+            return initialize(tstart, y);
+
+        // Reset the initial values in the existing vector y
+        for(int i = 0; i < y.size(); ++i)
+            VecEntry(cvode_y, i) = y[i];
+
+        // Reinitialize the cvode context, keeping its memory and linear solver
+        CheckInitialize(CVodeReInit(cvode_mem, tstart, cvode_y));
+
+        // Set the tolerances, which may have changed since the last initialization
+        initializeTolerances();
+
+        // The sparse Jacobian of a previous integration must not be reused
+        linear.jacobian_available = false;
+    }
+
+    /// Attach the linear solver selected in the options to the cvode context
+    auto initializeLinearSolver() -> void
+    {
+        // The number of differential equations
+        const int num_equations = problem.numEquations();
+
+        // The options of the linear solver
+        const auto& opts = options.linear_solver;
+
+        // The maximum dimension of the Krylov subspace (zero for the default of CVODE)
+        const int maxl = opts.max_krylov_dim;
+
+        switch(opts.type)
+        {
+        case ODELinearSolver::Band:
+        {
+            Assert(opts.mupper < unsigned(num_equations) && opts.mlower < unsigned(num_equations),
+                "Cannot proceed with ODESolver::initialize to initialize the solver.",
+                "The half-bandwidths of the band linear solver must be smaller than the number of equations.");
+
+            // Call CVBand to specify the CVBAND band linear solver
+            CheckInitialize(CVBand(cvode_mem, num_equations, opts.mupper, opts.mlower));
+
+            // Set the Jacobian function, or use the difference quotient approximation of CVODE
+            if(problem.jacobianBand() || problem.jacobian())
+                CheckInitialize(CVDlsSetBandJacFn(cvode_mem, CVODEJacobianBand));
+
+            linear.Jb.resize(opts.mupper + opts.mlower + 1, num_equations);
+            break;
+        }
+        case ODELinearSolver::Spgmr:
+        case ODELinearSolver::Spbcg:
+        {
+            // Use left preconditioning if a preconditioner has been set in the problem
+            const bool preconditioned = problem.preconditionerSetup() && problem.preconditionerSolve();
+            const int pretype = preconditioned ? PREC_LEFT : PREC_NONE;
+
+            // Call CVSpgmr or CVSpbcg to specify the Krylov linear solver
+            if(opts.type == ODELinearSolver::Spgmr) {
+                CheckInitialize(CVSpgmr(cvode_mem, pretype, maxl));
+            }
+            else {
+                CheckInitialize(CVSpbcg(cvode_mem, pretype, maxl));
+            }
+
+            // Set the preconditioner functions
+            if(preconditioned)
+                CheckInitialize(CVSpilsSetPreconditioner(cvode_mem, CVODEPreconditionerSetup, CVODEPreconditionerSolve));
+            break;
+        }
+        case ODELinearSolver::Sparse:
+        {
+            Assert(problem.jacobianSparse() || problem.jacobian(),
+                "Cannot proceed with ODESolver::initialize to initialize the solver.",
+                "The sparse linear solver requires the Jacobian of the ODEProblem instance.");
+
+            // The sparse LU factorization of `I - gamma*J` is used as an exact left preconditioner of
+            // the GMRES linear solver of CVODE, which then converges in a single iteration
+            CheckInitialize(CVSpgmr(cvode_mem, PREC_LEFT, maxl));
+            CheckInitialize(CVSpilsSetPreconditioner(cvode_mem, CVODESparseSetup, CVODESparseSolve));
+
+            linear.Js.resize(num_equations, num_equations);
+            linear.I.resize(num_equations, num_equations);
+            linear.I.setIdentity();
+            linear.jacobian_available = false;
+            break;
+        }
+        default:
+        {
+            // Call CVDense to specify the CVDENSE dense linear solver
+            CheckInitialize(CVDense(cvode_mem, num_equations));
+
+            // Set the Jacobian function, or use the difference quotient approximation of CVODE
+            if(problem.jacobian())
+                CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
+        }
+        }
+    }
+
     /// Integrate the ODE performing a single step.
     auto integrate(double& t, VectorRef y) -> void
     {
         // Initialize the ODE data
-        ODEData data(problem, y, f, J);
+        ODEData data(problem, y, f, J, linear);
 
         // Define an infinite time.
         double tfinal = 10*(t + 1);
@@ -214,7 +378,7 @@ struct ODESolver::Impl
     auto integrate(double& t, VectorRef y, double tfinal) -> void
     {
         // Initialize the ODE data
-        ODEData data(problem, y, f, J);
+        ODEData data(problem, y, f, J, linear);
 
         // Set the user-defined data to cvode_mem
         CheckIntegration(CVodeSetUserData(cvode_mem, &data));
@@ -243,19 +407,42 @@ struct ODESolver::Impl
         // Initialize the cvode context
         initialize(t, y);
 
+        // Integrate the ODE equations from `t` to `t + dt`
+        advance(t, t + dt, y);
+    }
+
+    /// Integrate the ODE equations from the current time to a final one.
+    auto advance(double& t, double tfinal, VectorRef y) -> void
+    {
         // Initialize the ODE data
-        ODEData data(problem, y, f, J);
+        ODEData data(problem, y, f, J, linear);
 
         // Set the user-defined data to cvode_mem
         CheckIntegration(CVodeSetUserData(cvode_mem, &data));
 
         // Solve the ode problem from `tstart` to `tfinal`
-        CheckIntegration(CVode(cvode_mem, t + dt, cvode_y, &t, CV_NORMAL));
+        CheckIntegration(CVode(cvode_mem, tfinal, cvode_y, &t, CV_NORMAL));
 
         // Transfer the result from cvode_y to y
         for(int i = 0; i < data.num_equations; ++i)
             y[i] = VecEntry(this->cvode_y, i);
     }
+
+    /// Return the number of steps taken since the last initialization.
+    auto numSteps() const -> unsigned
+    {
+        long int nsteps = 0;
+        if(cvode_mem) CVodeGetNumSteps(cvode_mem, &nsteps);
+        return nsteps;
+    }
+
+    /// Return the number of evaluations of the right-hand side function since the last initialization.
+    auto numFunctionEvals() const -> unsigned
+    {
+        long int nfevals = 0;
+        if(cvode_mem) CVodeGetNumRhsEvals(cvode_mem, &nfevals);
+        return nfevals;
+    }
 };
 
 inline int CVODEStep(const ODEStepMode& step)
@@ -316,6 +503,112 @@ int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, voi
     return result;
 }
 
+int CVODEJacobianBand(long int N, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    for(int i = 0; i < data.num_equations; ++i)
+        data.y[i] = VecEntry(y, i);
+
+    // The range of rows of column j inside the band
+    auto ibegin = [&](long int j) { return std::max<long int>(0, j - mupper); };
+    auto iend = [&](long int j) { return std::min<long int>(N, j + mlower + 1); };
+
+    if(data.problem.jacobianBand())
+    {
+        int result = data.problem.jacobianBand()(t, data.y, data.linear.Jb);
+
+        for(long int j = 0; j < N; ++j)
+            for(long int i = ibegin(j); i < iend(j); ++i)
+                BandEntry(J, i, j) = data.linear.Jb(mupper + i - j, j);
+
+        return result;
+    }
+
+    int result = data.problem.jacobian(t, data.y, data.J);
+
+    for(long int j = 0; j < N; ++j)
+        for(long int i = ibegin(j); i < iend(j); ++i)
+            BandEntry(J, i, j) = data.J(i, j);
+
+    return result;
+}
+
+int CVODEPreconditionerSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    for(int i = 0; i < data.num_equations; ++i)
+        data.y[i] = VecEntry(y, i);
+
+    *jcurPtr = TRUE;
+
+    return data.problem.preconditionerSetup()(t, data.y, gamma);
+}
+
+int CVODEPreconditionerSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    for(int i = 0; i < data.num_equations; ++i)
+        data.y[i] = VecEntry(y, i);
+
+    VectorConstMap rvec(NV_DATA_S(r), data.num_equations);
+    VectorMap zvec(NV_DATA_S(z), data.num_equations);
+
+    return data.problem.preconditionerSolve()(t, data.y, rvec, zvec, gamma);
+}
+
+int CVODESparseSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    ODELinearData& linear = data.linear;
+
+    // Evaluate the sparse Jacobian, unless CVODE indicates the last one can be reused
+    if(!jok || !linear.jacobian_available)
+    {
+        for(int i = 0; i < data.num_equations; ++i)
+            data.y[i] = VecEntry(y, i);
+
+        int result = 0;
+
+        if(data.problem.jacobianSparse())
+            result = data.problem.jacobianSparse()(t, data.y, linear.Js);
+        else
+        {
+            result = data.problem.jacobian(t, data.y, data.J);
+            linear.Js = data.J.sparseView();
+        }
+
+        if(result) return result;
+
+        linear.jacobian_available = true;
+
+        *jcurPtr = TRUE;
+    }
+    else *jcurPtr = FALSE;
+
+    // Factorize the iteration matrix `I - gamma*J`
+    linear.M = linear.I - gamma * linear.Js;
+    linear.lu.compute(linear.M);
+
+    // A positive value indicates a recoverable failure to CVODE
+    return linear.lu.info() == Eigen::Success ? 0 : 1;
+}
+
+int CVODESparseSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    VectorConstMap rvec(NV_DATA_S(r), data.num_equations);
+    VectorMap zvec(NV_DATA_S(z), data.num_equations);
+
+    zvec = data.linear.lu.solve(rvec);
+
+    return data.linear.lu.info() == Eigen::Success ? 0 : 1;
+}
+
 ODEProblem::ODEProblem()
 : pimpl(new Impl())
 {}
@@ -348,6 +641,22 @@ auto ODEProblem::setJacobian(const ODEJacobian& J) -> void
     pimpl->ode_jacobian = J;
 }
 
+auto ODEProblem::setJacobianSparse(const ODEJacobianSparse& J) -> void
+{
+    pimpl->ode_jacobian_sparse = J;
+}
+
+auto ODEProblem::setJacobianBand(const ODEJacobianBand& J) -> void
+{
+    pimpl->ode_jacobian_band = J;
+}
+
+auto ODEProblem::setPreconditioner(const ODEPreconditionerSetup& setup, const ODEPreconditionerSolve& solve) -> void
+{
+    pimpl->preconditioner_setup = setup;
+    pimpl->preconditioner_solve = solve;
+}
+
 auto ODEProblem::initialized() const -> bool
 {
     return numEquations() && function();
@@ -368,6 +677,26 @@ auto ODEProblem::jacobian() const -> const ODEJacobian&
     return pimpl->ode_jacobian;
 }
 
+auto ODEProblem::jacobianSparse() const -> const ODEJacobianSparse&
+{
+    return pimpl->ode_jacobian_sparse;
+}
+
+auto ODEProblem::jacobianBand() const -> const ODEJacobianBand&
+{
+    return pimpl->ode_jacobian_band;
+}
+
+auto ODEProblem::preconditionerSetup() const -> const ODEPreconditionerSetup&
+{
+    return pimpl->preconditioner_setup;
+}
+
+auto ODEProblem::preconditionerSolve() const -> const ODEPreconditionerSolve&
+{
+    return pimpl->preconditioner_solve;
+}
+
 auto ODEProblem::function(double t, VectorConstRef y, VectorRef f) const -> int
 {
     return function()(t, y, f);
@@ -394,6 +723,13 @@ auto ODESolver::operator=(ODESolver other) -> ODESolver&
 auto ODESolver::setOptions(const ODEOptions& options) -> void
 {
     pimpl->options = options;
+    pimpl->reusable = false;
+}
+
+auto ODESolver::setTolerances(double reltol, VectorConstRef abstols) -> void
+{
+    pimpl->options.reltol = reltol;
+    pimpl->options.abstols = abstols;
 }
 
 auto ODESolver::setProblem(const ODEProblem& problem) -> void
@@ -421,4 +757,24 @@ auto ODESolver::solve(double& t, double dt, VectorRef y) -> void
     pimpl->solve(t, dt, y);
 }
 
+auto ODESolver::reinitialize(double tstart, VectorConstRef y) -> void
+{
+    pimpl->reinitialize(tstart, y);
+}
+
+auto ODESolver::advance(double& t, double tfinal, VectorRef y) -> void
+{
+    pimpl->advance(t, tfinal, y);
+}
+
+auto ODESolver::numSteps() const -> unsigned
+{
+    return pimpl->numSteps();
+}
+
+auto ODESolver::numFunctionEvals() const -> unsigned
+{
+    return pimpl->numFunctionEvals();
+}
+
 } // namespace Reaktoro
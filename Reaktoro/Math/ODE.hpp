@@ -21,23 +21,87 @@
 #include <functional>
 #include <memory>
 
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/SparseCore>
+
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
 
 namespace Reaktoro {
 
+/// The type used to represent the sparse Jacobian of a system of ordinary differential equations.
+using SparseMatrix = Eigen::SparseMatrix<double>;
+
 /// The function signature of the right-hand side function of a system of ordinary differential equations.
 using ODEFunction = std::function<int(double, VectorConstRef, VectorRef)>;
 
 /// The function signature of the Jacobian of the right-hand side function of a system of ordinary differential equations.
 using ODEJacobian = std::function<int(double, VectorConstRef, MatrixRef)>;
 
+/// The function signature of the Jacobian of the right-hand side function in sparse format.
+/// The sparse matrix has the dimensions of the Jacobian when the function is called, and the non-zero
+/// entries are expected to be set at every call (e.g., with `setFromTriplets`).
+using ODEJacobianSparse = std::function<int(double, VectorConstRef, SparseMatrix&)>;
+
+/// The function signature of the Jacobian of the right-hand side function in band format.
+/// The band matrix has `mupper + mlower + 1` rows and as many columns as there are equations,
+/// with the entry `J(i, j)` of the Jacobian stored at row `mupper + i - j` and column `j`.
+/// @see ODELinearSolverOptions
+using ODEJacobianBand = std::function<int(double, VectorConstRef, MatrixRef)>;
+
+/// The function signature of the setup of a preconditioner for the Krylov linear solvers.
+/// The function receives the time `t`, the variables `y` and the scalar `gamma`, and should
+/// prepare the approximate solution of linear systems with matrix `I - gamma*J`.
+using ODEPreconditionerSetup = std::function<int(double, VectorConstRef, double)>;
+
+/// The function signature of the solution of a linear system with the preconditioner of the Krylov linear solvers.
+/// The function receives the time `t`, the variables `y`, the right-hand side vector `r` and the scalar `gamma`,
+/// and should calculate the approximate solution `z` of `(I - gamma*J)*z = r`.
+using ODEPreconditionerSolve = std::function<int(double, VectorConstRef, VectorConstRef, VectorRef, double)>;
+
 /// The linear multistep method to be used in ODESolver.
 enum class ODEStepMode { Adams, BDF };
 
 /// The type of nonlinear solver iteration to be used in ODESolver.
 enum class ODEIterationMode { Functional, Newton };
 
+/// The linear solver used in the Newton iterations of ODESolver.
+enum class ODELinearSolver
+{
+    /// The dense direct linear solver (CVDense).
+    Dense,
+
+    /// The banded direct linear solver (CVBand).
+    Band,
+
+    /// The scaled preconditioned GMRES Krylov linear solver (CVSpgmr).
+    Spgmr,
+
+    /// The scaled preconditioned Bi-CGStab Krylov linear solver (CVSpbcg).
+    Spbcg,
+
+    /// The sparse direct linear solver, based on a sparse LU factorization of `I - gamma*J`.
+    Sparse,
+};
+
+/// A struct that defines the options for the linear solver of ODESolver.
+/// @see ODEOptions, ODELinearSolver
+struct ODELinearSolverOptions
+{
+    /// The linear solver used in the Newton iterations.
+    ODELinearSolver type = ODELinearSolver::Dense;
+
+    /// The upper half-bandwidth of the Jacobian if `type` is `ODELinearSolver::Band`.
+    unsigned mupper = 0;
+
+    /// The lower half-bandwidth of the Jacobian if `type` is `ODELinearSolver::Band`.
+    unsigned mlower = 0;
+
+    /// The maximum dimension of the Krylov subspace if `type` is `ODELinearSolver::Spgmr` or `ODELinearSolver::Spbcg`.
+    /// The default of CVODE is used if its value is zero.
+    unsigned max_krylov_dim = 0;
+};
+
 /// A struct that defines the options for the ODESolver.
 /// @see ODESolver, ODEProblem
 struct ODEOptions
@@ -103,6 +167,9 @@ struct ODEOptions
 
     /// The vector of absolute error tolerances for each component.
     Vector abstols;
+
+    /// The options for the linear solver used in the Newton iterations.
+    ODELinearSolverOptions linear_solver;
 };
 
 /// A class that defines a system of ordinary differential equations (ODE) problem.
@@ -131,6 +198,19 @@ public:
     /// Set the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto setJacobian(const ODEJacobian& J) -> void;
 
+    /// Set the Jacobian of the right-hand side function in sparse format.
+    /// This is used by the sparse linear solver instead of the dense Jacobian.
+    auto setJacobianSparse(const ODEJacobianSparse& J) -> void;
+
+    /// Set the Jacobian of the right-hand side function in band format.
+    /// This is used by the band linear solver instead of the dense Jacobian.
+    auto setJacobianBand(const ODEJacobianBand& J) -> void;
+
+    /// Set the preconditioner used by the Krylov linear solvers.
+    /// @param setup The function that prepares the preconditioner
+    /// @param solve The function that solves a linear system with the preconditioner
+    auto setPreconditioner(const ODEPreconditionerSetup& setup, const ODEPreconditionerSolve& solve) -> void;
+
     /// Return true if the problem has bee initialized.
     auto initialized() const -> bool;
 
@@ -143,6 +223,18 @@ public:
     /// Return the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto jacobian() const -> const ODEJacobian&;
 
+    /// Return the Jacobian of the right-hand side function in sparse format
+    auto jacobianSparse() const -> const ODEJacobianSparse&;
+
+    /// Return the Jacobian of the right-hand side function in band format
+    auto jacobianBand() const -> const ODEJacobianBand&;
+
+    /// Return the function that prepares the preconditioner of the Krylov linear solvers
+    auto preconditionerSetup() const -> const ODEPreconditionerSetup&;
+
+    /// Return the function that solves a linear system with the preconditioner of the Krylov linear solvers
+    auto preconditionerSolve() const -> const ODEPreconditionerSolve&;
+
     /// Evaluate the right-hand side function of the system of ordinary differential equations.
     /// @param t The time variable of the function
     /// @param y The y-variables of the function
@@ -184,6 +276,13 @@ public:
     /// @see ODEOptions
     auto setOptions(const ODEOptions& options) -> void;
 
+    /// Set the relative and absolute tolerances of the ODE solver.
+    /// Unlike `ODESolver::setOptions`, this does not prevent the integration memory from being
+    /// reused, and the new tolerances are applied by the next call to `ODESolver::reinitialize`.
+    /// @param reltol The relative tolerance
+    /// @param abstols The absolute tolerances of each variable
+    auto setTolerances(double reltol, VectorConstRef abstols) -> void;
+
     /// Set the ODE problem.
     /// @see ODEProblem
     auto setProblem(const ODEProblem& problem) -> void;
@@ -194,6 +293,15 @@ public:
     /// @param y The initial values of the variables
     auto initialize(double tstart, VectorConstRef y) -> void;
 
+    /// Reinitializes the ODE solver reusing its integration memory.
+    /// The memory allocated by CVODE, including that of the linear solver, is kept if the solver
+    /// was already initialized for the same number of equations and the options have not changed
+    /// since, and only the start time and initial values are reset. Otherwise, this is equivalent
+    /// to `ODESolver::initialize`.
+    /// @param tstart The start time of the integration.
+    /// @param y The initial values of the variables
+    auto reinitialize(double tstart, VectorConstRef y) -> void;
+
     /// Integrate the ODE performing a single step.
     /// @param[in,out] t The current time of the integration as input, the new current time as output
     /// @param[in,out] y The current variables as input, the new current variables as output
@@ -211,6 +319,18 @@ public:
     /// @param[in,out] y The current variables as input, the new current variables as output
     auto solve(double& t, double dt, VectorRef y) -> void;
 
+    /// Integrate the ODE equations from the current time to a final one, without initializing the solver.
+    /// @param[in,out] t The current time of the integration as input, the new current time as output
+    /// @param tfinal The final time of the integration
+    /// @param[in,out] y The current variables as input, the new current variables as output
+    auto advance(double& t, double tfinal, VectorRef y) -> void;
+
+    /// Return the number of steps taken since the last initialization.
+    auto numSteps() const -> unsigned;
+
+    /// Return the number of evaluations of the right-hand side function since the last initialization.
+    auto numFunctionEvals() const -> unsigned;
+
 private:
     struct Impl;
 
@@ -24,12 +24,15 @@ auto OptimumResult::operator+=(const OptimumResult& other) -> OptimumResult&
     succeeded              = other.succeeded;
     iterations            += other.iterations;
     num_objective_evals   += other.num_objective_evals;
+    num_backtracks        += other.num_backtracks;
     convergence_rate       = other.convergence_rate;
     error                  = other.error;
     time                  += other.time;
     time_objective_evals  += other.time_objective_evals;
     time_constraint_evals += other.time_constraint_evals;
     time_linear_systems   += other.time_linear_systems;
+    time_kkt_decompose    += other.time_kkt_decompose;
+    time_kkt_solve        += other.time_kkt_solve;
 
     return *this;
 }
@@ -31,6 +31,9 @@ struct OptimumResult
     /// The number of evaluations of the objective function in the optimisation calculation
     unsigned num_objective_evals = 0;
 
+    /// The number of reductions of the step length in the line search of the optimisation calculation
+    unsigned num_backtracks = 0;
+
     /// The convergence rate of the optimisation calculation near the solution
     double convergence_rate = 0;
 
@@ -49,6 +52,12 @@ struct OptimumResult
     /// The wall time spent for all linear system solutions (in units of s)
     double time_linear_systems = 0;
 
+    /// The wall time spent for all decompositions of the KKT matrix (in units of s)
+    double time_kkt_decompose = 0;
+
+    /// The wall time spent for all solutions of the decomposed KKT equations (in units of s)
+    double time_kkt_solve = 0;
+
     /// Update this OptimumResult instance with another by addition
     auto operator+=(const OptimumResult& other) -> OptimumResult&;
 };
@@ -334,7 +334,9 @@ auto OptimumSolverActNewton::Impl::solve(const OptimumProblem& problem, OptimumS
 
         // Update the time spent in linear systems
         result.time_linear_systems += kkt.result().time_solve;
+        result.time_kkt_solve += kkt.result().time_solve;
         result.time_linear_systems += kkt.result().time_decompose;
+        result.time_kkt_decompose += kkt.result().time_decompose;
     };
 
     // Return true if the function `compute_newton_step` failed
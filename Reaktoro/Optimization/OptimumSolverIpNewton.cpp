@@ -217,7 +217,13 @@ struct OptimumSolverIpNewton::Impl
                     f.hessian.diagonal = zeros(n);
                 }
             }
-            else f = problem.objective(x);
+            else
+            {
+                const Time begin_objective = time();
+                f = problem.objective(x);
+                result.num_objective_evals += 1;
+                result.time_objective_evals += elapsed(begin_objective);
+            }
         };
 
         // The function that initialize the state of some variables
@@ -248,7 +254,9 @@ struct OptimumSolverIpNewton::Impl
 
             // Update the time spent in linear systems
             result.time_linear_systems += kkt.result().time_solve;
+            result.time_kkt_solve += kkt.result().time_solve;
             result.time_linear_systems += kkt.result().time_decompose;
+            result.time_kkt_decompose += kkt.result().time_decompose;
 
             // Perform emergency Newton step calculation as long as steps contains NaN or INF values
             while(!kkt.result().succeeded)
@@ -270,7 +278,9 @@ struct OptimumSolverIpNewton::Impl
 
                 // Update the time spent in linear systems
                 result.time_linear_systems += kkt.result().time_solve;
+                result.time_kkt_solve += kkt.result().time_solve;
                 result.time_linear_systems += kkt.result().time_decompose;
+                result.time_kkt_decompose += kkt.result().time_decompose;
             }
 
             // Return true if he calculation succeeded
@@ -305,6 +315,9 @@ struct OptimumSolverIpNewton::Impl
 
                 // Decrease the current step length
                 alpha *= 0.5;
+
+                // Update the number of step length reductions
+                result.num_backtracks += 1;
             }
 
             // Return false if xtrial could not be found s.t. f(xtrial) is finite
@@ -352,6 +365,9 @@ struct OptimumSolverIpNewton::Impl
 
                 // Decrease alpha in a hope that a shorter step results f(xtrial) finite
                 alpha *= 0.01;
+
+                // Update the number of step length reductions
+                result.num_backtracks += 1;
             }
 
             // Return false if xtrial could not be found s.t. f(xtrial) is finite
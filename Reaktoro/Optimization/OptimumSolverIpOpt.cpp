@@ -231,6 +231,7 @@ struct OptimumSolverIpOpt::Impl
         auto update_state = [&]()
         {
             f = problem.objective(x);
+            result.num_objective_evals += 1;
             h = A*x - b;
         };
 
@@ -250,7 +251,9 @@ struct OptimumSolverIpOpt::Impl
 
             // Update the time spent in linear systems
             result.time_linear_systems += kkt.result().time_solve;
+            result.time_kkt_solve += kkt.result().time_solve;
             result.time_linear_systems += kkt.result().time_decompose;
+            result.time_kkt_decompose += kkt.result().time_decompose;
         };
 
         auto successful_second_order_correction = [&]() -> bool
@@ -265,12 +268,14 @@ struct OptimumSolverIpOpt::Impl
                 rhs.ry.noalias() = -h_soc;
                 kkt.solve(rhs, sol_cor);
                 result.time_linear_systems += kkt.result().time_solve;
+                result.time_kkt_solve += kkt.result().time_solve;
 
                 const double alpha_soc = fractionToTheBoundary(x, sol_cor.dx, tau);
 
                 x_soc = x + alpha_soc * sol_cor.dx;
 
                 f_trial = problem.objective(x_soc);
+                result.num_objective_evals += 1;
                 h_trial = A*x_soc - b;
 
                 // Compute the second-order corrected \theta and \phi measures at the trial iterate
@@ -369,6 +374,7 @@ struct OptimumSolverIpOpt::Impl
 
                 // Update the objective and constraint states with the trial iterate
                 f_trial = problem.objective(x_trial);
+                result.num_objective_evals += 1;
                 h_trial = A*x_trial - b;
 
                 // Update the barrier objective function with the trial iterate
@@ -416,6 +422,7 @@ struct OptimumSolverIpOpt::Impl
 
                 // Decrease the length of the size step alpha
                 alpha *= 0.5;
+                result.num_backtracks += 1;
 
                 // Check if the step size is smaller than the minimum
                 if(alpha < alpha_min)
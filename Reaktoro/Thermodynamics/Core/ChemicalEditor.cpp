@@ -511,7 +511,13 @@ public:
         for(const MineralReaction& rxn : mineral_reactions)
             reactions.push_back(createReaction(rxn, system));
 
-        return ReactionSystem(system, reactions);
+        ReactionSystem reactionsys(system, reactions);
+
+        // Evaluate the rates of all mineral reactions at once with vectorized operations
+        if(mineral_reactions.size())
+            reactionsys.setRates(createReactionRates(mineral_reactions, reactionsys));
+
+        return reactionsys;
     }
 };
 
@@ -20,8 +20,10 @@ from reaktoro import (
     Element,
 )
 
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 import locale
+import threading
 import os
 import pytest
 import sys
@@ -242,3 +244,78 @@ def test_database_looking_for_species_with_element():
     assert liquid_species_with_H_or_Fe[0].name() == "H2S(liq)"
     assert mineral_species_with_H_or_Fe[0].name() == "Pyrrhotite"
 
+
+def test_database_looking_for_added_species_with_element():
+    """
+    Test that species added to a database whose species have no elements yet
+    are found by the first query for species with given elements, and that
+    species with elements not in the query are excluded.
+    """
+    database = Database(str(get_test_data_dir() / "supcrt98_simplified.xml"))
+    no_species_database = Database(str(get_test_data_dir() / "supcrt98_no_species.xml"))
+
+    for species in database.aqueousSpecies():
+        no_species_database.addAqueousSpecies(species)
+    for species in database.gaseousSpecies():
+        no_species_database.addGaseousSpecies(species)
+    for species in database.liquidSpecies():
+        no_species_database.addLiquidSpecies(species)
+    for species in database.mineralSpecies():
+        no_species_database.addMineralSpecies(species)
+
+    assert [s.name() for s in no_species_database.aqueousSpeciesWithElements(["H", "S"])] == ["H2S(aq)"]
+    assert [s.name() for s in no_species_database.gaseousSpeciesWithElements(["H", "S"])] == ["H2S(g)"]
+    assert [s.name() for s in no_species_database.liquidSpeciesWithElements(["H", "S"])] == ["H2S(liq)"]
+    assert [s.name() for s in no_species_database.mineralSpeciesWithElements(["Fe", "S"])] == ["Pyrrhotite"]
+
+    assert no_species_database.aqueousSpeciesWithElements(["H"]) == []
+    assert no_species_database.mineralSpeciesWithElements(["H", "S"]) == []
+
+
+def _species_summary(species_list):
+    return [(species.name(), species.molarMass()) for species in species_list]
+
+
+def test_database_instances_have_identical_species():
+    database1 = Database("supcrt98.xml")
+    database2 = Database("supcrt98.xml")
+
+    assert _species_summary(database1.aqueousSpecies()) == _species_summary(database2.aqueousSpecies())
+    assert _species_summary(database1.gaseousSpecies()) == _species_summary(database2.gaseousSpecies())
+    assert _species_summary(database1.liquidSpecies()) == _species_summary(database2.liquidSpecies())
+    assert _species_summary(database1.mineralSpecies()) == _species_summary(database2.mineralSpecies())
+
+
+def test_database_concurrent_first_lookups():
+    num_threads = 8
+
+    # The species are decoded on their first lookup, which all threads below make at the same time
+    database = Database("supcrt98.xml")
+    barrier = threading.Barrier(num_threads)
+
+    def lookup(_):
+        barrier.wait()
+        return (
+            database.aqueousSpecies("CO2(aq)").molarMass(),
+            database.gaseousSpecies("CO2(g)").molarMass(),
+            database.mineralSpecies("Calcite").molarMass(),
+            database.containsAqueousSpecies("HCO3-"),
+            [species.name() for species in database.aqueousSpeciesWithElements(["Ca", "C", "O"])],
+        )
+
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        results = list(executor.map(lookup, range(num_threads)))
+
+    expected_database = Database("supcrt98.xml")
+    expected = (
+        expected_database.aqueousSpecies("CO2(aq)").molarMass(),
+        expected_database.gaseousSpecies("CO2(g)").molarMass(),
+        expected_database.mineralSpecies("Calcite").molarMass(),
+        expected_database.containsAqueousSpecies("HCO3-"),
+        [species.name() for species in expected_database.aqueousSpeciesWithElements(["Ca", "C", "O"])],
+    )
+
+    assert expected[3]
+    assert expected[4]
+    for result in results:
+        assert result == expected
@@ -19,7 +19,9 @@
 
 // C++ includes
 #include <clocale>
+#include <cstdint>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -59,6 +61,34 @@ using GaseousSpeciesMap = std::map<std::string, GaseousSpecies>;
 using LiquidSpeciesMap  = std::map<std::string, LiquidSpecies>;
 using MineralSpeciesMap = std::map<std::string, MineralSpecies>;
 
+/// A set of elements represented as a bitmask over the elements of a database
+using ElementMask = std::vector<std::uint64_t>;
+
+/// Auxiliary type for a map of species names to the masks of their elements
+using ElementMaskMap = std::map<std::string, ElementMask>;
+
+/// An entry of a species in the xml document of a database whose data has not been decoded yet
+struct SpeciesEntry
+{
+    /// The xml node of the species in the database document
+    xml_node node;
+
+    /// The mask of the elements in the species (the charge element Z excluded)
+    ElementMask elements;
+};
+
+/// Auxiliary type for the index of species not decoded yet
+using SpeciesIndex = std::map<std::string, SpeciesEntry>;
+
+/// Return true if all elements in a mask are also in another
+auto isSubset(const ElementMask& lhs, const ElementMask& rhs) -> bool
+{
+    for(std::size_t i = 0; i < lhs.size(); ++i)
+        if(lhs[i] & ~(i < rhs.size() ? rhs[i] : 0))
+            return false;
+    return true;
+}
+
 auto errorNonExistentSpecies(std::string type, std::string name) -> void
 {
     Exception exception;
@@ -357,31 +387,6 @@ auto parseMineralSpeciesThermoData(const xml_node& node) -> MineralSpeciesThermo
     return thermo;
 }
 
-template<typename SpeciesType, typename SpeciesFunction>
-auto collectSpecies(const std::map<std::string, SpeciesType>& map, const SpeciesFunction& fn) -> std::vector<SpeciesType>
-{
-    std::set<SpeciesType> species;
-    for(const auto& entry : map)
-        if(fn(entry.second))
-            species.insert(entry.second);
-    return std::vector<SpeciesType>(species.begin(), species.end());
-}
-
-template<typename SpeciesType>
-auto speciesWithElements(const std::vector<std::string>& elements, const std::map<std::string, SpeciesType>& map) -> std::vector<SpeciesType>
-{
-    auto f = [&](const SpeciesType& species)
-    {
-        // Check if the given species has all chemical elements in the list of elements (ignore charge Z)
-        for(auto pair : species.elements())
-            if(pair.first.name() != "Z" && !contained(pair.first.name(), elements))
-                return false;
-        return true;
-    };
-
-    return collectSpecies(map, f);
-}
-
 } // namespace
 
 //A guard object to guarantee the return of original locale
@@ -408,17 +413,50 @@ struct Database::Impl
     /// The set of all elements in the database
     ElementMap element_map;
 
-    /// The set of all aqueous species in the database
-    AqueousSpeciesMap aqueous_species_map;
+    /// The set of all decoded aqueous species in the database
+    mutable AqueousSpeciesMap aqueous_species_map;
+
+    /// The set of all decoded gaseous species in the database
+    mutable GaseousSpeciesMap gaseous_species_map;
 
-    /// The set of all gaseous species in the database
-    GaseousSpeciesMap gaseous_species_map;
+    /// The set of all decoded liquid species in the database
+    mutable LiquidSpeciesMap liquid_species_map;
 
-    /// The set of all liquid species in the database
-    LiquidSpeciesMap liquid_species_map;
+    /// The set of all decoded mineral species in the database
+    mutable MineralSpeciesMap mineral_species_map;
 
-    /// The set of all mineral species in the database
-    MineralSpeciesMap mineral_species_map;
+    /// The xml document of the database, kept alive for the lazy decoding of its species
+    std::shared_ptr<xml_document> doc;
+
+    /// The aqueous species in the xml document not decoded yet
+    mutable SpeciesIndex aqueous_species_index;
+
+    /// The gaseous species in the xml document not decoded yet
+    mutable SpeciesIndex gaseous_species_index;
+
+    /// The liquid species in the xml document not decoded yet
+    mutable SpeciesIndex liquid_species_index;
+
+    /// The mineral species in the xml document not decoded yet
+    mutable SpeciesIndex mineral_species_index;
+
+    /// The masks of the elements of the decoded aqueous species
+    mutable ElementMaskMap aqueous_species_masks;
+
+    /// The masks of the elements of the decoded gaseous species
+    mutable ElementMaskMap gaseous_species_masks;
+
+    /// The masks of the elements of the decoded liquid species
+    mutable ElementMaskMap liquid_species_masks;
+
+    /// The masks of the elements of the decoded mineral species
+    mutable ElementMaskMap mineral_species_masks;
+
+    /// The bit positions of the elements in the element masks
+    mutable std::map<std::string, Index> element_bits;
+
+    /// The mutex that protects the lazy decoding of the species
+    mutable std::mutex mutex;
 
     /// ThermoFun database
     ThermoFun::Database fundb;
@@ -430,10 +468,10 @@ struct Database::Impl
         const auto guard = ChangeLocale("C");
 
         // Create the XML document
-        xml_document doc;
+        doc = std::make_shared<xml_document>();
 
         // Load the xml database file
-        auto result = doc.load_file(filename.c_str());
+        auto result = doc->load_file(filename.c_str());
 
         // Check if result is not ok, and then try a built-in database with same name
         if(!result)
@@ -442,7 +480,7 @@ struct Database::Impl
             std::string builtin = database(filename);
 
             // If not empty, use the built-in database to create the xml doc
-            if(!builtin.empty()) result = doc.load_string(builtin.c_str());
+            if(!builtin.empty()) result = doc->load_string(builtin.c_str());
         }
 
         // Ensure either a database file path was correctly given, or a built-in database
@@ -456,7 +494,7 @@ struct Database::Impl
         }
 
         // Parse the xml document
-        parse(doc, filename);
+        parse(*doc, filename);
     }
 
     Impl(const ThermoFun::Database& fundatabase)
@@ -488,6 +526,11 @@ struct Database::Impl
             } else RuntimeError("Could not parse the species `" + name + " in the database.",
                 "The type of the species is unknown.");
         }
+
+        // Assign bit positions to the elements of all species, so that they are known to the queries by elements
+        updateElementMasks(aqueous_species_map, aqueous_species_masks);
+        updateElementMasks(gaseous_species_map, gaseous_species_masks);
+        updateElementMasks(mineral_species_map, mineral_species_masks);
     }
 
     auto parseElementalFormula(const std::string& formula) -> std::map<Element, double>
@@ -587,22 +630,34 @@ struct Database::Impl
 
     auto addAqueousSpecies(const AqueousSpecies& species) -> void
     {
-        aqueous_species_map.insert({species.name(), species});
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeAqueousSpecies(species.name());
+        if(aqueous_species_map.insert({species.name(), species}).second)
+            aqueous_species_masks[species.name()] = elementMask(species);
     }
 
     auto addGaseousSpecies(const GaseousSpecies& species) -> void
     {
-        gaseous_species_map.insert({ species.name(), species });
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeGaseousSpecies(species.name());
+        if(gaseous_species_map.insert({ species.name(), species }).second)
+            gaseous_species_masks[species.name()] = elementMask(species);
     }
 
     auto addLiquidSpecies(const LiquidSpecies& species) -> void
     {
-        liquid_species_map.insert({ species.name(), species });
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeLiquidSpecies(species.name());
+        if(liquid_species_map.insert({ species.name(), species }).second)
+            liquid_species_masks[species.name()] = elementMask(species);
     }
 
     auto addMineralSpecies(const MineralSpecies& species) -> void
     {
-        mineral_species_map.insert({species.name(), species});
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeMineralSpecies(species.name());
+        if(mineral_species_map.insert({species.name(), species}).second)
+            mineral_species_masks[species.name()] = elementMask(species);
     }
 
     auto elements() const-> std::vector<Element>
@@ -621,11 +676,17 @@ struct Database::Impl
 
     auto aqueousSpecies() -> std::vector<AqueousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        while(!aqueous_species_index.empty())
+            decodeAqueousSpecies(aqueous_species_index.begin()->first);
         return collectValues(aqueous_species_map);
     }
 
     auto aqueousSpecies(std::string name) const -> const AqueousSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeAqueousSpecies(name);
+
         if(aqueous_species_map.count(name) == 0)
             errorNonExistentSpecies("aqueous", name);
 
@@ -634,11 +695,17 @@ struct Database::Impl
 
     auto gaseousSpecies() -> std::vector<GaseousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        while(!gaseous_species_index.empty())
+            decodeGaseousSpecies(gaseous_species_index.begin()->first);
         return collectValues(gaseous_species_map);
     }
 
     auto gaseousSpecies(std::string name) const -> const GaseousSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeGaseousSpecies(name);
+
         if(gaseous_species_map.count(name) == 0)
             errorNonExistentSpecies("gaseous", name);
 
@@ -647,11 +714,17 @@ struct Database::Impl
 
     auto liquidSpecies() -> std::vector<LiquidSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        while(!liquid_species_index.empty())
+            decodeLiquidSpecies(liquid_species_index.begin()->first);
         return collectValues(liquid_species_map);
     }
 
     auto liquidSpecies(std::string name) const -> const LiquidSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeLiquidSpecies(name);
+
         if(liquid_species_map.count(name) == 0)
             errorNonExistentSpecies("liquid", name);
 
@@ -660,11 +733,17 @@ struct Database::Impl
 
     auto mineralSpecies() -> std::vector<MineralSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        while(!mineral_species_index.empty())
+            decodeMineralSpecies(mineral_species_index.begin()->first);
         return collectValues(mineral_species_map);
     }
 
     auto mineralSpecies(std::string name) const -> const MineralSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeMineralSpecies(name);
+
         if(mineral_species_map.count(name) == 0)
             errorNonExistentSpecies("mineral", name);
 
@@ -673,42 +752,179 @@ struct Database::Impl
 
     auto containsAqueousSpecies(std::string species) const -> bool
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeAqueousSpecies(species);
         return aqueous_species_map.count(species) != 0;
     }
 
     auto containsGaseousSpecies(std::string species) const -> bool
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeGaseousSpecies(species);
         return gaseous_species_map.count(species) != 0;
     }
 
     auto containsLiquidSpecies(std::string species) const -> bool
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeLiquidSpecies(species);
         return liquid_species_map.count(species) != 0;
     }
 
     auto containsMineralSpecies(std::string species) const -> bool
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeMineralSpecies(species);
         return mineral_species_map.count(species) != 0;
     }
 
     auto aqueousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<AqueousSpecies>
     {
-        return speciesWithElements(elements, aqueous_species_map);
+        std::lock_guard<std::mutex> lock(mutex);
+        const ElementMask mask = elementMask(elements, false);
+        for(const std::string& name : candidates(aqueous_species_index, mask))
+            decodeAqueousSpecies(name);
+        return speciesWithElements(aqueous_species_map, aqueous_species_masks, mask);
     }
 
     auto gaseousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<GaseousSpecies>
     {
-        return speciesWithElements(elements, gaseous_species_map);
+        std::lock_guard<std::mutex> lock(mutex);
+        const ElementMask mask = elementMask(elements, false);
+        for(const std::string& name : candidates(gaseous_species_index, mask))
+            decodeGaseousSpecies(name);
+        return speciesWithElements(gaseous_species_map, gaseous_species_masks, mask);
     }
 
     auto liquidSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<LiquidSpecies>
     {
-        return speciesWithElements(elements, liquid_species_map);
+        std::lock_guard<std::mutex> lock(mutex);
+        const ElementMask mask = elementMask(elements, false);
+        for(const std::string& name : candidates(liquid_species_index, mask))
+            decodeLiquidSpecies(name);
+        return speciesWithElements(liquid_species_map, liquid_species_masks, mask);
     }
 
     auto mineralSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<MineralSpecies>
     {
-        return speciesWithElements(elements, mineral_species_map);
+        std::lock_guard<std::mutex> lock(mutex);
+        const ElementMask mask = elementMask(elements, false);
+        for(const std::string& name : candidates(mineral_species_index, mask))
+            decodeMineralSpecies(name);
+        return speciesWithElements(mineral_species_map, mineral_species_masks, mask);
+    }
+
+    /// Return the mask of given elements, with new bit positions for unknown elements if `extend` is true
+    auto elementMask(const std::vector<std::string>& elements, bool extend) const -> ElementMask
+    {
+        ElementMask mask;
+        for(const std::string& element : elements)
+        {
+            if(element == "Z")
+                continue;
+            auto iter = element_bits.find(element);
+            if(iter == element_bits.end())
+            {
+                if(!extend)
+                    continue;
+                iter = element_bits.emplace(element, element_bits.size()).first;
+            }
+            const Index bit = iter->second;
+            if(mask.size() <= bit/64)
+                mask.resize(bit/64 + 1, 0);
+            mask[bit/64] |= std::uint64_t(1) << (bit % 64);
+        }
+        return mask;
+    }
+
+    /// Return the mask of the elements of a species
+    template<typename SpeciesType>
+    auto elementMask(const SpeciesType& species) const -> ElementMask
+    {
+        std::vector<std::string> elements;
+        for(const auto& pair : species.elements())
+            elements.push_back(pair.first.name());
+        return elementMask(elements, true);
+    }
+
+    /// Compute the masks of the decoded species that have none yet, assigning bit positions to their new elements
+    template<typename SpeciesMap>
+    auto updateElementMasks(const SpeciesMap& map, ElementMaskMap& masks) const -> void
+    {
+        for(const auto& pair : map)
+            if(masks.find(pair.first) == masks.end())
+                masks.emplace(pair.first, elementMask(pair.second));
+    }
+
+    /// Return the names of the species not decoded yet whose elements are all in a given mask
+    static auto candidates(const SpeciesIndex& index, const ElementMask& mask) -> std::vector<std::string>
+    {
+        std::vector<std::string> names;
+        for(const auto& pair : index)
+            if(isSubset(pair.second.elements, mask))
+                names.push_back(pair.first);
+        return names;
+    }
+
+    /// Return the decoded species whose elements are all in a given mask, in alphabetical order
+    template<typename SpeciesMap>
+    auto speciesWithElements(const SpeciesMap& map, ElementMaskMap& masks, const ElementMask& mask) const -> std::vector<typename SpeciesMap::mapped_type>
+    {
+        std::vector<typename SpeciesMap::mapped_type> species;
+        for(const auto& pair : map)
+        {
+            auto iter = masks.find(pair.first);
+            if(iter == masks.end())
+                iter = masks.emplace(pair.first, elementMask(pair.second)).first;
+            if(isSubset(iter->second, mask))
+                species.push_back(pair.second);
+        }
+        return species;
+    }
+
+    /// Decode a species in an index, if not decoded yet, and store it in a map if it is valid
+    template<typename SpeciesMap, typename Decoder>
+    auto decode(SpeciesMap& map, SpeciesIndex& index, const std::string& name, const Decoder& fn) const -> void
+    {
+        auto iter = index.find(name);
+        if(iter == index.end())
+            return;
+        const auto guard = ChangeLocale("C");
+        auto species = fn(iter->second.node);
+        species.setName(name);
+        index.erase(iter);
+        if(valid(species))
+            map.insert({name, species});
+    }
+
+    auto decodeAqueousSpecies(const std::string& name) const -> void
+    {
+        decode(aqueous_species_map, aqueous_species_index, name, [&](const xml_node& node) { return parseAqueousSpecies(node); });
+    }
+
+    auto decodeGaseousSpecies(const std::string& name) const -> void
+    {
+        decode(gaseous_species_map, gaseous_species_index, name, [&](const xml_node& node) { return parseFluidSpecies(node); });
+    }
+
+    auto decodeLiquidSpecies(const std::string& name) const -> void
+    {
+        decode(liquid_species_map, liquid_species_index, name, [&](const xml_node& node) { return parseFluidSpecies(node); });
+    }
+
+    auto decodeMineralSpecies(const std::string& name) const -> void
+    {
+        decode(mineral_species_map, mineral_species_index, name, [&](const xml_node& node) { return parseMineralSpecies(node); });
+    }
+
+    /// Return the mask of the elements in the elemental formula of a species node, without decoding the species
+    auto elementsInFormula(const xml_node& node) const -> ElementMask
+    {
+        std::vector<std::string> elements;
+        auto words = split(node.child("Elements").text().get(), "()");
+        for(unsigned i = 0; i < words.size(); i += 2)
+            elements.push_back(words[i]);
+        return elementMask(elements, true);
     }
 
     auto parse(const xml_document& doc, std::string databasename) -> void
@@ -727,7 +943,7 @@ struct Database::Impl
         element_map["Z"] = Element();
         element_map["Z"].setName("Z");
 
-        // Read all species in the database
+        // Index all species in the database, which are decoded only when requested
         for(xml_node node : database.children("Species"))
         {
             std::string type = node.child("Type").text().get();
@@ -735,28 +951,17 @@ struct Database::Impl
 
             if(type == "Aqueous")
             {
-                AqueousSpecies species = parseAqueousSpecies(node);
-                if(valid(species))
-                    aqueous_species_map[species.name()] = species;
+                aqueous_species_index[name] = {node, elementsInFormula(node)};
             }
             else if(type == "Gaseous")
             {
-                GaseousSpecies gaseous_species = parseFluidSpecies(node);
-                gaseous_species.setName(name);
-                LiquidSpecies liquid_species = parseFluidSpecies(node);
                 const auto gas_species_suffix_size = 3;
-                liquid_species.setName(name.substr(0, name.size() - gas_species_suffix_size) + "(liq)");
-                if(valid(gaseous_species))
-                {
-                    gaseous_species_map[gaseous_species.name()] = gaseous_species;
-                    liquid_species_map[liquid_species.name()] = liquid_species;
-                }
+                gaseous_species_index[name] = {node, elementsInFormula(node)};
+                liquid_species_index[name.substr(0, name.size() - gas_species_suffix_size) + "(liq)"] = {node, elementsInFormula(node)};
             }
             else if(type == "Mineral")
             {
-                MineralSpecies species = parseMineralSpecies(node);
-                if(valid(species))
-                    mineral_species_map[species.name()] = species;
+                mineral_species_index[name] = {node, elementsInFormula(node)};
             }
             else RuntimeError("Could not parse the species `" +
                 name + "` with type `" + type + "` in the database `" +
@@ -772,7 +977,7 @@ struct Database::Impl
         return element;
     }
 
-    auto parseElementalFormula(const xml_node& node) -> std::map<Element, double>
+    auto parseElementalFormula(const xml_node& node) const -> std::map<Element, double>
     {
         std::string formula = node.child("Elements").text().get();
         std::map<Element, double> elements;
@@ -792,7 +997,7 @@ struct Database::Impl
         return elements;
     }
 
-    auto parseSpecies(const xml_node& node) -> Species
+    auto parseSpecies(const xml_node& node) const -> Species
     {
         // The species instance
         Species species;
@@ -809,7 +1014,7 @@ struct Database::Impl
         return species;
     }
 
-    auto parseAqueousSpecies(const xml_node& node) -> AqueousSpecies
+    auto parseAqueousSpecies(const xml_node& node) const -> AqueousSpecies
     {
         // The aqueous species instance
         AqueousSpecies species = parseSpecies(node);
@@ -826,7 +1031,7 @@ struct Database::Impl
         return species;
     }
 
-    auto parseFluidSpecies(const xml_node& node) -> FluidSpecies
+    auto parseFluidSpecies(const xml_node& node) const -> FluidSpecies
     {
         // The gaseous species instance
         FluidSpecies species = parseSpecies(node);
@@ -849,7 +1054,7 @@ struct Database::Impl
         return species;
     }
 
-    auto parseMineralSpecies(const xml_node& node) -> MineralSpecies
+    auto parseMineralSpecies(const xml_node& node) const -> MineralSpecies
     {
         // The mineral species instance
         MineralSpecies species = parseSpecies(node);
@@ -85,6 +85,8 @@ public:
     /// database file is not found, then a default built-in database
     /// with the same name will be tried. If no default built-in database
     /// exists with a given name, an exception will be thrown.
+    /// The species in the database file are only indexed on construction, and their
+    /// data is decoded the first time they are requested.
     /// @param filename The name of the database file
     explicit Database(std::string filename);
 
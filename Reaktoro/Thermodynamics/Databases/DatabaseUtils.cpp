@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <mutex>
 
 // Miniz includes
 #include <miniz/zip_file.hpp>
@@ -77,6 +78,16 @@ auto database(std::string name) -> std::string
     if(j < internal::databases.size())
         name += ".xml";
 
+    // The unzipped contents of the built-in databases already requested
+    static std::map<std::string, std::string> cache;
+    static std::mutex cache_mutex;
+
+    // Return the cached contents of the database to avoid unzipping it again
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto iter = cache.find(name);
+    if(iter != cache.end())
+        return iter->second;
+
     // The begin and end pointers to the array containing the database data
     const auto& begin = internal::databases_data[idx];
     const auto& end = begin + internal::databases_len[idx];
@@ -88,7 +99,7 @@ auto database(std::string name) -> std::string
     zip_file file(data);
 
     // Return the contents of the unzipped file as a string
-    return file.read(name);
+    return cache[name] = file.read(name);
 }
 
 auto databases() -> std::vector<std::string>
@@ -1,5 +1,9 @@
+import numpy as np
+import pytest
+
 from reaktoro import (
     ChemicalEditor,
+    ChemicalProperties,
     ChemicalState,
     ChemicalSystem,
     Database,
@@ -47,3 +51,44 @@ def test_CubicEOS_multiple_roots():
 
     # check that it doesn't raise an exception
     state.properties()
+
+
+def _create_gaseous_system():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addGaseousPhase(["CO2(g)", "H2O(g)", "CH4(g)"]).setChemicalModelPengRobinson()
+
+    return ChemicalSystem(editor)
+
+
+def test_CubicEOS_cached_temperature_terms():
+    """
+    The terms of the cubic EOS that depend only on temperature are cached
+    between evaluations. Check that evaluating one system at alternating
+    temperatures and compositions gives the same properties as evaluating
+    a fresh system, with nothing cached, for each of them.
+    """
+    conditions = [
+        (300.0, 1e5, [1.0, 0.1, 0.5]),
+        (300.0, 1e5, [0.2, 0.7, 0.1]),
+        (350.0, 50e5, [0.2, 0.7, 0.1]),
+        (300.0, 100e5, [1.0, 0.1, 0.5]),
+    ]
+
+    cached = ChemicalProperties(_create_gaseous_system())
+
+    for T, P, n in conditions:
+        cached.update(T, P, np.array(n))
+
+        uncached = ChemicalProperties(_create_gaseous_system())
+        uncached.update(T, P, np.array(n))
+
+        for actual, expected in [
+            (cached.lnActivityCoefficients(), uncached.lnActivityCoefficients()),
+            (cached.phaseVolumes(), uncached.phaseVolumes()),
+        ]:
+            assert actual.val == pytest.approx(expected.val, rel=1e-12)
+            assert actual.ddT == pytest.approx(expected.ddT, rel=1e-12)
+            assert actual.ddP == pytest.approx(expected.ddP, rel=1e-12)
+            assert actual.ddn == pytest.approx(expected.ddn, rel=1e-12)
@@ -154,6 +154,71 @@ auto Psi(CubicEOS::Model type) -> double
     }
 }
 
+/// A matrix of temperature-dependent quantities and their partial derivatives w.r.t. temperature and pressure.
+struct ThermoMatrix
+{
+    /// The values of the quantities
+    Matrix val;
+
+    /// The partial temperature derivatives of the quantities
+    Matrix ddT;
+
+    /// The partial pressure derivatives of the quantities
+    Matrix ddP;
+
+    /// Resize the matrices of the values and derivatives
+    auto resize(Index n) -> void
+    {
+        val.resize(n, n);
+        ddT.resize(n, n);
+        ddP.resize(n, n);
+    }
+
+    /// Set the entry (i, j) of the matrices of the values and derivatives
+    auto set(Index i, Index j, const ThermoScalar& value) -> void
+    {
+        val(i, j) = value.val;
+        ddT(i, j) = value.ddT;
+        ddP(i, j) = value.ddP;
+    }
+};
+
+/// Calculate `amix = sum_ij x_i x_j a_ij` with its derivatives.
+/// The derivatives w.r.t. temperature, pressure and composition are calculated analytically
+/// with matrix-vector products, instead of accumulating chemical scalars entry by entry.
+auto mixing(const ThermoMatrix& a, const ChemicalVector& x, ChemicalScalar& amix) -> void
+{
+    // The vector (a + a')*x, with d(amix) = dx'*(a + a')*x + x'*da*x
+    const Vector s = a.val * x.val + a.val.transpose() * x.val;
+
+    amix.val = 0.5 * x.val.dot(s);
+    amix.ddT = x.ddT.dot(s) + x.val.dot(a.ddT * x.val);
+    amix.ddP = x.ddP.dot(s) + x.val.dot(a.ddP * x.val);
+    amix.ddn = s.transpose() * x.ddn;
+}
+
+/// Calculate `amix = sum_ij x_i x_j a_ij` and `abar_i = 2 sum_j x_j a_ij - amix` with their derivatives.
+auto mixing(const ThermoMatrix& a, const ChemicalVector& x, ChemicalScalar& amix, ChemicalVector& abar) -> void
+{
+    const Index n = x.val.size();
+
+    // Calculate amix and its derivatives
+    mixing(a, x, amix);
+
+    // Calculate the vector s = a*x and its derivatives
+    const Vector s = a.val * x.val;
+    const Vector sT = a.ddT * x.val + a.val * x.ddT;
+    const Vector sP = a.ddP * x.val + a.val * x.ddP;
+    const Matrix sn = a.val * x.ddn;
+
+    // Calculate abar = 2*s - amix and its derivatives
+    abar.val = 2.0*s - amix.val * ones(n);
+    abar.ddT = 2.0*sT - amix.ddT * ones(n);
+    abar.ddP = 2.0*sP - amix.ddP * ones(n);
+    abar.ddn = 2.0*sn;
+    abar.ddn.rowwise() -= amix.ddn;
+}
+
 } // namespace internal
 
 struct CubicEOS::Impl
@@ -185,6 +250,18 @@ struct CubicEOS::Impl
     /// The result with thermodynamic properties calculated from the cubic equation of state
     Result result;
 
+    /// The boolean flag that indicates if the cached temperature-dependent mixing parameters below are up-to-date
+    bool mixing_cached = false;
+
+    /// The temperature at which the cached mixing parameters were calculated
+    ThermoScalar mixing_T;
+
+    /// The parameters `b` of the cubic equation of state for each species
+    Vector b;
+
+    /// The binary attractive parameters `a_ij` and their first and second temperature derivatives
+    internal::ThermoMatrix aij, aijT, aijTT;
+
     /// Construct a CubicEOS::Impl instance.
     Impl(unsigned nspecies)
     : nspecies(nspecies)
@@ -205,18 +282,16 @@ struct CubicEOS::Impl
         result.ln_fugacity_coefficients = vec;
     }
 
-    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    /// Update the temperature-dependent mixing parameters, unless they were already calculated at the given temperature
+    auto updateMixingParams(const ThermoScalar& T) -> void
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.val.size() == 0 || min(x.val) <= 0.0)
-            return Result(nspecies); // result with zero values
+        if(mixing_cached && T.val == mixing_T.val && T.ddT == mixing_T.ddT && T.ddP == mixing_T.ddP)
+            return;
 
         // Auxiliary variables
         const double R = universalGasConstant;
         const double Psi = internal::Psi(model);
         const double Omega = internal::Omega(model);
-        const double epsilon = internal::epsilon(model);
-        const double sigma = internal::sigma(model);
         const auto alpha = internal::alpha(model);
 
         // Calculate the parameters `a` of the cubic equation of state for each species
@@ -238,7 +313,7 @@ struct CubicEOS::Impl
         };
 
         // Calculate the parameters `b` of the cubic equation of state for each species
-        Vector b(nspecies);
+        b.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             const double Tci = critical_temperatures[i];
@@ -252,12 +327,11 @@ struct CubicEOS::Impl
 
         if(calculate_interaction_params)
             kres = calculate_interaction_params(kargs);
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        ChemicalScalar amix(nspecies);
-        ChemicalScalar amixT(nspecies);
-        ChemicalScalar amixTT(nspecies);
-        ChemicalVector abar(nspecies);
-        ChemicalVector abarT(nspecies);
+
+        // Calculate the binary attractive parameters `a_ij` and their temperature derivatives
+        aij.resize(nspecies);
+        aijT.resize(nspecies);
+        aijTT.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             for(unsigned j = 0; j < nspecies; ++j)
@@ -270,36 +344,47 @@ struct CubicEOS::Impl
                 const ThermoScalar sT = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 const ThermoScalar sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                const ThermoScalar aij = r*s;
-                const ThermoScalar aijT = rT*s + r*sT;
-                const ThermoScalar aijTT = rTT*s + 2.0*rT*sT + r*sTT;
-
-                amix += x[i] * x[j] * aij;
-                amixT += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
-
-                abar[i] += 2 * x[j] * aij;
-                abarT[i] += 2 * x[j] * aijT;
+                aij.set(i, j, r*s);
+                aijT.set(i, j, rT*s + r*sT);
+                aijTT.set(i, j, rTT*s + 2.0*rT*sT + r*sTT);
             }
         }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
-        }
+        mixing_T = T;
+        mixing_cached = true;
+    }
+
+    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    {
+        // Check if the mole fractions are zero or non-initialized
+        if(x.val.size() == 0 || min(x.val) <= 0.0)
+            return Result(nspecies); // result with zero values
+
+        // Auxiliary variables
+        const double R = universalGasConstant;
+        const double epsilon = internal::epsilon(model);
+        const double sigma = internal::sigma(model);
+
+        // Update the temperature-dependent parameters `a_ij` and `b` if temperature has changed
+        updateMixingParams(T);
+
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
+        ChemicalScalar amix(nspecies);
+        ChemicalScalar amixT(nspecies);
+        ChemicalScalar amixTT(nspecies);
+        ChemicalVector abar(nspecies);
+        ChemicalVector abarT(nspecies);
+        internal::mixing(aij, x, amix, abar);
+        internal::mixing(aijT, x, amixT, abarT);
+        internal::mixing(aijTT, x, amixTT);
 
         // Calculate the parameter `bmix` of the cubic equation of state
+        const Vector& bbar = b;
         ChemicalScalar bmix(nspecies);
-        Vector bbar(nspecies);
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            const double Tci = critical_temperatures[i];
-            const double Pci = critical_pressures[i];
-            bbar[i] = Omega*R*Tci/Pci;
-            bmix += x[i] * bbar[i];
-        }
+        bmix.val = x.val.dot(bbar);
+        bmix.ddT = x.ddT.dot(bbar);
+        bmix.ddP = x.ddP.dot(bbar);
+        bmix.ddn = bbar.transpose() * x.ddn;
 
         // Calculate the temperature derivative of `bmix`
         const double bmixT = 0.0; // no temperature dependence
@@ -521,6 +606,7 @@ auto CubicEOS::numSpecies() const -> unsigned
 auto CubicEOS::setModel(Model model) -> void
 {
     pimpl->model = model;
+    pimpl->mixing_cached = false;
 }
 
 auto CubicEOS::setPhaseAsLiquid() -> void
@@ -545,6 +631,7 @@ auto CubicEOS::setCriticalTemperatures(const std::vector<double>& values) -> voi
         "temperatures of the gases.");
 
     pimpl->critical_temperatures = values;
+    pimpl->mixing_cached = false;
 }
 
 auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
@@ -559,6 +646,7 @@ auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
         "pressures of the gases.");
 
     pimpl->critical_pressures = values;
+    pimpl->mixing_cached = false;
 }
 
 auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
@@ -569,11 +657,13 @@ auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
         std::to_string(values.size()) + " values were given.");
 
     pimpl->acentric_factors = values;
+    pimpl->mixing_cached = false;
 }
 
 auto CubicEOS::setInteractionParamsFunction(const InteractionParamsFunction& func) -> void
 {
     pimpl->calculate_interaction_params = func;
+    pimpl->mixing_cached = false;
 }
 
 auto CubicEOS::operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
@@ -22,6 +22,7 @@
 
 // Eigen includes
 #include <Reaktoro/deps/eigen3/Eigen/LU>
+#include <Reaktoro/deps/eigen3/Eigen/SparseCore>
 
 // Reaktoro includes
 #include <Reaktoro/Common/ConvertUtils.hpp>
@@ -35,6 +36,7 @@
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/Reaction.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/ThermoProperties.hpp>
 #include <Reaktoro/Core/Utils.hpp>
@@ -525,4 +527,203 @@ auto createReaction(const MineralReaction& mineralrxn, const ChemicalSystem& sys
     return reaction;
 }
 
+auto createReactionRates(const std::vector<MineralReaction>& mineralrxns, const ReactionSystem& reactionsys) -> ReactionRateVectorFunction
+{
+    Assert(mineralrxns.size() == reactionsys.numReactions(),
+        "Cannot create the rate function of the mineral reactions.",
+        "The number of mineral reactions does not match the number of reactions in the reaction system.");
+
+    // The chemical system instance
+    const ChemicalSystem& system = reactionsys.system();
+
+    // The universal gas constant (in units of kJ/(mol*K))
+    const double R = 8.3144621e-3;
+
+    // The number of species and reactions
+    const Index num_species = system.numSpecies();
+    const Index num_reactions = mineralrxns.size();
+
+    // The reaction system used for the ln equilibrium constants and ln reaction quotients
+    // Note: this is a new instance without rate function to prevent a cyclic reference
+    const ReactionSystem base(system, reactionsys.reactions());
+
+    // The indices of the minerals in the reactions
+    Indices iminerals(num_reactions);
+
+    // The surface areas of the minerals (in units of m2), or their molar surface areas (in units of m2/mol)
+    Vector areas(num_reactions);
+
+    // The indices of the reactions whose surface areas are proportional to the amounts of their minerals
+    Indices imolar;
+
+    // The parameters of the mechanisms of all reactions
+    std::vector<Eigen::Triplet<double>> mtriplets;
+    std::vector<double> kappa0, Ea, p, q;
+
+    // The activity catalysts of the mechanisms (mechanism, species, power)
+    std::vector<Eigen::Triplet<double>> atriplets;
+
+    // The partial pressure catalysts of the mechanisms
+    struct PartialPressureCatalyst { Index imechanism, igas; double power; };
+    std::vector<PartialPressureCatalyst> pcatalysts;
+
+    // The index of the first gaseous species and the number of gaseous species
+    Index ifirstgas = 0, num_gases = 0;
+
+    for(Index j = 0; j < num_reactions; ++j)
+    {
+        const MineralReaction& mineralrxn = mineralrxns[j];
+
+        iminerals[j] = system.indexSpeciesWithError(mineralrxn.mineral());
+
+        if(mineralrxn.surfaceArea())
+            areas[j] = mineralrxn.surfaceArea();
+        else
+        {
+            areas[j] = molarSurfaceArea(mineralrxn, system);
+            imolar.push_back(j);
+        }
+
+        for(const MineralMechanism& mechanism : mineralrxn.mechanisms())
+        {
+            const Index m = kappa0.size();
+            mtriplets.emplace_back(m, j, 1.0);
+            kappa0.push_back(mechanism.kappa);
+            Ea.push_back(mechanism.Ea);
+            p.push_back(mechanism.p);
+            q.push_back(mechanism.q);
+
+            for(const MineralCatalyst& catalyst : mechanism.catalysts)
+            {
+                if(catalyst.quantity == "a" || catalyst.quantity == "activity")
+                    atriplets.emplace_back(m, system.indexSpeciesWithError(catalyst.species), catalyst.power);
+                else
+                {
+                    const Index iphase = system.indexPhase("Gaseous");
+                    const auto gases = names(system.phase(iphase).species());
+                    ifirstgas = system.indexFirstSpeciesInPhase(iphase);
+                    num_gases = gases.size();
+                    pcatalysts.push_back({m, index(catalyst.species, gases), catalyst.power});
+                }
+            }
+        }
+    }
+
+    // The number of mechanisms of all reactions
+    const Index num_mechanisms = kappa0.size();
+
+    // The matrix that maps the reactions to their mechanisms
+    Eigen::SparseMatrix<double, Eigen::RowMajor> E(num_mechanisms, num_reactions);
+    E.setFromTriplets(mtriplets.begin(), mtriplets.end());
+
+    // The matrix that sums the mechanism contributions of each reaction
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> Et = E.transpose();
+
+    // The matrix of the activity catalyst powers of the mechanisms
+    Eigen::SparseMatrix<double, Eigen::RowMajor> C(num_mechanisms, num_species);
+    C.setFromTriplets(atriplets.begin(), atriplets.end());
+
+    // The mechanism parameters as vectors
+    const Vector vkappa0 = Vector::Map(kappa0.data(), num_mechanisms);
+    const Vector vEa = Vector::Map(Ea.data(), num_mechanisms);
+    const Vector vp = Vector::Map(p.data(), num_mechanisms);
+    const Vector vq = Vector::Map(q.data(), num_mechanisms);
+
+    // Auxiliary variables reused among evaluations
+    ChemicalVector lnOmega(num_mechanisms, num_species);
+    ChemicalVector f(num_mechanisms, num_species);
+    ChemicalVector g(num_mechanisms, num_species);
+    ChemicalVector h(num_mechanisms, num_species);
+    ChemicalVector r(num_reactions, num_species);
+    Vector kappa, dkappadT, pOmega, qOmega, dqOmega, A;
+
+    ReactionRateVectorFunction fn = [=](const ChemicalProperties& properties) mutable
+    {
+        // The temperature and pressure of the system
+        const double T = properties.temperature();
+        const double P = properties.pressure();
+
+        // The amounts of the species in the system
+        VectorConstRef n = properties.composition().val;
+
+        // Calculate the ln saturation indices of the reactions and map them to the mechanisms
+        const ChemicalVector lnOmegar = base.lnReactionQuotients(properties) - base.lnEquilibriumConstants(properties);
+        lnOmega.val = E * lnOmegar.val;
+        lnOmega.ddT = E * lnOmegar.ddT;
+        lnOmega.ddP = E * lnOmegar.ddP;
+        lnOmega.ddn = E * lnOmegar.ddn;
+
+        // Calculate the rate constants of the mechanisms and their temperature derivatives
+        kappa = vkappa0.array() * (-vEa.array()/R * (1.0/T - 1.0/298.15)).exp();
+        dkappadT = kappa.array() * vEa.array()/(R*T*T);
+
+        // Calculate (1 - Omega^p)^q and its derivative with respect to ln Omega
+        pOmega = (vp.array() * lnOmega.val.array()).exp();
+        qOmega = (1.0 - pOmega.array()).pow(vq.array());
+        dqOmega = -vq.array() * (1.0 - pOmega.array()).pow(vq.array() - 1.0) * vp.array() * pOmega.array();
+
+        // Calculate the functions f = kappa * (1 - Omega^p)^q of the mechanisms
+        f.val = kappa.array() * qOmega.array();
+        f.ddT = dkappadT.array() * qOmega.array() + kappa.array() * dqOmega.array() * lnOmega.ddT.array();
+        f.ddP = kappa.array() * dqOmega.array() * lnOmega.ddP.array();
+        f.ddn = diag(Vector(kappa.array() * dqOmega.array())) * lnOmega.ddn;
+
+        // Calculate the functions g of the mechanisms as the products of the activity catalysts
+        const ChemicalVectorConstRef ln_a = properties.lnActivities();
+        g.val = (C * ln_a.val).array().exp();
+        g.ddT = g.val.array() * (C * ln_a.ddT).array();
+        g.ddP = g.val.array() * (C * ln_a.ddP).array();
+        g.ddn = diag(g.val) * (C * ln_a.ddn);
+
+        // Multiply the functions g by the partial pressure catalysts
+        for(const PartialPressureCatalyst& catalyst : pcatalysts)
+        {
+            const Index m = catalyst.imechanism;
+            const double ngsum = n.segment(ifirstgas, num_gases).sum();
+            const double xi = n[ifirstgas + catalyst.igas]/ngsum;
+            const double Pbar = convertPascalToBar(P);
+            const double v = std::pow(xi * Pbar, catalyst.power);
+            const double dvdxi = catalyst.power * std::pow(xi * Pbar, catalyst.power - 1.0) * Pbar;
+            const double dvdP = catalyst.power * std::pow(xi * Pbar, catalyst.power - 1.0) * xi * convertPascalToBar(1.0);
+            g.ddT[m] *= v;
+            g.ddP[m] = g.ddP[m] * v + g.val[m] * dvdP;
+            g.ddn.row(m) *= v;
+            g.ddn.row(m).segment(ifirstgas, num_gases).array() -= g.val[m] * dvdxi * xi/ngsum;
+            g.ddn(m, ifirstgas + catalyst.igas) += g.val[m] * dvdxi/ngsum;
+            g.val[m] *= v;
+        }
+
+        // Calculate the mechanism functions h = f * g
+        h.val = f.val.array() * g.val.array();
+        h.ddT = f.ddT.array() * g.val.array() + f.val.array() * g.ddT.array();
+        h.ddP = f.ddP.array() * g.val.array() + f.val.array() * g.ddP.array();
+        h.ddn = diag(g.val) * f.ddn + diag(f.val) * g.ddn;
+
+        // Sum the mechanism contributions of each reaction
+        r.val = Et * h.val;
+        r.ddT = Et * h.ddT;
+        r.ddP = Et * h.ddP;
+        r.ddn = Et * h.ddn;
+
+        // Calculate the surface areas of the minerals
+        // Note: negative mole numbers are prevented here for the solution of the ODEs
+        A = areas;
+        for(Index j : imolar)
+            A[j] *= std::max(n[iminerals[j]], 0.0);
+
+        // Multiply the mechanism contributions by the surface areas of the minerals
+        ChemicalVector res(num_reactions, num_species);
+        res.val = A.array() * r.val.array();
+        res.ddT = A.array() * r.ddT.array();
+        res.ddP = A.array() * r.ddP.array();
+        res.ddn = diag(A) * r.ddn;
+        for(Index j : imolar)
+            res.ddn(j, iminerals[j]) += areas[j] * r.val[j];
+
+        return res;
+    };
+
+    return fn;
+}
+
 } // namespace Reaktoro
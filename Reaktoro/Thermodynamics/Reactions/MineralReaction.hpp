@@ -24,6 +24,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/ScalarTypes.hpp>
+#include <Reaktoro/Core/Reaction.hpp>
 #include <Reaktoro/Thermodynamics/Reactions/MineralCatalyst.hpp>
 #include <Reaktoro/Thermodynamics/Reactions/MineralMechanism.hpp>
 
@@ -33,6 +34,7 @@ namespace Reaktoro {
 class ChemicalSystem;
 class Reaction;
 class ReactionEquation;
+class ReactionSystem;
 
 class MineralReaction
 {
@@ -121,4 +123,12 @@ private:
 
 auto createReaction(const MineralReaction& reaction, const ChemicalSystem& system) -> Reaction;
 
+/// Create a function that calculates the rates of given mineral reactions at once.
+/// The mechanisms of all mineral reactions are evaluated with vectorized operations
+/// instead of one rate function per reaction. The returned function is meant to be
+/// set in the reaction system with ReactionSystem::setRates.
+/// @param reactions The mineral reactions, in the same order as in the reaction system
+/// @param reactionsys The reaction system created from the mineral reactions
+auto createReactionRates(const std::vector<MineralReaction>& reactions, const ReactionSystem& reactionsys) -> ReactionRateVectorFunction;
+
 } // namespace Reaktoro
@@ -22,6 +22,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 
 namespace Reaktoro {
@@ -82,6 +83,12 @@ auto ChemicalField::elementAmounts(VectorRef values) -> void
         values.segment(offset, num_elements) = m_states[i].elementAmounts();
 }
 
+auto ChemicalField::values(StringList quantities) const -> Matrix
+{
+    ChemicalQuantity quantity(m_system);
+    return quantity.values(quantities, m_states);
+}
+
 auto ChemicalField::output(std::string filename, StringList quantities) -> void
 {
     ChemicalOutput out(m_system);
@@ -89,6 +96,10 @@ auto ChemicalField::output(std::string filename, StringList quantities) -> void
     for(auto quantity : quantities)
         out.add(quantity);
 
+    out.open();
+    for(Index i = 0; i < size(); ++i)
+        out.update(m_states[i], i);
+    out.close();
 }
 
 auto TridiagonalMatrix::resize(Index size) -> void
@@ -88,6 +88,11 @@ public:
 
     auto elementAmounts(VectorRef values) -> void;
 
+    /// Return the values of given quantities at every chemical state in the field.
+    /// @return The matrix of values, with one row per degree of freedom and one column per quantity
+    auto values(StringList quantities) const -> Matrix;
+
+    /// Output given quantities at every chemical state in the field to a file.
     auto output(std::string filename, StringList quantities) -> void;
 
 private:
@@ -14,630 +14,676 @@
 //
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
-//
-//#include "ChemicalSolver.hpp"
-//
-//// C++ includes
-//#include <vector>
-//
-//// Reaktoro includes
-//#include <Reaktoro/Common/Exception.hpp>
-//#include <Reaktoro/Core/ChemicalProperties.hpp>
-//#include <Reaktoro/Core/ChemicalState.hpp>
-//#include <Reaktoro/Core/ChemicalSystem.hpp>
-//#include <Reaktoro/Core/Partition.hpp>
-//#include <Reaktoro/Core/ReactionSystem.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
-//#include <Reaktoro/Kinetics/KineticSolver.hpp>
-//#include <Reaktoro/Util/ChemicalField.hpp>
-//
-//namespace Reaktoro {
-//
-//struct ChemicalSolver::Impl
-//{
-//    /// The chemical system instance
-//    ChemicalSystem system;
-//
-//    /// The reaction system instance
-//    ReactionSystem reactions;
-//
-//    /// The number of field points
-//    Index npoints;
-//
-//    /// The partitioning of the chemical system
-//    Partition partition;
-//
-//    /// The number of species and elements in the system
-//    Index N, E;
-//
-//    /// The number of species and elements in the equilibrium partition
-//    Index Ne, Ee, Nk, Nfp;
-//
-//    /// The number of components
-//    Index Nc;
-//
-//    /// The chemical states at each point in the field
-//    std::vector<ChemicalState> states;
-//
-//    /// The chemical properties at each point in the field
-//    std::vector<ChemicalProperties> properties;
-//
-//    /// The equilibrium solver
-//    EquilibriumSolver equilibriumsolver;
-//
-//    /// The kinetic solver
-//    KineticSolver kineticsolver;
-//
-//    /// The equilibrium sensitivity at every field point
-//    std::vector<EquilibriumSensitivity> sensitivities;
-//
-//    /// The molar amounts of the chemical components at every field point
-//    std::vector<Vector> c;
-//
-//    /// The kinetic rates of the chemical components and their derivatives at every field point (in units of mol/s)
-//    std::vector<ChemicalField> rc;
-//
-//    /// The molar amounts of equilibrium species and their derivatives at every field point
-//    std::vector<ChemicalField> ne;
-//
-//    /// The porosity at every field point and their derivatives
-//    ChemicalField porosity;
-//
-//    /// The saturations of the fluid phases and their derivatives at every field point
-//    std::vector<ChemicalField> fluid_saturations;
-//
-//    /// The densities of the fluid phases and their derivatives at every field point (in units of kg/m3)
-//    std::vector<ChemicalField> fluid_densities;
-//
-//    /// The volumes of the fluid phases and their derivatives at every field point (in units of m3)
-//    std::vector<ChemicalField> fluid_volumes;
-//
-//    /// The total volume of the fluid phases and their derivatives at every field point (in units of m3)
-//    ChemicalField fluid_total_volume;
-//
-//    /// The total volume of the solid phases and their derivatives at every field point (in units of m3)
-//    ChemicalField solid_total_volume;
-//
-//    /// Construct a default Impl instance
-//    Impl()
-//    {}
-//
-//    /// Construct a custom Impl instance with given chemical system
-//    Impl(const ChemicalSystem& system, Index npoints)
-//    : system(system),
-//      npoints(npoints),
-//      states(npoints, ChemicalState(system)),
-//      properties(npoints),
-//      equilibriumsolver(system)
-//    {
-//        setPartition(Partition(system));
-//    }
-//
-//    /// Construct a custom Impl instance with given reaction system
-//    Impl(const ReactionSystem& reactions, Index npoints)
-//    : system(reactions.system()),
-//      reactions(reactions),
-//      npoints(npoints),
-//      states(npoints, ChemicalState(system)),
-//      properties(npoints),
-//      equilibriumsolver(system),
-//      kineticsolver(reactions)
-//    {
-//        // Initialize the number of species and elements in the system
-//        N = system.numSpecies();
-//        E = system.numElements();
-//
-//        // Initialize the default partition of the chemical system
-//        setPartition(Partition(system));
-//    }
-//
-//    /// Set the partition of the chemical system
-//    auto setPartition(const Partition& partition_) -> void
-//    {
-//        // Set the partition of the chemical solver
-//        partition = partition_;
-//
-//        // Initialize the number-type variables
-//        Ne  = partition.numEquilibriumSpecies();
-//        Nk  = partition.numKineticSpecies();
-//        Nfp = partition.numFluidPhases();
-//        Ee  = partition.numEquilibriumElements();
-//        Nc  = Ee + Nk;
-//
-//        // Set the partition of the equilibrium and kinetic solvers
-//        if(Ne) equilibriumsolver.setPartition(partition);
-//        if(Nk) kineticsolver.setPartition(partition);
-//
-//        // Initialize the sensitivities member
-//        sensitivities.resize(npoints);
-//    }
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Array<double> b) -> void
-//    {
-//        Assert(T.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of temperature values as there are field points.");
-//
-//        Assert(P.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of pressure values as there are field points.");
-//
-//        Assert(b.size == npoints * Ee,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting, for each equilibrium element, the same number of amount "
-//            "values as there are field points.");
-//
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            const auto Tk = T.data[k];
-//            const auto Pk = P.data[k];
-//            const auto bk = b.data + k*Ee;
-//            equilibriumsolver.solve(states[k], Tk, Pk, bk);
-//            properties[k] = states[k].properties();
-//            sensitivities[k] = equilibriumsolver.sensitivity();
-//        }
-//    }
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Grid<double> b) -> void
-//    {
-//        Assert(T.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of temperature values as there are field points.");
-//
-//        Assert(P.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of pressure values as there are field points.");
-//
-//        Assert(b.rows == Ee && b.cols == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting, for each equilibrium element, the same number of amount "
-//            "values as there are field points.");
-//
-//        Vector bk(Ee);
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            const auto Tk  = T.data[k];
-//            const auto Pk  = P.data[k];
-//            for(Index j = 0; j < Ee; ++j)
-//                bk[j] = b.data[j][k];
-//            equilibriumsolver.solve(states[k], Tk, Pk, bk);
-//            properties[k] = states[k].properties();
-//            sensitivities[k] = equilibriumsolver.sensitivity();
-//        }
-//    }
-//
-//    /// React the chemical state at every field point.
-//    auto react(double t, double dt) -> void
-//    {
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            kineticsolver.solve(states[k], t, dt);
-//            properties[k] = states[k].properties();
-//        }
-//    }
-//
-//    /// Update the molar amounts of the chemical components at every field point.
-//    auto updateComponentAmounts() -> void
-//    {
-//        // Check if member `c` is initialized
-//        if(c.size() != Nc)
-//            c.resize(Nc, Vector(npoints));
-//
-//        // The indices of the equilibrium elements and kinetic species
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//        const Indices& iee = partition.indicesEquilibriumElements();
-//        const Indices& iks = partition.indicesKineticSpecies();
-//
-//        // The molar amounts of elements in the equilibrium species
-//        Vector bes(E);
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the molar amounts of all species
-//            VectorConstRef n = states[k].speciesAmounts();
-//
-//            // Calculate the molar amounts of the elements in the equilibrium species
-//            bes = states[k].elementAmountsInSpecies(ies);
-//
-//            // Loop over all equilibrium elements
-//            for(Index j = 0; j < Ee; ++j)
-//                c[j][k] = bes[iee[j]];
-//
-//            // Loop over all kinetic species
-//            for(Index i = 0; i < Nk; ++i)
-//                c[i + Ee][k] = n[iks[i]];
-//        }
-//    }
-//
-//    /// Update the molar amounts of the equilibrium species and their derivatives at every field point.
-//    auto updateEquilibriumSpeciesAmounts() -> void
-//    {
-//        // Check if member `ne` is initialized
-//        if(ne.size() != Ne)
-//            ne.resize(Ne, ChemicalField(partition, npoints));
-//
-//        // The indices of the equilibrium species
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Loop over all equilibrium species
-//            for(Index i = 0; i < Ne; ++i)
-//            {
-//                // Set the molar amount of the current equilibrium species
-//                ne[i].val()[k] = states[k].speciesAmount(ies[i]);
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. temperature
-//                ne[i].ddT()[k] = sensitivities[k].dnedT[i];
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. pressure
-//                ne[i].ddP()[k] = sensitivities[k].dnedP[i];
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. molar amount of each equilibrium element
-//                for(Index j = 0; j < Ee; ++j)
-//                    ne[i].ddbe()[j][k] = sensitivities[k].dnedbe(i, j);
-//            }
-//        }
-//    }
-//
-//    /// Update the porosity and their derivatives at every field point.
-//    auto updatePorosity() -> void
-//    {
-//        // Check if member `porosity` is initialized
-//        if(!porosity.size())
-//            porosity = ChemicalField(partition, npoints);
-//
-//        // The porosity
-//        ChemicalScalar phi;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate porosity at current field point
-//            phi = 1.0 - properties[k].solidVolume();
-//            porosity.set(k, phi, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Get the saturation of each fluid phase at every field point.
-//    auto updateFluidSaturations() -> void
-//    {
-//        // Check if member `fluid_saturations` is initialized
-//        if(fluid_saturations.size() != Nfp)
-//            fluid_saturations.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The volumes of the fluid phases and their saturations
-//        ChemicalVector fluid_volumes, fluid_saturation;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the volumes of the fluid phases
-//            fluid_volumes = rows(properties[k].phaseVolumes(), ifp);
-//
-//            // Compute the saturation of all fluid phases
-//            fluid_saturation = fluid_volumes/sum(fluid_volumes);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_saturations[j].set(k, fluid_saturation[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Get the density of each fluid phase at every field point.
-//    auto updateFluidDensities() -> void
-//    {
-//        // Check if member `fluid_densities` is initialized
-//        if(fluid_densities.size() != Nfp)
-//            fluid_densities.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The densities of all phases at a field point
-//        ChemicalVector rho;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the densities of all phases
-//            rho = rows(properties[k].phaseDensities(), ifp);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_densities[j].set(k, rho[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the volumes of each fluid phase at every field point.
-//    auto updateFluidVolumes() -> void
-//    {
-//        // Check if member `fluid_volumes` is initialized
-//        if(fluid_volumes.size() != Nfp)
-//            fluid_volumes.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The volumes of all fluid phases
-//        ChemicalVector volumes;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the volumes of all phases
-//            volumes = rows(properties[k].phaseVolumes(), ifp);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_volumes[j].set(k, volumes[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the total volume of the fluid phases at every field point.
-//    auto updateFluidTotalVolume() -> void
-//    {
-//        // Check if member `fluid_total_volume` is initialized
-//        if(!fluid_total_volume.size())
-//            fluid_total_volume = ChemicalField(partition, npoints);
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The total fluid volume at a field point
-//        ChemicalScalar total_volume;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate the total fluid volume at current field point
-//            total_volume = sum(rows(properties[k].phaseVolumes(), ifp));
-//            fluid_total_volume.set(k, total_volume, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the total volume of the solid phases at every field point.
-//    auto updateSolidTotalVolume() -> void
-//    {
-//        // Check if member `solid_total_volume` is initialized
-//        if(!solid_total_volume.size())
-//            solid_total_volume = ChemicalField(partition, npoints);
-//
-//        // The indices of the solid phases
-//        const Indices& isp = partition.indicesSolidPhases();
-//
-//        // The total solid volume at a field point
-//        ChemicalScalar total_volume;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate the total solid volume at current field point
-//            total_volume = sum(rows(properties[k].phaseVolumes(), isp));
-//            solid_total_volume.set(k, total_volume, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the kinetic rates of the chemical components at every field point.
-//    auto updateComponentRates() -> void
-//    {
-//        // Check if member `rc` is initialized
-//        if(rc.size() != Nc)
-//            rc.resize(Nc, ChemicalField(partition, npoints));
-//
-//        // Skip the calculation if there are no reactions
-//        if(reactions.numReactions() == 0)
-//            return;
-//
-//        // The indices of the elements and species in the equilibrium partition
-//        const Indices& iee = partition.indicesEquilibriumElements();
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//
-//        // The indices of the species in the kinetic partition
-//        const Indices& iks = partition.indicesKineticSpecies();
-//
-//        // The formula matrix w.r.t. the species and elements in the equilibrium partition
-//        const Matrix We = submatrix(system.formulaMatrix(), iee, ies);
-//
-//        // The stoichiometric matrices w.r.t. the equilibrium and kinetic species
-//        const Matrix Se = cols(reactions.stoichiometricMatrix(), ies);
-//        const Matrix Sk = cols(reactions.stoichiometricMatrix(), iks);
-//
-//        // Initialise the coefficient matrix `A` of the chemical kinetics problem
-//        Matrix A(Ee + Nk, reactions.numReactions());
-//        A.topRows(Ee) = We * tr(Se);
-//        A.bottomRows(Nk) = tr(Sk);
-//
-//        ChemicalVector rates, r;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            r = reactions.rates(properties[k]);
-//
-//            rates.val = A * r.val;
-//            rates.ddT = A * r.ddT;
-//            rates.ddP = A * r.ddP;
-//            rates.ddn = A * r.ddn;
-//
-//            // Loop over all equilibrium elements
-//            for(Index j = 0; j < Ee; ++j)
-//                rc[j].set(k, rates[j], sensitivities[k]);
-//
-//            // Loop over all kinetic species
-//            for(Index i = 0; i < Nk; ++i)
-//                rc[i + Ee].set(k, rates[i + Ee], sensitivities[k]);
-//        }
-//    }
-//};
-//
-//ChemicalSolver::ChemicalSolver()
-//: pimpl(new Impl())
-//{}
-//
-//ChemicalSolver::ChemicalSolver(const ChemicalSystem& system, Index npoints)
-//: pimpl(new Impl(system, npoints))
-//{}
-//
-//ChemicalSolver::ChemicalSolver(const ReactionSystem& reactions, Index npoints)
-//: pimpl(new Impl(reactions, npoints))
-//{}
-//
-//auto ChemicalSolver::numPoints() const -> Index
-//{
-//    return pimpl->npoints;
-//}
-//
-//auto ChemicalSolver::numEquilibriumElements() const -> Index
-//{
-//    return pimpl->Ee;
-//}
-//
-//auto ChemicalSolver::numKineticSpecies() const -> Index
-//{
-//    return pimpl->Nk;
-//}
-//
-//auto ChemicalSolver::numComponents() const -> Index
-//{
-//    return pimpl->Nc;
-//}
-//
-//auto ChemicalSolver::setPartition(const Partition& partition) -> void
-//{
-//    pimpl->setPartition(partition);
-//}
-//
-//auto ChemicalSolver::setStates(const ChemicalState& state) -> void
-//{
-//    for(Index k = 0; k < pimpl->npoints; ++k)
-//        pimpl->states[k] = state;
-//}
-//
-//auto ChemicalSolver::setStates(const Array<ChemicalState>& states) -> void
-//{
-//    Assert(states.size == pimpl->npoints,
-//        "Could not set the chemical states at every field point.",
-//        "Expecting the same number of chemical states as there are field points.");
-//    for(Index k = 0; k < states.size; ++k)
-//        pimpl->states[k] = states.data[k];
-//}
-//
-//auto ChemicalSolver::setStateAt(Index ipoint, const ChemicalState& state) -> void
-//{
-//    Assert(ipoint < pimpl->npoints,
-//        "Could not set the chemical state at given field point.",
-//        "Expecting a field point index smaller than the number of field points.");
-//    pimpl->states[ipoint] = state;
-//}
-//
-//auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void
-//{
-//    Assert(ipoints.size < pimpl->npoints,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting field point indices smaller than the number of field points.");
-//    for(Index k = 0; k < ipoints.size; ++k)
-//        setStateAt(ipoints.data[k], state);
-//}
-//
-//auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void
-//{
-//    Assert(ipoints.size < pimpl->npoints,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting field point indices smaller than the number of field points.");
-//    Assert(ipoints.size == states.size,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting the same number of field point indices and chemical states.");
-//    for(Index k = 0; k < ipoints.size; ++k)
-//        setStateAt(ipoints.data[k], states.data[k]);
-//}
-//
-//auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void
-//{
-//    pimpl->equilibrate(T, P, be);
-//}
-//
-//auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void
-//{
-//    pimpl->equilibrate(T, P, be);
-//}
-//
-//auto ChemicalSolver::react(double t, double dt) -> void
-//{
-//    pimpl->react(t, dt);
-//}
-//
-//auto ChemicalSolver::state(Index i) const -> const ChemicalState&
-//{
-//    return pimpl->states[i];
-//}
-//
-//auto ChemicalSolver::states() const -> const std::vector<ChemicalState>&
-//{
-//    return pimpl->states;
-//}
-//
-//auto ChemicalSolver::componentAmounts() -> const std::vector<Vector>&
-//{
-//    pimpl->updateComponentAmounts();
-//    return pimpl->c;
-//}
-//
-//auto ChemicalSolver::equilibriumSpeciesAmounts() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateEquilibriumSpeciesAmounts();
-//    return pimpl->ne;
-//}
-//
-//auto ChemicalSolver::porosity() -> const ChemicalField&
-//{
-//    pimpl->updatePorosity();
-//    return pimpl->porosity;
-//}
-//
-//auto ChemicalSolver::fluidSaturations() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidSaturations();
-//    return pimpl->fluid_saturations;
-//}
-//
-//auto ChemicalSolver::fluidDensities() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidDensities();
-//    return pimpl->fluid_densities;
-//}
-//
-//auto ChemicalSolver::fluidVolumes() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidVolumes();
-//    return pimpl->fluid_volumes;
-//}
-//
-//auto ChemicalSolver::fluidTotalVolume() -> const ChemicalField&
-//{
-//    pimpl->updateFluidTotalVolume();
-//    return pimpl->fluid_total_volume;
-//}
-//
-//auto ChemicalSolver::solidTotalVolume() -> const ChemicalField&
-//{
-//    pimpl->updateSolidTotalVolume();
-//    return pimpl->solid_total_volume;
-//}
-//
-//auto ChemicalSolver::componentRates() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateComponentRates();
-//    return pimpl->rc;
-//}
-//
-//}  // namespace Reaktoro
+
+#include "ChemicalSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Kinetics/KineticSolver.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return a scalar field with zero values and derivatives.
+auto zerosScalarField(Index npoints, Index Ee, Index Nk) -> ScalarField
+{
+    ScalarField field;
+    field.val = zeros(npoints);
+    field.ddT = zeros(npoints);
+    field.ddP = zeros(npoints);
+    field.ddbe = zeros(Ee, npoints);
+    field.ddnk = zeros(Nk, npoints);
+    return field;
+}
+
+} // namespace
+
+struct ChemicalSolver::Impl
+{
+    /// The data and solvers used by a thread to process a subset of field points.
+    struct Worker
+    {
+        /// The chemical system of the worker
+        ChemicalSystem system;
+
+        /// The partition of the chemical system of the worker
+        Partition partition;
+
+        /// The reaction system of the worker
+        ReactionSystem reactions;
+
+        /// The equilibrium solver of the worker
+        EquilibriumSolver equilibrium;
+
+        /// The kinetic solver of the worker
+        std::unique_ptr<KineticSolver> kinetics;
+
+        /// The chemical state at the field point being processed
+        ChemicalState state;
+
+        /// The chemical properties at the field point being processed, if there are no equilibrium species
+        ChemicalProperties properties;
+
+        /// The equilibrium sensitivity at the field point being processed
+        EquilibriumSensitivity sensitivity;
+
+        /// The auxiliary vectors to avoid recurrent memory allocation
+        Vector scalar_ne, scalar_nk, be;
+
+        /// The auxiliary chemical vectors to avoid recurrent memory allocation
+        ChemicalVector rates, volumes;
+
+        /// The accumulated results of the calculations performed by the worker
+        ChemicalSolverResult result;
+
+        /// Construct a Worker instance with given chemical system
+        Worker(const ChemicalSystem& system)
+        : system(system), partition(system), state(system), properties(system)
+        {}
+    };
+
+    /// The chemical system instance
+    ChemicalSystem system;
+
+    /// The reaction system instance
+    ReactionSystem reactions;
+
+    /// The number of field points
+    Index npoints = 0;
+
+    /// The partitioning of the chemical system
+    Partition partition;
+
+    /// The options for the chemical calculations
+    ChemicalSolverOptions options;
+
+    /// The number of species and elements in the system
+    Index N = 0, E = 0;
+
+    /// The number of equilibrium species and elements, kinetic species, and fluid phases
+    Index Ne = 0, Ee = 0, Nk = 0, Nfp = 0;
+
+    /// The number of components
+    Index Nc = 0;
+
+    /// The indices of the equilibrium species and elements, and the kinetic species
+    Indices ies, iee, iks;
+
+    /// The indices of the fluid and solid phases
+    Indices ifp, isp;
+
+    /// The formula matrix of the equilibrium partition
+    Matrix Ae;
+
+    /// The matrix that maps the reaction rates to the rates of the chemical components
+    Matrix Ac;
+
+    /// The temperatures at every field point (in units of K)
+    Vector T;
+
+    /// The pressures at every field point (in units of Pa)
+    Vector P;
+
+    /// The amounts of the species at every field point (one column per point)
+    Matrix n;
+
+    /// The dual potentials of the elements at every field point (one column per point)
+    Matrix y;
+
+    /// The dual potentials of the species at every field point (one column per point)
+    Matrix z;
+
+    /// The molar amounts of the chemical components at every field point (one column per point)
+    Matrix c;
+
+    /// The kinetic rates of the chemical components and their derivatives at every field point (in units of mol/s)
+    std::vector<ScalarField> rc;
+
+    /// The molar amounts of equilibrium species and their derivatives at every field point
+    std::vector<ScalarField> ne;
+
+    /// The porosity at every field point and their derivatives
+    ScalarField porosity;
+
+    /// The saturations of the fluid phases and their derivatives at every field point
+    std::vector<ScalarField> fluid_saturations;
+
+    /// The densities of the fluid phases and their derivatives at every field point (in units of kg/m3)
+    std::vector<ScalarField> fluid_densities;
+
+    /// The volumes of the fluid phases and their derivatives at every field point (in units of m3)
+    std::vector<ScalarField> fluid_volumes;
+
+    /// The total volume of the fluid phases and their derivatives at every field point (in units of m3)
+    ScalarField fluid_total_volume;
+
+    /// The total volume of the solid phases and their derivatives at every field point (in units of m3)
+    ScalarField solid_total_volume;
+
+    /// The workers that process the field points, one for each thread
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// The flags that indicate if the last calculation at each field point succeeded
+    std::vector<char> succeeded;
+
+    /// The result of the last calculations at all field points
+    ChemicalSolverResult result;
+
+    /// Construct a default Impl instance
+    Impl()
+    {}
+
+    /// Construct a custom Impl instance with given chemical system
+    Impl(const ChemicalSystem& system, Index npoints)
+    : system(system), npoints(npoints)
+    {
+        initialize();
+    }
+
+    /// Construct a custom Impl instance with given reaction system
+    Impl(const ReactionSystem& reactions, Index npoints)
+    : system(reactions.system()), reactions(reactions), npoints(npoints)
+    {
+        initialize();
+    }
+
+    /// Initialize the arrays of the chemical states at every field point
+    auto initialize() -> void
+    {
+        // Initialize the number of species and elements in the system
+        N = system.numSpecies();
+        E = system.numElements();
+
+        // Initialize the chemical states at every field point
+        T = constants(npoints, 298.15);
+        P = constants(npoints, 1.0e5);
+        n = zeros(N, npoints);
+        y = zeros(E, npoints);
+        z = zeros(N, npoints);
+
+        // Initialize the default partition of the chemical system
+        setPartition(Partition(system));
+    }
+
+    /// Set the options for the chemical calculations
+    auto setOptions(const ChemicalSolverOptions& options_) -> void
+    {
+        options = options_;
+        workers.clear();
+    }
+
+    /// Set the partition of the chemical system
+    auto setPartition(const Partition& partition_) -> void
+    {
+        // Set the partition of the chemical solver
+        partition = partition_;
+
+        // Initialize the number-type variables
+        Ne  = partition.numEquilibriumSpecies();
+        Nk  = partition.numKineticSpecies();
+        Nfp = partition.numFluidPhases();
+        Ee  = partition.numEquilibriumElements();
+        Nc  = Ee + Nk;
+
+        // Initialize the indices of the equilibrium and kinetic species, and of the fluid and solid phases
+        ies = partition.indicesEquilibriumSpecies();
+        iee = partition.indicesEquilibriumElements();
+        iks = partition.indicesKineticSpecies();
+        ifp = partition.indicesFluidPhases();
+        isp = partition.indicesSolidPhases();
+
+        // Initialize the formula matrix of the equilibrium partition
+        Ae = partition.formulaMatrixEquilibriumPartition();
+
+        // Initialize the matrix that maps reaction rates to rates of the components
+        if(reactions.numReactions())
+        {
+            const Matrix We = submatrix(system.formulaMatrix(), iee, ies);
+            const Matrix Se = cols(reactions.stoichiometricMatrix(), ies);
+            const Matrix Sk = cols(reactions.stoichiometricMatrix(), iks);
+            Ac.resize(Nc, reactions.numReactions());
+            Ac.topRows(Ee) = We * tr(Se);
+            Ac.bottomRows(Nk) = tr(Sk);
+        }
+
+        // Initialize the arrays of the components and properties at every field point
+        const ScalarField zero = zerosScalarField(npoints, Ee, Nk);
+        c = zeros(Nc, npoints);
+        ne.assign(Ne, zero);
+        porosity = zero;
+        fluid_saturations.assign(Nfp, zero);
+        fluid_densities.assign(Nfp, zero);
+        fluid_volumes.assign(Nfp, zero);
+        fluid_total_volume = zero;
+        solid_total_volume = zero;
+        rc.assign(reactions.numReactions() ? Nc : 0, zero);
+
+        // The workers need to be recreated with the new partition
+        workers.clear();
+    }
+
+    /// Return the number of threads used to process the field points
+    auto numThreads() const -> Index
+    {
+        if(!system.hasReentrantModels())
+            return 1;
+        Index num_threads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, npoints));
+    }
+
+    /// Create a worker, with its own copy of the chemical system unless it is the first one
+    auto createWorker(bool first) -> std::unique_ptr<Worker>
+    {
+        std::unique_ptr<Worker> worker(new Worker(first ? system : system.clone()));
+        worker->partition = first ? partition : partition.clone(worker->system);
+        worker->reactions = first ? reactions : reactions.clone(worker->system);
+        worker->sensitivity.dndT = zeros(Ne);
+        worker->sensitivity.dndP = zeros(Ne);
+        worker->sensitivity.dndb = zeros(Ne, Ee);
+        if(Ne)
+        {
+            worker->equilibrium = EquilibriumSolver(worker->partition);
+            worker->equilibrium.setOptions(options.equilibrium);
+        }
+        if(Nk)
+        {
+            worker->kinetics.reset(new KineticSolver(worker->reactions));
+            worker->kinetics->setOptions(options.kinetics);
+            worker->kinetics->setPartition(worker->partition);
+        }
+        return worker;
+    }
+
+    /// Apply a function to every field point using all workers
+    template<typename Function>
+    auto parallel(Function f) -> void
+    {
+        // Create the workers if needed and reset their results
+        const Index num_threads = numThreads();
+        while(workers.size() < num_threads)
+            workers.push_back(createWorker(workers.empty()));
+        for(auto& worker : workers)
+            worker->result = {};
+
+        succeeded.assign(npoints, 1);
+
+        // The index of the next field point to be processed
+        std::atomic<Index> next(0);
+
+        // The first exception thrown by a worker, if any
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        // The function executed by each thread, in which field points are processed one at a time
+        auto run = [&](Worker& worker)
+        {
+            try {
+                for(Index k = next++; k < npoints; k = next++)
+                    f(worker, k);
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) error = std::current_exception();
+                next = npoints;
+            }
+        };
+
+        // Process the field points in the calling thread if a single thread is used
+        if(num_threads == 1)
+            run(*workers.front());
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for(Index i = 0; i < num_threads; ++i)
+                threads.emplace_back(run, std::ref(*workers[i]));
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        if(error)
+            std::rethrow_exception(error);
+
+        // Collect the failed field points and accumulate the results of the workers
+        result = {};
+        for(Index k = 0; k < npoints; ++k)
+            if(!succeeded[k])
+                result.failed.push_back(k);
+        for(auto& worker : workers)
+        {
+            result.equilibrium += worker->result.equilibrium;
+            result.kinetics += worker->result.kinetics;
+        }
+    }
+
+    /// Load the chemical state of the worker from the arrays of the field point
+    auto load(Worker& worker, Index k) -> void
+    {
+        worker.state.setTemperature(T[k]);
+        worker.state.setPressure(P[k]);
+        worker.state.setSpeciesAmounts(n.col(k));
+        worker.state.setElementDualPotentials(y.col(k));
+        worker.state.setSpeciesDualPotentials(z.col(k));
+    }
+
+    /// Store the chemical state of the worker in the arrays of the field point
+    auto store(Worker& worker, Index k) -> void
+    {
+        n.col(k) = worker.state.speciesAmounts();
+        y.col(k) = worker.state.elementDualPotentials();
+        z.col(k) = worker.state.speciesDualPotentials();
+    }
+
+    /// Equilibrate the chemical state at every field point.
+    auto equilibrate(const double* Tdata, const double* Pdata, const double* bedata) -> void
+    {
+        T = Vector::Map(Tdata, npoints);
+        P = Vector::Map(Pdata, npoints);
+
+        parallel([&](Worker& worker, Index k)
+        {
+            load(worker, k);
+            if(Ne)
+            {
+                const EquilibriumResult res = worker.equilibrium.solve(worker.state, T[k], P[k], bedata + k*Ee);
+                worker.result.equilibrium += res;
+                succeeded[k] = res.optimum.succeeded;
+                worker.sensitivity = worker.equilibrium.sensitivity();
+            }
+            store(worker, k);
+            update(worker, k, Ne ? worker.equilibrium.properties() : updatedProperties(worker, k));
+        });
+    }
+
+    /// React the chemical state at every field point.
+    auto react(double t, double dt) -> void
+    {
+        Assert(Nk > 0, "Could not perform chemical kinetics calculations.",
+            "The partition of the chemical system has no kinetic species.");
+
+        parallel([&](Worker& worker, Index k)
+        {
+            load(worker, k);
+            worker.kinetics->solve(worker.state, t, dt);
+            const KineticResult& res = worker.kinetics->result();
+            worker.result.kinetics += res;
+            if(Ne)
+            {
+                // Use the sensitivity of the equilibrium state calculated at the end of the kinetic step
+                succeeded[k] = res.equilibrium.optimum.succeeded;
+                worker.sensitivity = worker.kinetics->sensitivity();
+            }
+            store(worker, k);
+            update(worker, k, Ne ? worker.kinetics->properties() : updatedProperties(worker, k));
+        });
+    }
+
+    /// Set the value and derivatives of a scalar field at a field point
+    template<typename V, typename Nx>
+    auto set(ScalarField& field, Index k, const ChemicalScalarBase<V, Nx>& scalar, Worker& worker) -> void
+    {
+        // Extract the derivatives of scalar w.r.t. amounts of equilibrium and kinetic species
+        worker.scalar_ne = scalar.ddn(ies);
+        worker.scalar_nk = scalar.ddn(iks);
+
+        // Set the value and the derivatives w.r.t. temperature and pressure at the k-th point
+        field.val[k] = scalar.val;
+        field.ddT[k] = scalar.ddT + dot(worker.scalar_ne, worker.sensitivity.dndT);
+        field.ddP[k] = scalar.ddP + dot(worker.scalar_ne, worker.sensitivity.dndP);
+
+        // Set the derivatives w.r.t. amounts of equilibrium elements and kinetic species at the k-th point
+        field.ddbe.col(k).noalias() = tr(worker.sensitivity.dndb) * worker.scalar_ne;
+        field.ddnk.col(k) = worker.scalar_nk;
+    }
+
+    /// Return the chemical properties at a field point without equilibrium species
+    auto updatedProperties(Worker& worker, Index k) -> const ChemicalProperties&
+    {
+        worker.properties.update(T[k], P[k], n.col(k));
+        return worker.properties;
+    }
+
+    /// Update the components and properties of interest at a field point after a chemical calculation
+    auto update(Worker& worker, Index k, const ChemicalProperties& properties) -> void
+    {
+        // Update the amounts of the components
+        c.col(k).head(Ee) = Ae * n.col(k)(ies);
+        c.col(k).tail(Nk) = n.col(k)(iks);
+
+        // Update the amounts of the equilibrium species
+        for(Index i = 0; i < Ne; ++i)
+        {
+            ne[i].val[k] = n(ies[i], k);
+            ne[i].ddT[k] = worker.sensitivity.dndT[i];
+            ne[i].ddP[k] = worker.sensitivity.dndP[i];
+            ne[i].ddbe.col(k) = tr(worker.sensitivity.dndb.row(i));
+        }
+
+        // Update the porosity and the total volume of the solid and fluid phases
+        const ChemicalScalar solid_volume = properties.solidVolume();
+        set(porosity, k, 1.0 - solid_volume, worker);
+        set(solid_total_volume, k, solid_volume, worker);
+
+        // Update the volumes, saturations and densities of the fluid phases
+        worker.volumes = rows(properties.phaseVolumes(), ifp);
+        const ChemicalScalar fluid_volume = sum(worker.volumes);
+        set(fluid_total_volume, k, fluid_volume, worker);
+        const ChemicalVector rho = rows(properties.phaseDensities(), ifp);
+        for(Index j = 0; j < Nfp; ++j)
+        {
+            set(fluid_volumes[j], k, worker.volumes[j], worker);
+            set(fluid_saturations[j], k, worker.volumes[j]/fluid_volume, worker);
+            set(fluid_densities[j], k, rho[j], worker);
+        }
+
+        // Update the kinetic rates of the components
+        if(rc.size())
+        {
+            const ChemicalVector r = worker.reactions.rates(properties);
+            worker.rates.val = Ac * r.val;
+            worker.rates.ddT = Ac * r.ddT;
+            worker.rates.ddP = Ac * r.ddP;
+            worker.rates.ddn = Ac * r.ddn;
+            for(Index j = 0; j < Nc; ++j)
+                set(rc[j], k, worker.rates[j], worker);
+        }
+    }
+};
+
+ChemicalSolver::ChemicalSolver()
+: pimpl(new Impl())
+{}
+
+ChemicalSolver::ChemicalSolver(const ChemicalSystem& system, Index npoints)
+: pimpl(new Impl(system, npoints))
+{}
+
+ChemicalSolver::ChemicalSolver(const ReactionSystem& reactions, Index npoints)
+: pimpl(new Impl(reactions, npoints))
+{}
+
+auto ChemicalSolver::numPoints() const -> Index
+{
+    return pimpl->npoints;
+}
+
+auto ChemicalSolver::numEquilibriumElements() const -> Index
+{
+    return pimpl->Ee;
+}
+
+auto ChemicalSolver::numKineticSpecies() const -> Index
+{
+    return pimpl->Nk;
+}
+
+auto ChemicalSolver::numComponents() const -> Index
+{
+    return pimpl->Nc;
+}
+
+auto ChemicalSolver::setOptions(const ChemicalSolverOptions& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto ChemicalSolver::setPartition(const Partition& partition) -> void
+{
+    pimpl->setPartition(partition);
+}
+
+auto ChemicalSolver::setStates(const ChemicalState& state) -> void
+{
+    for(Index k = 0; k < pimpl->npoints; ++k)
+        setStateAt(k, state);
+}
+
+auto ChemicalSolver::setStateAt(Index ipoint, const ChemicalState& state) -> void
+{
+    Assert(ipoint < pimpl->npoints,
+        "Could not set the chemical state at given field point.",
+        "Expecting a field point index smaller than the number of field points.");
+    pimpl->T[ipoint] = state.temperature();
+    pimpl->P[ipoint] = state.pressure();
+    pimpl->n.col(ipoint) = state.speciesAmounts();
+    if(state.elementDualPotentials().size())
+        pimpl->y.col(ipoint) = state.elementDualPotentials();
+    if(state.speciesDualPotentials().size())
+        pimpl->z.col(ipoint) = state.speciesDualPotentials();
+}
+
+auto ChemicalSolver::setStateAt(const Indices& ipoints, const ChemicalState& state) -> void
+{
+    for(Index ipoint : ipoints)
+        setStateAt(ipoint, state);
+}
+
+auto ChemicalSolver::equilibrate(VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> void
+{
+    Assert(Index(T.size()) == pimpl->npoints,
+        "Could not perform equilibrium calculations.",
+        "Expecting the same number of temperature values as there are field points.");
+
+    Assert(Index(P.size()) == pimpl->npoints,
+        "Could not perform equilibrium calculations.",
+        "Expecting the same number of pressure values as there are field points.");
+
+    Assert(Index(be.rows()) == pimpl->Ee && Index(be.cols()) == pimpl->npoints,
+        "Could not perform equilibrium calculations.",
+        "Expecting, for each equilibrium element, the same number of amount "
+        "values as there are field points.");
+
+    // Ensure the amounts of the elements of each field point are contiguous in memory
+    if(be.outerStride() == be.rows())
+        pimpl->equilibrate(T.data(), P.data(), be.data());
+    else
+    {
+        const Matrix becopy = be;
+        pimpl->equilibrate(T.data(), P.data(), becopy.data());
+    }
+}
+
+auto ChemicalSolver::equilibrate(const double* T, const double* P, const double* be) -> void
+{
+    pimpl->equilibrate(T, P, be);
+}
+
+auto ChemicalSolver::react(double t, double dt) -> void
+{
+    pimpl->react(t, dt);
+}
+
+auto ChemicalSolver::result() const -> const ChemicalSolverResult&
+{
+    return pimpl->result;
+}
+
+auto ChemicalSolver::state(Index ipoint) const -> ChemicalState
+{
+    ChemicalState state(pimpl->system);
+    state.setTemperature(pimpl->T[ipoint]);
+    state.setPressure(pimpl->P[ipoint]);
+    state.setSpeciesAmounts(pimpl->n.col(ipoint));
+    state.setElementDualPotentials(pimpl->y.col(ipoint));
+    state.setSpeciesDualPotentials(pimpl->z.col(ipoint));
+    return state;
+}
+
+auto ChemicalSolver::temperatures() const -> VectorConstRef
+{
+    return pimpl->T;
+}
+
+auto ChemicalSolver::pressures() const -> VectorConstRef
+{
+    return pimpl->P;
+}
+
+auto ChemicalSolver::speciesAmounts() const -> MatrixConstRef
+{
+    return pimpl->n;
+}
+
+auto ChemicalSolver::componentAmounts() const -> MatrixConstRef
+{
+    return pimpl->c;
+}
+
+auto ChemicalSolver::equilibriumSpeciesAmounts() const -> const std::vector<ScalarField>&
+{
+    return pimpl->ne;
+}
+
+auto ChemicalSolver::porosity() const -> const ScalarField&
+{
+    return pimpl->porosity;
+}
+
+auto ChemicalSolver::fluidSaturations() const -> const std::vector<ScalarField>&
+{
+    return pimpl->fluid_saturations;
+}
+
+auto ChemicalSolver::fluidDensities() const -> const std::vector<ScalarField>&
+{
+    return pimpl->fluid_densities;
+}
+
+auto ChemicalSolver::fluidVolumes() const -> const std::vector<ScalarField>&
+{
+    return pimpl->fluid_volumes;
+}
+
+auto ChemicalSolver::fluidTotalVolume() const -> const ScalarField&
+{
+    return pimpl->fluid_total_volume;
+}
+
+auto ChemicalSolver::solidTotalVolume() const -> const ScalarField&
+{
+    return pimpl->solid_total_volume;
+}
+
+auto ChemicalSolver::componentRates() const -> const std::vector<ScalarField>&
+{
+    return pimpl->rc;
+}
+
+} // namespace Reaktoro
@@ -14,203 +14,197 @@
 //
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
-//
-//#pragma once
-//
-//// C++ includes
-//#include <memory>
-//#include <string>
-//
-//// Reaktoro includes
-//#include <Reaktoro/Common/Index.hpp>
-//#include <Reaktoro/Math/Matrix.hpp>
-//
-//namespace Reaktoro {
-//
-//// Forward declarations
-//class ChemicalField;
-//class ChemicalSystem;
-//class ChemicalState;
-//class Partition;
-//class ReactionSystem;
-//
-///// A type that describes a solver for many chemical calculations.
-//class ChemicalSolver
-//{
-//public:
-//    // Forward declaration of the Array type.
-//    template<typename T>
-//    class Array;
-//
-//    // Forward declaration of the Grid type.
-//    template<typename T>
-//    class Grid;
-//
-//    /// Construct a default ChemicalSolver instance.
-//    ChemicalSolver();
-//
-//    /// Construct a ChemicalSolver instance with given chemical system and field number of points.
-//    ChemicalSolver(const ChemicalSystem& system, Index npoints);
-//
-//    /// Construct a ChemicalSolver instance with given reaction system and field number of points.
-//    ChemicalSolver(const ReactionSystem& reactions, Index npoints);
-//
-//    /// Return the number of field points.
-//    auto numPoints() const -> Index;
-//
-//    /// Return the number of equilibrium elements.
-//    auto numEquilibriumElements() const -> Index;
-//
-//    /// Return the number of kinetic species.
-//    auto numKineticSpecies() const -> Index;
-//
-//    /// Return the number of chemical components.
-//    auto numComponents() const -> Index;
-//
-//    /// Set the partitioning of the chemical system.
-//    auto setPartition(const Partition& partition) -> void;
-//
-//    /// Set the chemical state of all field points uniformly.
-//    /// @param state The state of the chemical system.
-//    auto setStates(const ChemicalState& state) -> void;
-//
-//    /// Set the chemical state of all field points.
-//    /// @param states The array of states of the chemical system.
-//    auto setStates(const Array<ChemicalState>& states) -> void;
-//
-//    /// Set the chemical state at a specified field point.
-//    /// @param ipoint The index of the field point.
-//    /// @param state The state of the chemical system.
-//    auto setStateAt(Index ipoint, const ChemicalState& state) -> void;
-//
-//    /// Set the same chemical state at all specified field points.
-//    /// @param ipoints The indices of the field points.
-//    /// @param state The state of the chemical system.
-//    auto setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void;
-//
-//    /// Set the chemical state at all specified field points.
-//    /// @param ipoints The indices of the field points.
-//    /// @param states The states of the chemical system.
-//    auto setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void;
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void;
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void;
-//
-//    /// React the chemical state at every field point.
-//    auto react(double t, double dt) -> void;
-//
-//    /// Return the chemical state at given index.
-//    auto state(Index i) const -> const ChemicalState&;
-//
-//    /// Return the chemical states at all field points.
-//    auto states() const -> const std::vector<ChemicalState>&;
-//
-//    /// Return the molar amounts of the chemical components at every field point (in units of mol).
-//    auto componentAmounts() -> const std::vector<Vector>&;
-//
-//    /// Return the molar amounts of each equilibrium species and their derivatives at every field point.
-//    auto equilibriumSpeciesAmounts() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the porosity at every field point.
-//    auto porosity() -> const ChemicalField&;
-//
-//    /// Return the saturations of the fluid phases at every field point.
-//    auto fluidSaturations() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the densities of the fluid phases at every field point (in units of kg/m3).
-//    auto fluidDensities() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the volumes of the fluid phases at every field point (in units of m3).
-//    auto fluidVolumes() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the total volume of the fluid phases at every field point (in units of m3).
-//    auto fluidTotalVolume() -> const ChemicalField&;
-//
-//    /// Return the total volume of the solid phases at every field point (in units of m3).
-//    auto solidTotalVolume() -> const ChemicalField&;
-//
-//    /// Return the kinetic rates of the chemical components at every field point (in units of mol/s).
-//    auto componentRates() -> const std::vector<ChemicalField>&;
-//
-//private:
-//    struct Impl;
-//
-//    std::shared_ptr<Impl> pimpl;
-//
-//public:
-//    /// A type that represents a one-dimensional array of values.
-//    template<typename T>
-//    class Array
-//    {
-//    public:
-//        /// Construct a default Array instance.
-//        Array()
-//        {}
-//
-//        /// Construct a custom Array instance.
-//        Array(const T* data, Index size)
-//        : data(data), size(size) {}
-//
-//        /// Construct an Array instance from a vector-like instance.
-//        /// The type of the vector must have public methods `data` and `size`.
-//        template<typename VectorType>
-//        Array(const VectorType& vec)
-//        : data(vec.data()), size(vec.size()) {}
-//
-//        friend class ChemicalSolver;
-//
-//    private:
-//        /// The pointer to a one-dimensional array of values.
-//        const T* data = nullptr;
-//
-//        /// The size of the array.
-//        Index size = 0;
-//    };
-//
-//    /// A type that represents a two-dimensional array of values.
-//    template<typename T>
-//    class Grid
-//    {
-//    public:
-//        /// Construct a default Grid instance.
-//        Grid()
-//        {}
-//
-//        /// Construct a custom Grid instance.
-//        Grid(const T** data, Index rows, Index cols)
-//        : data(data), rows(rows), cols(cols) {}
-//
-//        /// Construct an Grid instance from a vector-like instance.
-//        /// The type of the vector must have public methods `data` and `size`.
-//        template<typename VectorType>
-//        Grid(const std::vector<VectorType>& vec)
-//        {
-//            pointers.reserve(vec.size());
-//            for(const VectorType& v : vec)
-//                pointers.push_back(v.data());
-//            rows = vec.size();
-//            cols = vec.front().size();
-//        }
-//
-//        friend class ChemicalSolver;
-//
-//    private:
-//        /// The pointer to a two-dimensional array of values.
-//        const T** data = nullptr;
-//
-//        /// The pointer to a two-dimensional array of values.
-//        std::vector<const T*> pointers;
-//
-//        /// The number of rows of the grid.
-//        Index rows = 0;
-//
-//        /// The number of columns of the grid.
-//        Index cols = 0;
-//    };
-//};
-//
-//} // namespace Reaktoro
-//
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+class Partition;
+class ReactionSystem;
+
+/// A type that contains the values of a scalar field and its derivatives at every field point.
+/// The derivatives with respect to the amounts of equilibrium elements and kinetic species are
+/// stored column-wise, so that the derivatives at a field point are contiguous in memory.
+struct ScalarField
+{
+    /// The values of the scalar field at every field point.
+    Vector val;
+
+    /// The derivatives of the scalar field with respect to temperature at every field point.
+    Vector ddT;
+
+    /// The derivatives of the scalar field with respect to pressure at every field point.
+    Vector ddP;
+
+    /// The derivatives of the scalar field with respect to the amounts of the equilibrium elements,
+    /// with one column per field point.
+    Matrix ddbe;
+
+    /// The derivatives of the scalar field with respect to the amounts of the kinetic species,
+    /// with one column per field point.
+    Matrix ddnk;
+};
+
+/// The options for the chemical calculations in ChemicalSolver.
+struct ChemicalSolverOptions
+{
+    /// The number of threads used to process the field points.
+    /// The number of hardware threads is used if zero. A single thread is used
+    /// if the chemical system was created with custom thermodynamic and chemical
+    /// models that are not reentrant (see ChemicalSystem::hasReentrantModels).
+    unsigned num_threads = 0;
+
+    /// The options for the equilibrium calculations.
+    EquilibriumOptions equilibrium;
+
+    /// The options for the chemical kinetics calculations.
+    KineticOptions kinetics;
+};
+
+/// The result of the last chemical calculations of a ChemicalSolver instance.
+struct ChemicalSolverResult
+{
+    /// The indices of the field points whose equilibrium calculations failed.
+    /// The chemical states of these field points are those of the last iterate of their calculations.
+    Indices failed;
+
+    /// The accumulated results of the equilibrium calculations at all field points
+    EquilibriumResult equilibrium;
+
+    /// The accumulated results of the chemical kinetics calculations at all field points
+    KineticResult kinetics;
+};
+
+/// A type that describes a solver for many chemical calculations.
+/// The chemical states of all field points are stored in contiguous arrays, and the
+/// equilibrium and kinetic calculations are distributed over threads, each one with
+/// its own copy of the chemical system. The properties of interest for coupling with
+/// a transport simulator (e.g., porosity, saturations, densities) and their derivatives
+/// are calculated right after the chemical calculation at each field point, and
+/// they are exposed as references to their arrays.
+class ChemicalSolver
+{
+public:
+    /// Construct a default ChemicalSolver instance.
+    ChemicalSolver();
+
+    /// Construct a ChemicalSolver instance with given chemical system and field number of points.
+    ChemicalSolver(const ChemicalSystem& system, Index npoints);
+
+    /// Construct a ChemicalSolver instance with given reaction system and field number of points.
+    ChemicalSolver(const ReactionSystem& reactions, Index npoints);
+
+    /// Return the number of field points.
+    auto numPoints() const -> Index;
+
+    /// Return the number of equilibrium elements.
+    auto numEquilibriumElements() const -> Index;
+
+    /// Return the number of kinetic species.
+    auto numKineticSpecies() const -> Index;
+
+    /// Return the number of chemical components.
+    auto numComponents() const -> Index;
+
+    /// Set the options for the chemical calculations.
+    auto setOptions(const ChemicalSolverOptions& options) -> void;
+
+    /// Set the partitioning of the chemical system.
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Set the chemical state of all field points uniformly.
+    /// @param state The state of the chemical system.
+    auto setStates(const ChemicalState& state) -> void;
+
+    /// Set the chemical state at a specified field point.
+    /// @param ipoint The index of the field point.
+    /// @param state The state of the chemical system.
+    auto setStateAt(Index ipoint, const ChemicalState& state) -> void;
+
+    /// Set the same chemical state at all specified field points.
+    /// @param ipoints The indices of the field points.
+    /// @param state The state of the chemical system.
+    auto setStateAt(const Indices& ipoints, const ChemicalState& state) -> void;
+
+    /// Equilibrate the chemical state at every field point.
+    /// @param T The temperatures at every field point (in units of K)
+    /// @param P The pressures at every field point (in units of Pa)
+    /// @param be The amounts of the equilibrium elements, with one column per field point (in units of mol)
+    auto equilibrate(VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> void;
+
+    /// Equilibrate the chemical state at every field point.
+    /// @param T The array of temperatures at every field point (in units of K)
+    /// @param P The array of pressures at every field point (in units of Pa)
+    /// @param be The array of amounts of the equilibrium elements, ordered point by point (in units of mol)
+    auto equilibrate(const double* T, const double* P, const double* be) -> void;
+
+    /// React the chemical state at every field point.
+    /// @param t The start time of the integration (in units of s)
+    /// @param dt The time step of the integration (in units of s)
+    auto react(double t, double dt) -> void;
+
+    /// Return the result of the last equilibrium or chemical kinetics calculations.
+    auto result() const -> const ChemicalSolverResult&;
+
+    /// Return the chemical state at given field point.
+    auto state(Index ipoint) const -> ChemicalState;
+
+    /// Return the temperatures at every field point (in units of K).
+    auto temperatures() const -> VectorConstRef;
+
+    /// Return the pressures at every field point (in units of Pa).
+    auto pressures() const -> VectorConstRef;
+
+    /// Return the amounts of the species, with one column per field point (in units of mol).
+    auto speciesAmounts() const -> MatrixConstRef;
+
+    /// Return the amounts of the chemical components, with one column per field point (in units of mol).
+    /// The chemical components are the equilibrium elements followed by the kinetic species.
+    auto componentAmounts() const -> MatrixConstRef;
+
+    /// Return the amounts of each equilibrium species and their derivatives at every field point.
+    auto equilibriumSpeciesAmounts() const -> const std::vector<ScalarField>&;
+
+    /// Return the porosity at every field point.
+    auto porosity() const -> const ScalarField&;
+
+    /// Return the saturations of the fluid phases at every field point.
+    auto fluidSaturations() const -> const std::vector<ScalarField>&;
+
+    /// Return the densities of the fluid phases at every field point (in units of kg/m3).
+    auto fluidDensities() const -> const std::vector<ScalarField>&;
+
+    /// Return the volumes of the fluid phases at every field point (in units of m3).
+    auto fluidVolumes() const -> const std::vector<ScalarField>&;
+
+    /// Return the total volume of the fluid phases at every field point (in units of m3).
+    auto fluidTotalVolume() const -> const ScalarField&;
+
+    /// Return the total volume of the solid phases at every field point (in units of m3).
+    auto solidTotalVolume() const -> const ScalarField&;
+
+    /// Return the kinetic rates of the chemical components at every field point (in units of mol/s).
+    auto componentRates() const -> const std::vector<ScalarField>&;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
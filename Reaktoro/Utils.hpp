@@ -17,5 +17,4 @@
 
 #pragma once
 
-#include <Reaktoro/Util/ChemicalField.hpp>
 #include <Reaktoro/Util/ChemicalSolver.hpp>
@@ -18,12 +18,41 @@
 #include <Reaktoro/Reaktoro.hpp>
 using namespace Reaktoro;
 
+// C++ includes
+#include <chrono>
+#include <thread>
+
+// POSIX includes for the server mode over a UNIX domain socket
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 /// Prints a message detailing how to use the interpreter executable.
 void printUsage(int argc, char **argv);
 
+/// Executes a stream of newline-delimited json requests from a file or the standard input.
+int executeStream(int argc, char **argv);
+
+/// Answers json requests from the standard input or a UNIX domain socket until terminated.
+int executeServer(int argc, char **argv);
+
 /// The entry point of the Reaktoro interpreter
 int main(int argc, char **argv)
 {
+	// Check if the interpreter should execute a stream of requests
+	if(argc >= 2 && std::string(argv[1]) == "--stream")
+		return executeStream(argc, argv);
+
+	// Check if the interpreter should run as a server
+	if(argc >= 2 && std::string(argv[1]) == "--server")
+		return executeServer(argc, argv);
+
 	// Check the command-line arguments were used correctly
 	if(argc != 2) {
 		printUsage(argc, argv);
@@ -41,7 +70,203 @@ int main(int argc, char **argv)
     	pair.second.output(pair.first + ".txt");
 }
 
+int executeStream(int argc, char **argv)
+{
+	InterpreterStreamOptions options;
+	std::string filename;
+
+	// Parse the optional input file and number of threads
+	for(int i = 2; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if(arg == "--threads" && i + 1 < argc)
+			options.num_threads = std::stoul(argv[++i]);
+		else if(filename.empty())
+			filename = arg;
+		else {
+			printUsage(argc, argv);
+			return 1;
+		}
+	}
+
+	// Stream the results of the requests to the standard output
+	Interpreter interpreter;
+	if(filename.empty() || filename == "-")
+		interpreter.executeJsonStream(std::cin, std::cout, options);
+	else {
+		std::ifstream file(filename);
+		if(!file.is_open()) {
+			std::cerr << "Could not open the input file `" << filename << "`." << std::endl;
+			return 1;
+		}
+		interpreter.executeJsonStream(file, std::cout, options);
+	}
+
+	return 0;
+}
+
+#ifndef _WIN32
+/// The path of the server socket, removed by the signal handler when the server is terminated.
+char socket_path[sizeof(sockaddr_un::sun_path)] = {};
+
+/// Removes the server socket and terminates the server with the default action of the signal.
+extern "C" void removeSocketAndExit(int sig)
+{
+	unlink(socket_path);
+	std::signal(sig, SIG_DFL);
+	std::raise(sig);
+}
+
+/// Removes a stale server socket left at a path, refusing to touch anything else.
+bool removeStaleSocket(const std::string& path, const sockaddr_un& address)
+{
+	struct stat info;
+	if(lstat(path.c_str(), &info) != 0)
+		return errno == ENOENT;
+
+	if(!S_ISSOCK(info.st_mode)) {
+		std::cerr << "The path `" << path << "` exists and is not a socket." << std::endl;
+		return false;
+	}
+
+	// Refuse to remove the socket of a server still accepting connections
+	int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+	const bool alive = probe >= 0 && connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+	if(probe >= 0) close(probe);
+	if(alive) {
+		std::cerr << "The socket `" << path << "` is in use by another server." << std::endl;
+		return false;
+	}
+
+	return unlink(path.c_str()) == 0;
+}
+
+/// Answers the newline-delimited json requests of a client connected to the server socket.
+void serveConnection(const Interpreter& interpreter, int fd)
+{
+	std::string buffer;
+	char chunk[4096];
+	ssize_t count;
+	while((count = read(fd, chunk, sizeof(chunk))) > 0)
+	{
+		buffer.append(chunk, count);
+
+		// Answer every complete line received so far
+		std::string::size_type pos;
+		while((pos = buffer.find('\n')) != std::string::npos)
+		{
+			std::string line = buffer.substr(0, pos);
+			buffer.erase(0, pos + 1);
+			if(trim(line).empty())
+				continue;
+
+			std::string response = interpreter.executeJsonRequest(line) + "\n";
+			const char* data = response.data();
+			std::size_t remaining = response.size();
+			while(remaining > 0)
+			{
+				ssize_t written = write(fd, data, remaining);
+				if(written <= 0) { close(fd); return; }
+				data += written;
+				remaining -= written;
+			}
+		}
+	}
+	close(fd);
+}
+#endif
+
+int executeServer(int argc, char **argv)
+{
+	Interpreter interpreter;
+
+	// Answer the requests from the standard input if no socket is given
+	if(argc == 2)
+	{
+		interpreter.executeJsonServer(std::cin, std::cout);
+		return 0;
+	}
+
+	if(argc != 4 || std::string(argv[2]) != "--socket") {
+		printUsage(argc, argv);
+		return 1;
+	}
+
+#ifdef _WIN32
+	std::cerr << "The server mode over a UNIX domain socket is not supported on Windows." << std::endl;
+	return 1;
+#else
+	const std::string path = argv[3];
+
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if(path.size() >= sizeof(address.sun_path)) {
+		std::cerr << "The socket path `" << path << "` is too long." << std::endl;
+		return 1;
+	}
+	path.copy(address.sun_path, path.size());
+
+	// Ensure a client closing its connection early does not terminate the server
+	std::signal(SIGPIPE, SIG_IGN);
+
+	// Remove the socket left by a previous server that did not exit cleanly
+	if(!removeStaleSocket(path, address))
+		return 1;
+
+	int server = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(server < 0 || bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+		std::cerr << "Could not bind the socket `" << path << "`: " << std::strerror(errno) << std::endl;
+		if(server >= 0) close(server);
+		return 1;
+	}
+
+	// Remove the socket when the server is interrupted or terminated
+	path.copy(socket_path, path.size());
+	std::signal(SIGINT, removeSocketAndExit);
+	std::signal(SIGTERM, removeSocketAndExit);
+
+	if(listen(server, SOMAXCONN) < 0) {
+		std::cerr << "Could not listen on the socket `" << path << "`: " << std::strerror(errno) << std::endl;
+		close(server);
+		unlink(path.c_str());
+		return 1;
+	}
+
+	// Answer each client in its own thread, all sharing the cached chemical systems
+	while(true)
+	{
+		int client = accept(server, nullptr, nullptr);
+		if(client < 0)
+		{
+			// Retry at once if the call was interrupted or the client gave up
+			if(errno == EINTR || errno == ECONNABORTED)
+				continue;
+
+			// Back off while the process or the system is out of descriptors or memory
+			if(errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				continue;
+			}
+
+			std::cerr << "Could not accept connections on the socket `" << path << "`: " << std::strerror(errno) << std::endl;
+			break;
+		}
+		std::thread(serveConnection, std::cref(interpreter), client).detach();
+	}
+
+	close(server);
+	unlink(path.c_str());
+	return 1;
+#endif
+}
+
 void printUsage(int argc, char **argv)
 {
 	std::cout << "Usage: " << argv[0] << " `your-input-file.json`" << std::endl;
+	std::cout << "       " << argv[0] << " --stream [`your-input-file.ndjson`] [--threads N]" << std::endl;
+	std::cout << "The stream mode reads newline-delimited json requests from the given file, or from" << std::endl;
+	std::cout << "the standard input if no file is given, and writes the results to the standard output." << std::endl;
+	std::cout << "       " << argv[0] << " --server [--socket `path`]" << std::endl;
+	std::cout << "The server mode answers newline-delimited json requests from the standard input, or from" << std::endl;
+	std::cout << "the clients of a local UNIX domain socket, caching the chemical systems between requests." << std::endl;
 }
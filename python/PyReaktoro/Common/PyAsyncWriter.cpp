@@ -0,0 +1,64 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
+
+namespace Reaktoro {
+
+/// Delete an AsyncWriter instance without the GIL, since its pending Python jobs are executed on destruction.
+struct AsyncWriterDeleter
+{
+    auto operator()(AsyncWriter* writer) const -> void
+    {
+        py::gil_scoped_release release;
+        delete writer;
+    }
+};
+
+void exportAsyncWriter(py::module& m)
+{
+    py::enum_<AsyncWriterBackPressure>(m, "AsyncWriterBackPressure")
+        .value("Block", AsyncWriterBackPressure::Block)
+        .value("Drop", AsyncWriterBackPressure::Drop)
+        ;
+
+    py::class_<AsyncWriterOptions>(m, "AsyncWriterOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &AsyncWriterOptions::active)
+        .def_readwrite("capacity", &AsyncWriterOptions::capacity)
+        .def_readwrite("backpressure", &AsyncWriterOptions::backpressure)
+        ;
+
+    // The GIL is released while waiting on the writer thread, which acquires it to execute Python jobs
+    py::class_<AsyncWriter, std::unique_ptr<AsyncWriter, AsyncWriterDeleter>>(m, "AsyncWriter")
+        .def(py::init<>())
+        .def(py::init<const AsyncWriterOptions&>())
+        .def("setOptions", &AsyncWriter::setOptions, py::call_guard<py::gil_scoped_release>())
+        .def("options", &AsyncWriter::options, py::return_value_policy::reference_internal)
+        .def("open", &AsyncWriter::open, py::call_guard<py::gil_scoped_release>())
+        .def("push", &AsyncWriter::push, py::call_guard<py::gil_scoped_release>())
+        .def("flush", &AsyncWriter::flush, py::call_guard<py::gil_scoped_release>())
+        .def("close", &AsyncWriter::close, py::call_guard<py::gil_scoped_release>())
+        .def("running", &AsyncWriter::running)
+        .def("dropped", &AsyncWriter::dropped)
+        ;
+}
+
+} // namespace Reaktoro
@@ -26,6 +26,14 @@ void exportUnits(py::module& m)
 {
     m.def("convert", units::convert);
     m.def("convertible", units::convertible);
+
+    py::class_<units::UnitConverter>(m, "UnitConverter")
+        .def(py::init<>())
+        .def(py::init<const std::string&, const std::string&>())
+        .def("__call__", &units::UnitConverter::operator())
+        .def("factor", &units::UnitConverter::factor)
+        .def("offset", &units::UnitConverter::offset)
+        ;
 }
 
 } // namespace Reaktoro
@@ -18,6 +18,7 @@
 #include <PyReaktoro/PyReaktoro.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -41,6 +42,9 @@ void exportChemicalOutput(py::module& m)
     auto attach2 = static_cast<void(ChemicalOutput::*)(double)>(&ChemicalOutput::attach);
     auto attach3 = static_cast<void(ChemicalOutput::*)(std::string)>(&ChemicalOutput::attach);
 
+    auto asynchronous1 = static_cast<void(ChemicalOutput::*)(bool)>(&ChemicalOutput::asynchronous);
+    auto asynchronous2 = static_cast<void(ChemicalOutput::*)(const AsyncWriterOptions&)>(&ChemicalOutput::asynchronous);
+
     py::class_<ChemicalOutput>(m, "ChemicalOutput")
         .def(py::init<>())
         .def(py::init<const ChemicalSystem&>())
@@ -60,10 +64,13 @@ void exportChemicalOutput(py::module& m)
         .def("precision", &ChemicalOutput::precision)
         .def("scientific", &ChemicalOutput::scientific)
         .def("terminal", &ChemicalOutput::terminal)
+        .def("asynchronous", asynchronous1)
+        .def("asynchronous", asynchronous2)
         .def("quantities", &ChemicalOutput::quantities)
         .def("headings", &ChemicalOutput::headings)
         .def("open", &ChemicalOutput::open)
         .def("update", &ChemicalOutput::update)
+        .def("flush", &ChemicalOutput::flush)
         .def("close", &ChemicalOutput::close)
         ;
 }
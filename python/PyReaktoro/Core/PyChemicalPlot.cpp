@@ -18,6 +18,7 @@
 #include <PyReaktoro/PyReaktoro.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Core/ChemicalPlot.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -35,6 +36,8 @@ void exportChemicalPlot(py::module& m)
     auto showlegend1 = static_cast<void(ChemicalPlot::*)(bool)>(&ChemicalPlot::showlegend);
     auto showlegend2 = static_cast<bool(ChemicalPlot::*)() const>(&ChemicalPlot::showlegend);
     auto lshift = static_cast<ChemicalPlot&(ChemicalPlot::*)(std::string)>(&ChemicalPlot::operator<<);
+    auto asynchronous1 = static_cast<void(ChemicalPlot::*)(bool)>(&ChemicalPlot::asynchronous);
+    auto asynchronous2 = static_cast<void(ChemicalPlot::*)(const AsyncWriterOptions&)>(&ChemicalPlot::asynchronous);
 
     py::class_<ChemicalPlot>(m, "ChemicalPlot")
         .def(py::init<>())
@@ -59,9 +62,12 @@ void exportChemicalPlot(py::module& m)
         .def("xlogscale", &ChemicalPlot::xlogscale, py::arg("base")=10)
         .def("ylogscale", &ChemicalPlot::ylogscale, py::arg("base")=10)
         .def("frequency", &ChemicalPlot::frequency)
+        .def("asynchronous", asynchronous1)
+        .def("asynchronous", asynchronous2)
         .def("__lshift__", lshift, py::return_value_policy::reference_internal)
         .def("open", &ChemicalPlot::open)
         .def("update", &ChemicalPlot::update)
+        .def("flush", &ChemicalPlot::flush)
         ;
 
 //    exportstd_vector<ChemicalPlot>("ChemicalPlotVector");
@@ -30,6 +30,21 @@ void exportChemicalProperties(py::module& m)
     auto update3 = static_cast<void (ChemicalProperties::*)(double, double, VectorConstRef)>(&ChemicalProperties::update);
     auto update4 = static_cast<void (ChemicalProperties::*)(double, double, VectorConstRef, const ThermoModelResult&, const ChemicalModelResult&)>(&ChemicalProperties::update);
 
+    // Return the amounts of the species as a read-only view instead of the unbound Composition type
+    auto composition = [](const ChemicalProperties& self) -> VectorConstRef { return self.composition().val; };
+
+    py::class_<ChemicalPropertiesCounters>(m, "ChemicalPropertiesCounters")
+        .def(py::init<>())
+        .def_readwrite("num_thermo_updates", &ChemicalPropertiesCounters::num_thermo_updates)
+        .def_readwrite("num_thermo_evals", &ChemicalPropertiesCounters::num_thermo_evals)
+        .def_readwrite("num_chemical_evals", &ChemicalPropertiesCounters::num_chemical_evals)
+        .def_readwrite("num_phase_skips", &ChemicalPropertiesCounters::num_phase_skips)
+        .def_readwrite("time_thermo_model", &ChemicalPropertiesCounters::time_thermo_model)
+        .def_readwrite("time_chemical_model", &ChemicalPropertiesCounters::time_chemical_model)
+        .def_readwrite("time_thermo_model_phases", &ChemicalPropertiesCounters::time_thermo_model_phases)
+        .def_readwrite("time_chemical_model_phases", &ChemicalPropertiesCounters::time_chemical_model_phases)
+        ;
+
     py::class_<ChemicalProperties>(m, "ChemicalProperties")
         .def(py::init<>())
         .def(py::init<const ChemicalSystem&>())
@@ -37,9 +52,12 @@ void exportChemicalProperties(py::module& m)
         .def("update", update2)
         .def("update", update3)
         .def("update", update4)
+        .def("setPhaseTiming", &ChemicalProperties::setPhaseTiming)
+        .def("counters", &ChemicalProperties::counters, py::return_value_policy::reference_internal)
+        .def("resetCounters", &ChemicalProperties::resetCounters)
         .def("temperature", &ChemicalProperties::temperature)
         .def("pressure", &ChemicalProperties::pressure)
-        .def("composition", &ChemicalProperties::composition)
+        .def("composition", composition, py::return_value_policy::reference_internal)
         .def("thermoModelResult", &ChemicalProperties::thermoModelResult, py::return_value_policy::reference_internal)
         .def("chemicalModelResult", &ChemicalProperties::chemicalModelResult, py::return_value_policy::reference_internal)
         .def("moleFractions", &ChemicalProperties::moleFractions)
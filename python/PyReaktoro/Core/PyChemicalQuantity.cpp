@@ -45,6 +45,7 @@ void exportChemicalQuantity(py::module& m)
         .def("update", update1, py::return_value_policy::reference_internal)
         .def("update", update2, py::return_value_policy::reference_internal)
         .def("value", &ChemicalQuantity::value)
+        .def("values", &ChemicalQuantity::values)
         .def("__call__", &ChemicalQuantity::value)
         ;
 }
@@ -62,6 +62,9 @@ void exportChemicalSystem(py::module& m)
         .def("phases", &ChemicalSystem::phases, py::return_value_policy::reference_internal)
         .def("thermoModel", &ChemicalSystem::thermoModel, py::return_value_policy::reference_internal)
         .def("chemicalModel", &ChemicalSystem::chemicalModel, py::return_value_policy::reference_internal)
+        .def("hasPhaseModels", &ChemicalSystem::hasPhaseModels)
+        .def("setReentrantModels", &ChemicalSystem::setReentrantModels)
+        .def("hasReentrantModels", &ChemicalSystem::hasReentrantModels)
         .def("formulaMatrix", &ChemicalSystem::formulaMatrix, py::return_value_policy::reference_internal)
         .def("element", element1, py::return_value_policy::reference_internal)
         .def("element", element2, py::return_value_policy::reference_internal)
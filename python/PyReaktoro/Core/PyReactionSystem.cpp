@@ -42,6 +42,7 @@ void exportReactionSystem(py::module& m)
         .def("reactions", &ReactionSystem::reactions, py::return_value_policy::reference_internal)
         .def("reaction", reaction1, py::return_value_policy::reference_internal)
         .def("reaction", reaction2, py::return_value_policy::reference_internal)
+        .def("setRates", &ReactionSystem::setRates)
         .def("stoichiometricMatrix", &ReactionSystem::stoichiometricMatrix, py::return_value_policy::reference_internal)
         .def("system", &ReactionSystem::system, py::return_value_policy::reference_internal)
         .def("lnEquilibriumConstants", &ReactionSystem::lnEquilibriumConstants)
@@ -0,0 +1,48 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInitialGuess.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+
+namespace Reaktoro {
+
+void exportEquilibriumInitialGuess(py::module& m)
+{
+    py::class_<EquilibriumInitialGuess>(m, "EquilibriumInitialGuess")
+        .def(py::init<>())
+        .def_readwrite("n", &EquilibriumInitialGuess::n)
+        .def_readwrite("y", &EquilibriumInitialGuess::y)
+        .def_readwrite("z", &EquilibriumInitialGuess::z)
+        ;
+
+    py::class_<EquilibriumInitialGuessProvider>(m, "EquilibriumInitialGuessProvider")
+        .def(py::init<>())
+        .def_readwrite("name", &EquilibriumInitialGuessProvider::name)
+        .def_readwrite("function", &EquilibriumInitialGuessProvider::function)
+        ;
+
+    m.def("previousInitialGuess", previousInitialGuess);
+    m.def("neighbourInitialGuess", neighbourInitialGuess, py::keep_alive<0, 1>());
+    m.def("sensitivityInitialGuess", sensitivityInitialGuess, py::keep_alive<0, 1>());
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,52 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// pybind11 includes
+#include <pybind11/stl.h>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInverseBatchSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInverseProblem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+
+namespace Reaktoro {
+
+void exportEquilibriumInverseBatchSolver(py::module& m)
+{
+    auto solve = [](EquilibriumInverseBatchSolver& self, std::vector<ChemicalState> states, Vector T, Vector P, Matrix values, Matrix b)
+    {
+        {
+            py::gil_scoped_release release;
+            self.solve(states, T, P, values, b);
+        }
+        return states;
+    };
+
+    py::class_<EquilibriumInverseBatchSolver>(m, "EquilibriumInverseBatchSolver")
+        .def(py::init<const EquilibriumInverseProblem&>())
+        .def("setOptions", &EquilibriumInverseBatchSolver::setOptions)
+        .def("problem", &EquilibriumInverseBatchSolver::problem, py::return_value_policy::reference_internal)
+        .def("solve", solve)
+        .def("result", &EquilibriumInverseBatchSolver::result, py::return_value_policy::reference_internal)
+        ;
+}
+
+} // namespace Reaktoro
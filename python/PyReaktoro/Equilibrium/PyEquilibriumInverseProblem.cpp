@@ -91,7 +91,11 @@ void exportEquilibriumInverseProblem(py::module& m)
         .def("partition", &EquilibriumInverseProblem::partition, py::return_value_policy::reference_internal)
         .def("temperature", &EquilibriumInverseProblem::temperature)
         .def("pressure", &EquilibriumInverseProblem::pressure)
+        .def("setConstraintValues", &EquilibriumInverseProblem::setConstraintValues, py::return_value_policy::reference_internal)
+        .def("setConstraintTargets", &EquilibriumInverseProblem::setConstraintTargets, py::return_value_policy::reference_internal)
+        .def("constraintValues", &EquilibriumInverseProblem::constraintValues)
         .def("numConstraints", &EquilibriumInverseProblem::numConstraints)
+        .def("numConstraintTargets", &EquilibriumInverseProblem::numConstraintTargets)
         .def("numTitrants", &EquilibriumInverseProblem::numTitrants)
         .def("formulaMatrixTitrants", &EquilibriumInverseProblem::formulaMatrixTitrants)
         .def("elementInitialAmounts", &EquilibriumInverseProblem::elementInitialAmounts)
@@ -36,6 +36,24 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol)
         ;
 
+    py::class_<EquilibriumInitialGuessOptions>(m, "EquilibriumInitialGuessOptions")
+        .def_readwrite("mismatch", &EquilibriumInitialGuessOptions::mismatch)
+        ;
+
+    py::class_<EquilibriumRetryStageOptions>(m, "EquilibriumRetryStageOptions")
+        .def_readwrite("max_iterations", &EquilibriumRetryStageOptions::max_iterations)
+        .def_readwrite("max_time", &EquilibriumRetryStageOptions::max_time)
+        ;
+
+    py::class_<EquilibriumRetryOptions>(m, "EquilibriumRetryOptions")
+        .def_readwrite("pass_iterations", &EquilibriumRetryOptions::pass_iterations)
+        .def_readwrite("max_time", &EquilibriumRetryOptions::max_time)
+        .def_readwrite("warmrestart", &EquilibriumRetryOptions::warmrestart)
+        .def_readwrite("alternative", &EquilibriumRetryOptions::alternative)
+        .def_readwrite("alternative_method", &EquilibriumRetryOptions::alternative_method)
+        .def_readwrite("coldstart", &EquilibriumRetryOptions::coldstart)
+        ;
+
     py::class_<EquilibriumOptions>(m, "EquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
@@ -45,6 +63,18 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("optimum", &EquilibriumOptions::optimum)
         .def_readwrite("nonlinear", &EquilibriumOptions::nonlinear)
         .def_readwrite("smart", &EquilibriumOptions::smart)
+        .def_readwrite("initialguess", &EquilibriumOptions::initialguess)
+        .def_readwrite("retry", &EquilibriumOptions::retry)
+        .def_readwrite("phase_timing", &EquilibriumOptions::phase_timing)
+        ;
+
+    py::class_<EquilibriumInverseBatchOptions>(m, "EquilibriumInverseBatchOptions")
+        .def(py::init<>())
+        .def_readwrite("equilibrium", &EquilibriumInverseBatchOptions::equilibrium)
+        .def_readwrite("num_threads", &EquilibriumInverseBatchOptions::num_threads)
+        .def_readwrite("chunk_size", &EquilibriumInverseBatchOptions::chunk_size)
+        .def_readwrite("ordering", &EquilibriumInverseBatchOptions::ordering)
+        .def_readwrite("warmstart", &EquilibriumInverseBatchOptions::warmstart)
         ;
 }
 
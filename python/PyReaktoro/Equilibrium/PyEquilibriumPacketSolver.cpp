@@ -0,0 +1,52 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumPacketSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+
+namespace Reaktoro {
+
+void exportEquilibriumPacketSolver(py::module& m)
+{
+    auto solve = [](EquilibriumPacketSolver& self, std::vector<ChemicalState> states, Vector T, Vector P, Matrix be)
+    {
+        std::vector<EquilibriumResult> results;
+        {
+            py::gil_scoped_release release;
+            results = self.solve(states, T, P, be);
+        }
+        return py::make_tuple(states, results);
+    };
+
+    py::class_<EquilibriumPacketSolver>(m, "EquilibriumPacketSolver")
+        .def(py::init<const ChemicalSystem&>())
+        .def(py::init<const Partition&>())
+        .def_property_readonly_static("lanes", [](py::object) { return EquilibriumPacketSolver::lanes; })
+        .def("setOptions", &EquilibriumPacketSolver::setOptions)
+        .def("setPartition", &EquilibriumPacketSolver::setPartition)
+        .def("solve", solve, py::arg("states"), py::arg("T"), py::arg("P"), py::arg("be"))
+        ;
+}
+
+} // namespace Reaktoro
@@ -29,9 +29,17 @@ namespace Reaktoro {
 
 void exportEquilibriumPath(py::module& m)
 {
+    auto solve1 = static_cast<EquilibriumPathResult(EquilibriumPath::*)(const ChemicalState&, const ChemicalState&)>(&EquilibriumPath::solve);
+    auto solve2 = static_cast<std::vector<EquilibriumPathResult>(EquilibriumPath::*)(const std::vector<ChemicalState>&, const std::vector<ChemicalState>&)>(&EquilibriumPath::solve);
+
     py::class_<EquilibriumPathOptions>(m, "EquilibriumPathOptions")
+        .def(py::init<>())
         .def_readwrite("equilibrium", &EquilibriumPathOptions::equilibrium)
         .def_readwrite("ode", &EquilibriumPathOptions::ode)
+        .def_readwrite("maxstep", &EquilibriumPathOptions::maxstep)
+        .def_readwrite("output_interval", &EquilibriumPathOptions::output_interval)
+        .def_readwrite("output_decimation", &EquilibriumPathOptions::output_decimation)
+        .def_readwrite("num_threads", &EquilibriumPathOptions::num_threads)
         ;
 
     py::class_<EquilibriumPathResult>(m, "EquilibriumPathResult")
@@ -42,7 +50,8 @@ void exportEquilibriumPath(py::module& m)
         .def(py::init<const ChemicalSystem&>())
         .def("setOptions", &EquilibriumPath::setOptions)
         .def("setPartition", &EquilibriumPath::setPartition)
-        .def("solve", &EquilibriumPath::solve)
+        .def("solve", solve1, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2, py::call_guard<py::gil_scoped_release>())
         .def("output", &EquilibriumPath::output)
         .def("plot", &EquilibriumPath::plot)
         .def("plots", &EquilibriumPath::plots)
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumStatistics.hpp>
 
 namespace Reaktoro {
 
@@ -26,12 +27,81 @@ void exportEquilibriumResult(py::module& m)
 {
     py::class_<SmartEquilibriumResult>(m, "SmartEquilibriumResult")
         .def_readwrite("succeeded", &SmartEquilibriumResult::succeeded)
+        .def_readwrite("num_lookups", &SmartEquilibriumResult::num_lookups)
+        .def_readwrite("num_accepted", &SmartEquilibriumResult::num_accepted)
+        .def_readwrite("num_learned", &SmartEquilibriumResult::num_learned)
+        .def_readwrite("time_lookup", &SmartEquilibriumResult::time_lookup)
+        .def_readwrite("time_estimate", &SmartEquilibriumResult::time_estimate)
+        .def_readwrite("time_learn", &SmartEquilibriumResult::time_learn)
+        ;
+
+    py::class_<EquilibriumInitialGuessResult>(m, "EquilibriumInitialGuessResult")
+        .def_readwrite("provider", &EquilibriumInitialGuessResult::provider)
+        .def_readwrite("mismatch", &EquilibriumInitialGuessResult::mismatch)
+        .def_readwrite("iterations_saved", &EquilibriumInitialGuessResult::iterations_saved)
+        ;
+
+    py::enum_<EquilibriumRetryStage>(m, "EquilibriumRetryStage")
+        .value("First", EquilibriumRetryStage::First)
+        .value("WarmRestart", EquilibriumRetryStage::WarmRestart)
+        .value("Alternative", EquilibriumRetryStage::Alternative)
+        .value("ColdStart", EquilibriumRetryStage::ColdStart)
+        ;
+
+    py::class_<EquilibriumRetryStageResult>(m, "EquilibriumRetryStageResult")
+        .def_readwrite("attempts", &EquilibriumRetryStageResult::attempts)
+        .def_readwrite("successes", &EquilibriumRetryStageResult::successes)
+        .def_readwrite("iterations", &EquilibriumRetryStageResult::iterations)
+        .def_readwrite("time", &EquilibriumRetryStageResult::time)
+        ;
+
+    py::class_<EquilibriumRetryResult>(m, "EquilibriumRetryResult")
+        .def_readwrite("stage", &EquilibriumRetryResult::stage)
+        .def_readwrite("timeout", &EquilibriumRetryResult::timeout)
+        .def_readwrite("first", &EquilibriumRetryResult::first)
+        .def_readwrite("warmrestart", &EquilibriumRetryResult::warmrestart)
+        .def_readwrite("alternative", &EquilibriumRetryResult::alternative)
+        .def_readwrite("coldstart", &EquilibriumRetryResult::coldstart)
         ;
 
     py::class_<EquilibriumResult>(m, "EquilibriumResult")
         .def(py::init<>())
         .def_readwrite("optimum", &EquilibriumResult::optimum)
         .def_readwrite("smart", &EquilibriumResult::smart)
+        .def_readwrite("initialguess", &EquilibriumResult::initialguess)
+        .def_readwrite("retry", &EquilibriumResult::retry)
+        .def_readwrite("properties", &EquilibriumResult::properties)
+        ;
+
+    py::class_<EquilibriumInverseBatchResult>(m, "EquilibriumInverseBatchResult")
+        .def(py::init<>())
+        .def_readwrite("titrants", &EquilibriumInverseBatchResult::titrants)
+        .def_readwrite("iterations", &EquilibriumInverseBatchResult::iterations)
+        .def_readwrite("failed", &EquilibriumInverseBatchResult::failed)
+        .def_readwrite("num_samples", &EquilibriumInverseBatchResult::num_samples)
+        .def_readwrite("num_succeeded", &EquilibriumInverseBatchResult::num_succeeded)
+        .def_readwrite("num_failed", &EquilibriumInverseBatchResult::num_failed)
+        .def_readwrite("num_warmstarts", &EquilibriumInverseBatchResult::num_warmstarts)
+        .def_readwrite("num_retries", &EquilibriumInverseBatchResult::num_retries)
+        .def_readwrite("total", &EquilibriumInverseBatchResult::total)
+        .def_readwrite("time", &EquilibriumInverseBatchResult::time)
+        .def_readwrite("throughput", &EquilibriumInverseBatchResult::throughput)
+        ;
+
+    py::class_<EquilibriumStatistics>(m, "EquilibriumStatistics")
+        .def(py::init<>())
+        .def_readwrite("num_calculations", &EquilibriumStatistics::num_calculations)
+        .def_readwrite("num_failures", &EquilibriumStatistics::num_failures)
+        .def_readwrite("num_timeouts", &EquilibriumStatistics::num_timeouts)
+        .def_readwrite("num_restarts", &EquilibriumStatistics::num_restarts)
+        .def_readwrite("num_smart_estimates", &EquilibriumStatistics::num_smart_estimates)
+        .def_readwrite("max_iterations", &EquilibriumStatistics::max_iterations)
+        .def_readwrite("max_time", &EquilibriumStatistics::max_time)
+        .def_readwrite("total", &EquilibriumStatistics::total)
+        .def("add", &EquilibriumStatistics::add)
+        .def("averageIterations", &EquilibriumStatistics::averageIterations)
+        .def("averageTime", &EquilibriumStatistics::averageTime)
+        .def(py::self += py::self)
         ;
 }
 
@@ -18,10 +18,12 @@
 #include <PyReaktoro/PyReaktoro.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumInitialGuess.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
@@ -29,6 +31,35 @@
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The type of the matrices exchanged with numpy arrays in C order without copies
+using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/// Solve the equilibrium problems given by the rows of `b` (element amounts), `T` and `P`.
+/// Each calculation starts from the result of the previous one, and the species amounts of
+/// the equilibrium states are returned in the rows of a matrix, together with the success flags.
+auto solveBatch(EquilibriumSolver& self, ChemicalState& state, VectorConstRef T, VectorConstRef P, Eigen::Ref<const RowMajorMatrix> b) -> py::tuple
+{
+    const Index num_states = b.rows();
+    Assert(T.size() == num_states && P.size() == num_states,
+        "Cannot solve the batch of equilibrium problems.",
+        "The number of temperatures and pressures must match the number of rows of the element amounts.");
+
+    RowMajorMatrix n(num_states, state.system().numSpecies());
+    std::vector<bool> succeeded(num_states);
+    {
+        py::gil_scoped_release release;
+        for(Index i = 0; i < num_states; ++i)
+        {
+            succeeded[i] = self.solve(state, T[i], P[i], Vector(b.row(i))).optimum.succeeded;
+            n.row(i) = state.speciesAmounts();
+        }
+    }
+    return py::make_tuple(n, succeeded);
+}
+
+} // namespace
 
 void exportEquilibriumSolver(py::module& m)
 {
@@ -46,13 +77,15 @@ void exportEquilibriumSolver(py::module& m)
         .def(py::init<const Partition&>())
         .def("setOptions", &EquilibriumSolver::setOptions)
         .def("setPartition", &EquilibriumSolver::setPartition)
-        .def("approximate", approximate1)
-        .def("approximate", approximate2)
-        .def("approximate", approximate3)
-        .def("solve", solve1)
-        .def("solve", solve2)
-        .def("solve", solve3)
-        .def("solve", solve4)
+        .def("setInitialGuessProviders", &EquilibriumSolver::setInitialGuessProviders)
+        .def("approximate", approximate1, py::call_guard<py::gil_scoped_release>())
+        .def("approximate", approximate2, py::call_guard<py::gil_scoped_release>())
+        .def("approximate", approximate3, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve1, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve3, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve4, py::call_guard<py::gil_scoped_release>())
+        .def("solveBatch", solveBatch, py::arg("state"), py::arg("T"), py::arg("P"), py::arg("b"))
         .def("properties", &EquilibriumSolver::properties, py::return_value_policy::reference_internal)
         .def("sensitivity", &EquilibriumSolver::sensitivity, py::return_value_policy::reference_internal)
 //        .def("dndT", &EquilibriumSolver::dndT, py::return_value_policy::reference_internal)
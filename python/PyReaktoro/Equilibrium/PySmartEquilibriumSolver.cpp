@@ -44,12 +44,12 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def(py::init<const ChemicalSystem&>())
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
         .def("setPartition", &SmartEquilibriumSolver::setPartition)
-        .def("learn", learn1)
-        .def("learn", learn2)
-        .def("estimate", estimate1)
-        .def("estimate", estimate2)
-        .def("solve", solve1)
-        .def("solve", solve2)
+        .def("learn", learn1, py::call_guard<py::gil_scoped_release>())
+        .def("learn", learn2, py::call_guard<py::gil_scoped_release>())
+        .def("estimate", estimate1, py::call_guard<py::gil_scoped_release>())
+        .def("estimate", estimate2, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve1, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2, py::call_guard<py::gil_scoped_release>())
         .def("properties", &SmartEquilibriumSolver::properties, py::return_value_policy::reference_internal)
         ;
 }
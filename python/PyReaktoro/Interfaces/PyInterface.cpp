@@ -101,6 +101,16 @@ public:
     {
         PYBIND11_OVERLOAD_PURE(std::shared_ptr<Interface>, Interface, clone);
     }
+
+    auto replicate() const -> std::shared_ptr<Interface>
+    {
+        PYBIND11_OVERLOAD(std::shared_ptr<Interface>, Interface, replicate);
+    }
+
+    auto isReplicable() const -> bool
+    {
+        PYBIND11_OVERLOAD(bool, Interface, isReplicable);
+    }
 };
 
 void exportInterface(py::module& m)
@@ -124,6 +134,8 @@ void exportInterface(py::module& m)
         .def("properties", properties1)
         .def("properties", properties2)
         .def("clone", &Interface::clone)
+        .def("replicate", &Interface::replicate)
+        .def("isReplicable", &Interface::isReplicable)
         .def("formulaMatrix", &Interface::formulaMatrix)
         .def("indexElement", &Interface::indexElement)
         .def("indexSpecies", &Interface::indexSpecies)
@@ -26,10 +26,18 @@ namespace Reaktoro {
 
 void exportInterpreter(py::module& m)
 {
+    py::class_<InterpreterStreamOptions>(m, "InterpreterStreamOptions")
+        .def(py::init<>())
+        .def_readwrite("num_threads", &InterpreterStreamOptions::num_threads)
+        .def_readwrite("window", &InterpreterStreamOptions::window)
+        ;
+
     py::class_<Interpreter>(m, "Interpreter")
         .def(py::init<>())
         .def("executeJsonString", &Interpreter::executeJsonString)
         .def("executeJsonFile", &Interpreter::executeJsonFile)
+        .def("executeJsonStreamFile", &Interpreter::executeJsonStreamFile)
+        .def("executeJsonRequest", &Interpreter::executeJsonRequest, py::call_guard<py::gil_scoped_release>())
         .def("system", &Interpreter::system, py::return_value_policy::reference_internal)
         .def("states", &Interpreter::states, py::return_value_policy::reference_internal)
         .def("state", &Interpreter::state, py::return_value_policy::reference_internal)
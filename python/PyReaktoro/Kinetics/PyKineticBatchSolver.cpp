@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// pybind11 includes
+#include <pybind11/stl.h>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Kinetics/KineticBatchSolver.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+
+namespace Reaktoro {
+
+void exportKineticBatchSolver(py::module& m)
+{
+    auto solve = [](KineticBatchSolver& self, std::vector<ChemicalState> states, double t, double dt)
+    {
+        {
+            py::gil_scoped_release release;
+            self.solve(states, t, dt);
+        }
+        return states;
+    };
+
+    py::class_<KineticBatchSolver>(m, "KineticBatchSolver")
+        .def(py::init<const ReactionSystem&, Index>())
+        .def("setOptions", &KineticBatchSolver::setOptions)
+        .def("setPartition", &KineticBatchSolver::setPartition)
+        .def("size", &KineticBatchSolver::size)
+        .def("reset", &KineticBatchSolver::reset)
+        .def("solve", solve)
+        .def("result", &KineticBatchSolver::result, py::return_value_policy::reference_internal)
+        ;
+}
+
+} // namespace Reaktoro
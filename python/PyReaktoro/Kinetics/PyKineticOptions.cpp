@@ -29,12 +29,35 @@ void exportKineticOptions(py::module& m)
         .def_readwrite("format", &KineticOutputOptions::format)
         ;
 
+    py::class_<KineticSmartEquilibriumOptions>(m, "KineticSmartEquilibriumOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &KineticSmartEquilibriumOptions::active)
+        .def_readwrite("reltol", &KineticSmartEquilibriumOptions::reltol)
+        .def_readwrite("abstol", &KineticSmartEquilibriumOptions::abstol)
+        .def_readwrite("amount_tolerance", &KineticSmartEquilibriumOptions::amount_tolerance)
+        ;
+
     py::class_<KineticOptions>(m, "KineticOptions")
         .def(py::init<>())
         .def_readwrite("equilibrium", &KineticOptions::equilibrium)
         .def_readwrite("ode", &KineticOptions::ode)
+        .def_readwrite("smart", &KineticOptions::smart)
         .def_readwrite("output", &KineticOptions::output)
         ;
+
+    py::class_<KineticBatchOptions>(m, "KineticBatchOptions")
+        .def(py::init<>())
+        .def_readwrite("kinetics", &KineticBatchOptions::kinetics)
+        .def_readwrite("num_threads", &KineticBatchOptions::num_threads)
+        ;
+
+    py::class_<KineticPathOptions>(m, "KineticPathOptions")
+        .def(py::init<>())
+        .def_readwrite("kinetics", &KineticPathOptions::kinetics)
+        .def_readwrite("output_interval", &KineticPathOptions::output_interval)
+        .def_readwrite("output_decimation", &KineticPathOptions::output_decimation)
+        .def_readwrite("num_threads", &KineticPathOptions::num_threads)
+        ;
 }
 
 } // namespace Reaktoro
@@ -26,20 +26,40 @@
 #include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Kinetics/KineticPath.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 
 namespace Reaktoro {
 
 void exportKineticPath(py::module& m)
 {
+    auto setOptions1 = static_cast<void(KineticPath::*)(const KineticOptions&)>(&KineticPath::setOptions);
+    auto setOptions2 = static_cast<void(KineticPath::*)(const KineticPathOptions&)>(&KineticPath::setOptions);
+
+    auto solve1 = static_cast<void(KineticPath::*)(ChemicalState&, double, double, std::string)>(&KineticPath::solve);
+
+    // Solve many kinetic paths, returning the final chemical states together with the results
+    auto solve2 = [](KineticPath& self, std::vector<ChemicalState> states, double t0, double t1, std::string units)
+    {
+        std::vector<KineticResult> results;
+        {
+            py::gil_scoped_release release;
+            results = self.solve(states, t0, t1, units);
+        }
+        return py::make_tuple(states, results);
+    };
+
     py::class_<KineticPath>(m, "KineticPath")
         .def(py::init<const ReactionSystem&>())
-        .def("setOptions", &KineticPath::setOptions)
+        .def("setOptions", setOptions1)
+        .def("setOptions", setOptions2)
         .def("setPartition", &KineticPath::setPartition)
         .def("addSource", &KineticPath::addSource)
         .def("addPhaseSink", &KineticPath::addPhaseSink)
         .def("addFluidSink", &KineticPath::addFluidSink)
         .def("addSolidSink", &KineticPath::addSolidSink)
-        .def("solve", &KineticPath::solve)
+        .def("solve", solve1, py::arg("state"), py::arg("t0"), py::arg("t1"), py::arg("units") = "s", py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2, py::arg("states"), py::arg("t0"), py::arg("t1"), py::arg("units") = "s")
+        .def("result", &KineticPath::result, py::return_value_policy::reference_internal)
         .def("output", &KineticPath::output)
         .def("plot", &KineticPath::plot)
         .def("plots", &KineticPath::plots)
@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// pybind11 includes
+#include <pybind11/stl.h>
+
+// Reaktoro includes
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+
+namespace Reaktoro {
+
+void exportKineticResult(py::module& m)
+{
+    py::class_<KineticSmartEquilibriumResult>(m, "KineticSmartEquilibriumResult")
+        .def(py::init<>())
+        .def_readwrite("num_estimates", &KineticSmartEquilibriumResult::num_estimates)
+        .def_readwrite("num_accepted", &KineticSmartEquilibriumResult::num_accepted)
+        .def_readwrite("num_equilibrium_calculations", &KineticSmartEquilibriumResult::num_equilibrium_calculations)
+        .def_readwrite("time_estimate", &KineticSmartEquilibriumResult::time_estimate)
+        .def_readwrite("time_equilibrium", &KineticSmartEquilibriumResult::time_equilibrium)
+        .def(py::self += py::self)
+        ;
+
+    py::class_<KineticResult>(m, "KineticResult")
+        .def(py::init<>())
+        .def_readwrite("num_function_evals", &KineticResult::num_function_evals)
+        .def_readwrite("num_jacobian_evals", &KineticResult::num_jacobian_evals)
+        .def_readwrite("smart", &KineticResult::smart)
+        .def_readwrite("equilibrium", &KineticResult::equilibrium)
+        .def(py::self += py::self)
+        ;
+
+    py::class_<KineticBatchResult>(m, "KineticBatchResult")
+        .def(py::init<>())
+        .def_readwrite("num_steps", &KineticBatchResult::num_steps)
+        .def_readwrite("num_function_evals", &KineticBatchResult::num_function_evals)
+        .def_readwrite("total", &KineticBatchResult::total)
+        .def_readwrite("time", &KineticBatchResult::time)
+        ;
+}
+
+} // namespace Reaktoro
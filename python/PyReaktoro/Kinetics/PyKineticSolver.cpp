@@ -18,10 +18,13 @@
 #include <PyReaktoro/PyReaktoro.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 #include <Reaktoro/Kinetics/KineticSolver.hpp>
 
 namespace Reaktoro {
@@ -31,6 +34,8 @@ void exportKineticSolver(py::module& m)
     auto step1 = static_cast<double(KineticSolver::*)(ChemicalState&, double)>(&KineticSolver::step);
     auto step2 = static_cast<double(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::step);
 
+    auto solve = static_cast<void(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::solve);
+
     py::class_<KineticSolver>(m, "KineticSolver")
         .def(py::init<const ReactionSystem&>())
         .def("setOptions", &KineticSolver::setOptions)
@@ -39,10 +44,14 @@ void exportKineticSolver(py::module& m)
         .def("addPhaseSink", &KineticSolver::addPhaseSink)
         .def("addFluidSink", &KineticSolver::addFluidSink)
         .def("addSolidSink", &KineticSolver::addSolidSink)
-        .def("initialize", &KineticSolver::initialize)
-        .def("step", step1)
-        .def("step", step2)
-        .def("solve", &KineticSolver::solve)
+        .def("sourceRates", &KineticSolver::sourceRates)
+        .def("initialize", &KineticSolver::initialize, py::call_guard<py::gil_scoped_release>())
+        .def("step", step1, py::call_guard<py::gil_scoped_release>())
+        .def("step", step2, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve, py::call_guard<py::gil_scoped_release>())
+        .def("properties", &KineticSolver::properties, py::return_value_policy::reference_internal)
+        .def("sensitivity", &KineticSolver::sensitivity, py::return_value_policy::reference_internal)
+        .def("result", &KineticSolver::result, py::return_value_policy::reference_internal)
         ;
 }
 
@@ -34,6 +34,22 @@ void exportODE(py::module& m)
         .value("Newton", ODEIterationMode::Newton)
         ;
 
+    py::enum_<ODELinearSolver>(m, "ODELinearSolver")
+        .value("Dense", ODELinearSolver::Dense)
+        .value("Band", ODELinearSolver::Band)
+        .value("Spgmr", ODELinearSolver::Spgmr)
+        .value("Spbcg", ODELinearSolver::Spbcg)
+        .value("Sparse", ODELinearSolver::Sparse)
+        ;
+
+    py::class_<ODELinearSolverOptions>(m, "ODELinearSolverOptions")
+        .def(py::init<>())
+        .def_readwrite("type", &ODELinearSolverOptions::type)
+        .def_readwrite("mupper", &ODELinearSolverOptions::mupper)
+        .def_readwrite("mlower", &ODELinearSolverOptions::mlower)
+        .def_readwrite("max_krylov_dim", &ODELinearSolverOptions::max_krylov_dim)
+        ;
+
     py::class_<ODEOptions>(m, "ODEOptions")
         .def(py::init<>())
         .def_readwrite("step", &ODEOptions::step)
@@ -53,6 +69,7 @@ void exportODE(py::module& m)
         .def_readwrite("max_num_convergence_failures", &ODEOptions::max_num_convergence_failures)
         .def_readwrite("nonlinear_convergence_coefficient", &ODEOptions::nonlinear_convergence_coefficient)
         .def_readwrite("abstols", &ODEOptions::abstols)
+        .def_readwrite("linear_solver", &ODEOptions::linear_solver)
         ;
 
 //
@@ -29,12 +29,15 @@ void exportOptimumResult(py::module& m)
         .def_readwrite("succeeded", &OptimumResult::succeeded)
         .def_readwrite("iterations", &OptimumResult::iterations)
         .def_readwrite("num_objective_evals", &OptimumResult::num_objective_evals)
+        .def_readwrite("num_backtracks", &OptimumResult::num_backtracks)
         .def_readwrite("convergence_rate", &OptimumResult::convergence_rate)
         .def_readwrite("error", &OptimumResult::error)
         .def_readwrite("time", &OptimumResult::time)
         .def_readwrite("time_objective_evals", &OptimumResult::time_objective_evals)
         .def_readwrite("time_constraint_evals", &OptimumResult::time_constraint_evals)
         .def_readwrite("time_linear_systems", &OptimumResult::time_linear_systems)
+        .def_readwrite("time_kkt_decompose", &OptimumResult::time_kkt_decompose)
+        .def_readwrite("time_kkt_solve", &OptimumResult::time_kkt_solve)
         ;
 }
 
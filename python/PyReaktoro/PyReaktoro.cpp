@@ -22,6 +22,7 @@
 namespace Reaktoro {
 
 // Common module
+extern void exportAsyncWriter(py::module& m);
 extern void exportAutoDiff(py::module& m);
 extern void exportEigen(py::module& m);
 extern void exportIndex(py::module& m);
@@ -53,8 +54,11 @@ extern void exportUtils(py::module& m);
 
 // Equilibrium module
 extern void exportEquilibriumCompositionProblem(py::module& m);
+extern void exportEquilibriumInitialGuess(py::module& m);
+extern void exportEquilibriumInverseBatchSolver(py::module& m);
 extern void exportEquilibriumInverseProblem(py::module& m);
 extern void exportEquilibriumOptions(py::module& m);
+extern void exportEquilibriumPacketSolver(py::module& m);
 extern void exportEquilibriumPath(py::module& m);
 extern void exportEquilibriumProblem(py::module& m);
 extern void exportEquilibriumResult(py::module& m);
@@ -73,8 +77,10 @@ extern void exportPhreeqcEditor(py::module& m);
 extern void exportInterpreter(py::module& m);
 
 // Kinetics module
+extern void exportKineticBatchSolver(py::module& m);
 extern void exportKineticOptions(py::module& m);
 extern void exportKineticPath(py::module& m);
+extern void exportKineticResult(py::module& m);
 extern void exportKineticSolver(py::module& m);
 
 // Math module
@@ -115,6 +121,9 @@ extern void exportMesh(py::module& m);
 extern void exportTransportSolver(py::module& m);
 extern void exportReactiveTransportSolver(py::module& m);
 
+// Util module
+extern void exportChemicalSolver(py::module& m);
+
 } // namespace Reaktoro
 
 using namespace Reaktoro;
@@ -124,6 +133,7 @@ PYBIND11_MODULE(PyReaktoro, m)
     py::bind_vector<std::vector<double>>(m, "VectorDouble", "VectorDouble Descriptor");
 
     // Common module
+    exportAsyncWriter(m);
     exportAutoDiff(m);
     exportIndex(m);
     exportOpenlibm(m);
@@ -153,8 +163,11 @@ PYBIND11_MODULE(PyReaktoro, m)
 
     // Equilibrium module
     exportEquilibriumCompositionProblem(m);
+    exportEquilibriumInitialGuess(m);
     exportEquilibriumInverseProblem(m);
+    exportEquilibriumInverseBatchSolver(m);
     exportEquilibriumOptions(m);
+    exportEquilibriumPacketSolver(m);
     exportEquilibriumPath(m);
     exportEquilibriumProblem(m);
     exportEquilibriumResult(m);
@@ -175,7 +188,9 @@ PYBIND11_MODULE(PyReaktoro, m)
     // Kinetics module
     exportKineticOptions(m);
     exportKineticPath(m);
+    exportKineticResult(m);
     exportKineticSolver(m);
+    exportKineticBatchSolver(m);
 
     // Math module
     exportODE(m);
@@ -214,4 +229,7 @@ PYBIND11_MODULE(PyReaktoro, m)
     exportMesh(m);
     exportTransportSolver(m);
     exportReactiveTransportSolver(m);
+
+    // Util module
+    exportChemicalSolver(m);
 }
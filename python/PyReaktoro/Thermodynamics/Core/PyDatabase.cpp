@@ -51,25 +51,25 @@ void exportDatabase(py::module& m)
         .def("elements", &Database::elements)
 		.def("addElement", &Database::addElement)
         .def("aqueousSpecies", aqueousSpecies1)
-        .def("aqueousSpecies", aqueousSpecies2, py::return_value_policy::reference_internal)
+        .def("aqueousSpecies", aqueousSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addAqueousSpecies", &Database::addAqueousSpecies)
         .def("gaseousSpecies", gaseousSpecies1)
-        .def("gaseousSpecies", gaseousSpecies2, py::return_value_policy::reference_internal)
+        .def("gaseousSpecies", gaseousSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addGaseousSpecies", &Database::addGaseousSpecies)
         .def("liquidSpecies", liquidSpecies1)
-        .def("liquidSpecies", liquidSpecies2, py::return_value_policy::reference_internal)
+        .def("liquidSpecies", liquidSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
         .def("addLiquidSpecies", &Database::addLiquidSpecies)
         .def("mineralSpecies", mineralSpecies1)
-        .def("mineralSpecies", mineralSpecies2, py::return_value_policy::reference_internal)
+        .def("mineralSpecies", mineralSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addMineralSpecies", &Database::addMineralSpecies)
-        .def("containsAqueousSpecies", &Database::containsAqueousSpecies)
-        .def("containsGaseousSpecies", &Database::containsGaseousSpecies)
-        .def("containsLiquidSpecies", &Database::containsLiquidSpecies)
-        .def("containsMineralSpecies", &Database::containsMineralSpecies)
-        .def("aqueousSpeciesWithElements", &Database::aqueousSpeciesWithElements)
-        .def("gaseousSpeciesWithElements", &Database::gaseousSpeciesWithElements)
-        .def("liquidSpeciesWithElements", &Database::liquidSpeciesWithElements)
-        .def("mineralSpeciesWithElements", &Database::mineralSpeciesWithElements)
+        .def("containsAqueousSpecies", &Database::containsAqueousSpecies, py::call_guard<py::gil_scoped_release>())
+        .def("containsGaseousSpecies", &Database::containsGaseousSpecies, py::call_guard<py::gil_scoped_release>())
+        .def("containsLiquidSpecies", &Database::containsLiquidSpecies, py::call_guard<py::gil_scoped_release>())
+        .def("containsMineralSpecies", &Database::containsMineralSpecies, py::call_guard<py::gil_scoped_release>())
+        .def("aqueousSpeciesWithElements", &Database::aqueousSpeciesWithElements, py::call_guard<py::gil_scoped_release>())
+        .def("gaseousSpeciesWithElements", &Database::gaseousSpeciesWithElements, py::call_guard<py::gil_scoped_release>())
+        .def("liquidSpeciesWithElements", &Database::liquidSpeciesWithElements, py::call_guard<py::gil_scoped_release>())
+        .def("mineralSpeciesWithElements", &Database::mineralSpeciesWithElements, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
@@ -58,6 +58,7 @@ void exportChemicalField(py::module& m)
         .def("temperature", &ChemicalField::temperature)
         .def("pressure", &ChemicalField::pressure)
         .def("elementAmounts", &ChemicalField::elementAmounts)
+        .def("values", &ChemicalField::values)
         .def("output", &ChemicalField::output)
         .def("__setitem__", ChemicalField_setitem)
         .def("__getitem__", ChemicalField_getitem, py::return_value_policy::reference_internal)
@@ -78,8 +79,8 @@ void exportTransportSolver(py::module& m)
         .def("setTimeStep", &TransportSolver::setTimeStep)
         .def("mesh", &TransportSolver::mesh, py::return_value_policy::reference_internal)
         .def("initialize", &TransportSolver::initialize)
-        .def("step", step1)
-        .def("step", step2)
+        .def("step", step1, py::call_guard<py::gil_scoped_release>())
+        .def("step", step2, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
@@ -95,7 +96,7 @@ void exportReactiveTransportSolver(py::module& m)
         .def("system", &ReactiveTransportSolver::system, py::return_value_policy::reference_internal)
         .def("output", &ReactiveTransportSolver::output)
         .def("initialize", &ReactiveTransportSolver::initialize)
-        .def("step", &ReactiveTransportSolver::step)
+        .def("step", &ReactiveTransportSolver::step, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
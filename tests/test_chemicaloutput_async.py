@@ -0,0 +1,129 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+import pytest
+
+from reaktoro import (
+    AsyncWriterBackPressure,
+    AsyncWriterOptions,
+    ChemicalEditor,
+    ChemicalOutput,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+)
+
+
+@pytest.fixture(scope="module")
+def states():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addMineralPhase("Calcite")
+
+    system = ChemicalSystem(editor)
+
+    states = []
+    for hcl in [0.1, 1.0, 10.0]:
+        problem = EquilibriumProblem(system)
+        problem.add("H2O", 1, "kg")
+        problem.add("HCl", hcl, "mmol")
+        problem.add("CaCO3", 1, "mmol")
+
+        state = ChemicalState(system)
+        equilibrate(state, problem)
+        states.append(state)
+
+    return states
+
+
+def _write_output(states, filename, steps, options=None):
+    output = ChemicalOutput(states[0].system())
+    output.filename(filename)
+    output.add("t")
+    output.add("pH")
+    output.add("speciesMolality(Ca++)", "Ca++")
+    output.attachments(["step", "label"])
+    if options is not None:
+        output.asynchronous(options)
+
+    output.open()
+    for i in range(steps):
+        output.update(states[i % len(states)], i)
+        output.attach(i)
+        output.attach("line{}".format(i))
+    output.close()
+
+
+def _async_options(capacity, backpressure):
+    options = AsyncWriterOptions()
+    options.active = True
+    options.capacity = capacity
+    options.backpressure = backpressure
+    return options
+
+
+@pytest.mark.parametrize("capacity", [1, 4, 1024])
+def test_chemical_output_async_block_matches_sync(states, tmpdir, capacity):
+    sync_filename = str(tmpdir.join("sync.txt"))
+    async_filename = str(tmpdir.join("async.txt"))
+
+    _write_output(states, sync_filename, 200)
+    _write_output(states, async_filename, 200, _async_options(capacity, AsyncWriterBackPressure.Block))
+
+    with open(sync_filename) as file:
+        expected = file.read()
+    with open(async_filename) as file:
+        actual = file.read()
+
+    assert actual == expected
+    assert len(expected.splitlines()) == 201
+
+
+def test_chemical_output_async_drop_keeps_attachments_on_their_lines(states, tmpdir):
+    filename = str(tmpdir.join("drop.txt"))
+
+    steps = 2000
+    _write_output(states, filename, steps, _async_options(1, AsyncWriterBackPressure.Drop))
+
+    with open(filename) as file:
+        lines = file.read().splitlines()
+
+    assert lines[0].split() == ["t", "pH", "Ca++", "step", "label"]
+    assert 1 < len(lines) <= steps + 1
+
+    ph_of_state = {}
+    for line in lines[1:]:
+        words = line.split()
+        assert len(words) == 5
+
+        # The attachments must belong to the line of the update that preceded them
+        t = int(float(words[0]))
+        assert int(words[3]) == t
+        assert words[4] == "line{}".format(t)
+
+        # The quantities must also belong to the state of that update
+        assert ph_of_state.setdefault(t % len(states), words[1]) == words[1]
+
+    # The lines that were not dropped are written in the order of their updates
+    times = [int(float(line.split()[0])) for line in lines[1:]]
+    assert times == sorted(set(times))
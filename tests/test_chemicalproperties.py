@@ -16,6 +16,8 @@
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 
+import gc
+
 import pytest
 
 import numpy as np
@@ -67,3 +69,107 @@ def test_chemical_properties_partial_volumes(chemical_system, chemical_propertie
     only_updated_by_temperature_and_pressure.update(chemical_properties.temperature().val, chemical_properties.pressure().val)
     for pVol in only_updated_by_temperature_and_pressure.partialMolarVolumes().val:
         assert pVol == 0.0
+
+
+def _assert_same_properties(actual, expected):
+    vectors = [
+        "moleFractions",
+        "lnActivityCoefficients",
+        "lnActivities",
+        "chemicalPotentials",
+        "partialMolarVolumes",
+        "phaseMolarGibbsEnergies",
+        "phaseMolarEnthalpies",
+        "phaseMolarVolumes",
+        "phaseDensities",
+        "phaseMasses",
+        "phaseAmounts",
+        "phaseVolumes",
+    ]
+    scalars = ["volume", "fluidVolume", "solidVolume"]
+
+    for name in vectors + scalars:
+        a = getattr(actual, name)()
+        b = getattr(expected, name)()
+        for attr in ["val", "ddT", "ddP", "ddn"]:
+            assert np.asarray(getattr(a, attr)) == pytest.approx(np.asarray(getattr(b, attr)), rel=1e-12, abs=1e-300), name + "." + attr
+
+
+def _fresh_properties(chemical_system, T, P, n):
+    properties = ChemicalProperties(chemical_system)
+    properties.update(T, P, n)
+    return properties
+
+
+def test_chemical_properties_update_of_one_phase(chemical_system):
+    T, P = 300.0, 1e5
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    properties = ChemicalProperties(chemical_system)
+    properties.update(T, P, n)
+
+    # Change only the amounts of the species in the gaseous phase
+    igaseous = chemical_system.indexPhase("Gaseous")
+    n2 = n.copy()
+    for species in chemical_system.phase(igaseous).species():
+        n2[chemical_system.indexSpecies(species.name())] *= 3.0
+
+    skips = properties.counters().num_phase_skips
+    properties.update(n2)
+
+    if chemical_system.hasPhaseModels():
+        assert properties.counters().num_phase_skips == skips + chemical_system.numPhases() - 1
+
+    _assert_same_properties(properties, _fresh_properties(chemical_system, T, P, n2))
+
+    # Updating again with the same amounts must not change any property
+    properties.update(n2)
+    _assert_same_properties(properties, _fresh_properties(chemical_system, T, P, n2))
+
+
+def test_chemical_properties_update_of_temperature_and_pressure(chemical_system):
+    T, P = 300.0, 1e5
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    properties = ChemicalProperties(chemical_system)
+    properties.update(T, P, n)
+
+    # A new temperature and pressure must invalidate every phase, even with unchanged amounts
+    skips = properties.counters().num_phase_skips
+    properties.update(350.0, 50e5, n)
+
+    assert properties.counters().num_phase_skips == skips
+
+    _assert_same_properties(properties, _fresh_properties(chemical_system, 350.0, 50e5, n))
+
+
+def test_chemical_properties_composition_is_a_view(chemical_system):
+    T, P = 300.0, 1e5
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    properties = ChemicalProperties(chemical_system)
+    properties.update(T, P, n)
+
+    composition = properties.composition()
+    assert composition == pytest.approx(n)
+    assert not composition.flags.writeable
+    assert np.shares_memory(composition, properties.composition())
+
+    # The view reflects the species amounts of later updates
+    properties.update(T, P, 2 * n)
+    assert composition == pytest.approx(2 * n)
+
+
+def test_chemical_properties_composition_keeps_properties_alive(chemical_system):
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    def composition_of_temporary_properties():
+        properties = ChemicalProperties(chemical_system)
+        properties.update(300.0, 1e5, n)
+        return properties.composition()
+
+    composition = composition_of_temporary_properties()
+    gc.collect()
+
+    assert composition.base is not None
+    assert composition == pytest.approx(n)
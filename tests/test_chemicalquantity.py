@@ -0,0 +1,166 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalField,
+    ChemicalQuantity,
+    ChemicalState,
+    ChemicalSystem,
+    ChemicalVector,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    ReactionSystem,
+)
+
+
+def _create_calcite_system():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addMineralPhase("Calcite")
+
+    calcite = editor.addMineralReaction("Calcite")
+    calcite.setEquation("Calcite = Ca++ + CO3--")
+    calcite.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    return system, reactions
+
+
+def _create_states(system, hcl_amounts):
+    states = []
+    for hcl in hcl_amounts:
+        problem = EquilibriumProblem(system)
+        problem.add("H2O", 1, "kg")
+        problem.add("HCl", hcl, "mmol")
+        problem.add("CaCO3", 1, "mmol")
+
+        state = ChemicalState(system)
+        equilibrate(state, problem)
+        state.setSpeciesMass("Calcite", 10, "g")
+        states.append(state)
+
+    return states
+
+
+def test_chemical_quantity_values_match_value_per_state():
+    system, reactions = _create_calcite_system()
+    states = _create_states(system, [0.1, 1.0, 10.0, 50.0])
+
+    quantities = [
+        "t",
+        "temperature(units=celsius)",
+        "pH",
+        "ionicStrength",
+        "speciesAmount(Ca++)",
+        "reactionRate(Calcite)",
+    ]
+
+    quantity = ChemicalQuantity(reactions)
+    values = quantity.values(quantities, states)
+
+    assert values.shape == (len(states), len(quantities))
+
+    expected = ChemicalQuantity(reactions)
+    for i, state in enumerate(states):
+        expected.update(state, i)
+        for j, name in enumerate(quantities):
+            assert values[i, j] == pytest.approx(expected.value(name), rel=1e-14, abs=1e-30)
+
+    # The states differ, so the rows must differ too
+    assert len(set(values[:, quantities.index("pH")])) == len(states)
+
+
+def test_chemical_quantity_recomputes_rates_only_after_update():
+    system, reactions = _create_calcite_system()
+    state, = _create_states(system, [1.0])
+
+    num_species = system.numSpecies()
+    calls = []
+
+    def rates(properties):
+        calls.append(None)
+        val = np.array([float(len(calls))])
+        return ChemicalVector(val, np.zeros(1), np.zeros(1), np.zeros((1, num_species)))
+
+    reactions.setRates(rates)
+
+    quantity = ChemicalQuantity(reactions)
+    quantity.update(state)
+
+    # The rates are evaluated lazily, on the first quantity that needs them
+    assert len(calls) == 0
+    assert quantity.value("pH") == pytest.approx(quantity.value("pH"))
+    assert len(calls) == 0
+
+    assert quantity.value("reactionRate(Calcite)") == 1.0
+    assert len(calls) == 1
+
+    # Further queries reuse the rates until the next update
+    assert quantity.value("reactionRate(Calcite)") == 1.0
+    assert quantity.rates().val[0] == 1.0
+    assert len(calls) == 1
+
+    # Changing the state outside the quantity does not recompute the rates
+    state.setSpeciesMass("Calcite", 20, "g")
+    assert quantity.value("reactionRate(Calcite)") == 1.0
+    assert len(calls) == 1
+
+    # An update invalidates the rates, which are recomputed only when needed again
+    quantity.update(state)
+    assert len(calls) == 1
+    assert quantity.value("reactionRate(Calcite)") == 2.0
+    assert len(calls) == 2
+
+
+def test_chemical_field_values_and_output_match_chemical_quantity(tmpdir):
+    system, reactions = _create_calcite_system()
+    states = _create_states(system, [0.1, 1.0, 10.0])
+
+    field = ChemicalField(len(states), system)
+    for i, state in enumerate(states):
+        field[i] = state
+
+    quantities = ["pH", "ionicStrength", "speciesMolality(Ca++)"]
+
+    quantity = ChemicalQuantity(system)
+    expected = quantity.values(quantities, states)
+
+    assert field.values(quantities) == pytest.approx(expected, rel=1e-14)
+
+    filename = str(tmpdir.join("field.txt"))
+    field.output(filename, quantities)
+
+    with open(filename) as file:
+        header = file.readline().split()
+    assert header == quantities
+
+    # The file is written with the default precision of six significant digits
+    output = np.loadtxt(filename, skiprows=1, ndmin=2)
+    assert output == pytest.approx(expected, rel=1e-5)
@@ -0,0 +1,137 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalSolver,
+    ChemicalSolverOptions,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    EquilibriumOptions,
+    EquilibriumProblem,
+    EquilibriumSolver,
+    Partition,
+)
+
+
+def _create_field(npoints):
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Halite")
+
+    system = ChemicalSystem(editor)
+    partition = Partition(system)
+
+    T = np.linspace(30.0, 90.0, npoints) + 273.15
+    P = np.linspace(10.0, 100.0, npoints) * 1e5
+
+    # One column of element amounts per field point, with enough NaCl in the last points to precipitate halite
+    be = np.zeros((system.numElements(), npoints))
+    for k in range(npoints):
+        problem = EquilibriumProblem(system)
+        problem.add("H2O", 1, "kg")
+        problem.add("CO2", 0.5 + 0.1*k, "mol")
+        problem.add("NaCl", 1.0 + 2.0*k, "mol")
+        be[:, k] = problem.elementAmounts()
+
+    return system, partition, T, P, be
+
+
+def _equilibrate_points(system, T, P, be):
+    states = []
+    for k in range(len(T)):
+        state = ChemicalState(system)
+        result = EquilibriumSolver(system).solve(state, T[k], P[k], be[:, k])
+        assert result.optimum.succeeded
+        states.append(state)
+    return states
+
+
+def test_chemical_solver_equilibrate_matches_single_point_equilibrate():
+    npoints = 6
+    system, partition, T, P, be = _create_field(npoints)
+
+    options = ChemicalSolverOptions()
+    options.num_threads = 4
+
+    solver = ChemicalSolver(system, npoints)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+    solver.equilibrate(T, P, be)
+
+    assert len(solver.result().failed) == 0
+
+    ifluids = partition.indicesFluidPhases()
+    expected = _equilibrate_points(system, T, P, be)
+
+    for k, expected_state in enumerate(expected):
+        state = solver.state(k)
+        assert state.speciesAmounts() == pytest.approx(expected_state.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+        properties = expected_state.properties()
+        assert solver.porosity().val[k] == pytest.approx(1.0 - properties.solidVolume().val, rel=1e-6)
+
+        volumes = properties.phaseVolumes().val[ifluids]
+        saturations = [saturation.val[k] for saturation in solver.fluidSaturations()]
+        assert saturations == pytest.approx(volumes/volumes.sum(), rel=1e-6, abs=1e-14)
+
+
+def test_chemical_solver_reports_failed_points():
+    npoints = 4
+    system, partition, T, P, be = _create_field(npoints)
+
+    expected = _equilibrate_points(system, T, P, be)
+
+    # A single iteration is enough at the points whose states are already in equilibrium,
+    # but not at the cold-started one
+    options = ChemicalSolverOptions()
+    options.equilibrium.optimum.max_iterations = 1
+    options.equilibrium.retry.pass_iterations = 1
+
+    solver = ChemicalSolver(system, npoints)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    icold = 2
+    for k in range(npoints):
+        if k != icold:
+            solver.setStateAt(k, expected[k])
+
+    solver.equilibrate(T, P, be)
+
+    assert list(solver.result().failed) == [icold]
+
+    for k in range(npoints):
+        if k != icold:
+            assert solver.state(k).speciesAmounts() == pytest.approx(expected[k].speciesAmounts(), rel=1e-6, abs=1e-14)
+
+    # The failed point succeeds once enough iterations are allowed
+    options.equilibrium.optimum.max_iterations = 200
+    options.equilibrium.retry.pass_iterations = 10
+    solver.setOptions(options)
+    solver.equilibrate(T, P, be)
+
+    assert len(solver.result().failed) == 0
+    assert solver.state(icold).speciesAmounts() == pytest.approx(expected[icold].speciesAmounts(), rel=1e-6, abs=1e-14)
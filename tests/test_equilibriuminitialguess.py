@@ -0,0 +1,123 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    EquilibriumOptions,
+    EquilibriumProblem,
+    EquilibriumSolver,
+    neighbourInitialGuess,
+    Partition,
+    previousInitialGuess,
+)
+
+
+def _create_system():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+
+    return ChemicalSystem(editor)
+
+
+def _element_amounts(system, co2):
+    problem = EquilibriumProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.5, "mol")
+    problem.add("CO2", co2, "mol")
+    return problem.elementAmounts()
+
+
+def _create_solver(system, providers, mismatch):
+    options = EquilibriumOptions()
+    options.initialguess.mismatch = mismatch
+
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+    solver.setInitialGuessProviders(providers)
+
+    return solver
+
+
+T, P = 60.0 + 273.15, 100e5
+
+
+def test_equilibrium_solver_uses_neighbour_initial_guess():
+    system = _create_system()
+    partition = Partition(system)
+
+    neighbour = ChemicalState(system)
+    solver = _create_solver(system, [neighbourInitialGuess(neighbour, partition)], 0.1)
+
+    # The neighbour has no amounts yet, so the first calculation is cold-started
+    cold = solver.solve(neighbour, T, P, _element_amounts(system, 1.0))
+    assert cold.optimum.succeeded
+    assert cold.initialguess.provider == "coldstart"
+    assert cold.initialguess.iterations_saved == 0
+
+    # The element amounts of the neighbour differ by less than the accepted mismatch
+    state = ChemicalState(system)
+    result = solver.solve(state, T, P, _element_amounts(system, 1.01))
+    assert result.optimum.succeeded
+    assert result.initialguess.provider == "neighbour"
+    assert 0 < result.initialguess.mismatch <= 0.1
+    assert result.initialguess.iterations_saved == pytest.approx(cold.optimum.iterations - result.optimum.iterations)
+
+
+def test_equilibrium_solver_uses_previous_initial_guess():
+    system = _create_system()
+    partition = Partition(system)
+
+    solver = _create_solver(system, [previousInitialGuess(partition)], 0.1)
+
+    state = ChemicalState(system)
+    cold = solver.solve(state, T, P, _element_amounts(system, 1.0))
+    assert cold.initialguess.provider == "coldstart"
+
+    result = solver.solve(state, T, P, _element_amounts(system, 1.01))
+    assert result.optimum.succeeded
+    assert result.initialguess.provider == "previous"
+    assert 0 < result.initialguess.mismatch <= 0.1
+    assert result.initialguess.iterations_saved == pytest.approx(cold.optimum.iterations - result.optimum.iterations)
+
+
+def test_equilibrium_solver_cold_starts_if_mismatch_is_too_large():
+    system = _create_system()
+    partition = Partition(system)
+
+    solver = _create_solver(system, [previousInitialGuess(partition)], 1e-6)
+
+    state = ChemicalState(system)
+    solver.solve(state, T, P, _element_amounts(system, 1.0))
+
+    # The previous state misses 10% of the carbon, far more than the accepted mismatch
+    result = solver.solve(state, T, P, _element_amounts(system, 1.1))
+    assert result.optimum.succeeded
+    assert result.initialguess.provider == "coldstart"
+    assert result.initialguess.iterations_saved == 0
+
+    expected = ChemicalState(system)
+    EquilibriumSolver(system).solve(expected, T, P, _element_amounts(system, 1.1))
+    assert state.speciesAmounts() == pytest.approx(expected.speciesAmounts(), rel=1e-6, abs=1e-14)
@@ -0,0 +1,117 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalProperty,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumInverseBatchOptions,
+    EquilibriumInverseBatchSolver,
+    EquilibriumInverseProblem,
+)
+
+
+def _create_inverse_problem():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+
+    system = ChemicalSystem(editor)
+
+    problem = EquilibriumInverseProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.1, "mol")
+    problem.add("CO2", 0.5, "mol")
+    problem.pH(7.0, "HCl", "NaOH")
+    problem.fixSpeciesAmount("Cl-", 100, "mmol")
+
+    return system, problem
+
+
+def _create_samples(system, problem, size):
+    pHs = np.linspace(4.0, 9.0, size)
+    T = np.full(size, 298.15)
+    P = np.full(size, 1e5)
+
+    # The targets are given as when the constraints were imposed: pH, and the amount of Cl- in mmol
+    values = np.column_stack([pHs, np.linspace(50.0, 150.0, size)])
+    b = np.tile(problem.elementInitialAmounts(), (size, 1))
+
+    states = [ChemicalState(system) for _ in range(size)]
+
+    return states, T, P, values, b
+
+
+def _solve_batch(problem, states, T, P, values, b, num_threads):
+    options = EquilibriumInverseBatchOptions()
+    options.num_threads = num_threads
+
+    solver = EquilibriumInverseBatchSolver(problem)
+    solver.setOptions(options)
+
+    return solver.solve(states, T, P, values, b)
+
+
+def test_equilibrium_inverse_batch_solver_takes_targets_in_user_units():
+    system, problem = _create_inverse_problem()
+
+    assert problem.numConstraintTargets() == 2
+
+    states, T, P, values, b = _create_samples(system, problem, 8)
+
+    batch_states = _solve_batch(problem, states, T, P, values, b, 4)
+
+    pH_property = ChemicalProperty.pH(system)
+
+    for (pH, amount), batch_state in zip(values, batch_states):
+        assert pH_property(batch_state.properties()).val == pytest.approx(pH, rel=1e-6)
+        assert batch_state.speciesAmount("Cl-") == pytest.approx(amount * 1e-3, rel=1e-6)
+
+
+def test_equilibrium_inverse_batch_solver_matches_serial_equilibrate():
+    system, problem = _create_inverse_problem()
+    states, T, P, values, b = _create_samples(system, problem, 8)
+
+    batch_states = _solve_batch(problem, states, T, P, values, b, 4)
+
+    for (pH, amount), batch_state in zip(values, batch_states):
+        _, serial_problem = _create_inverse_problem()
+        serial_problem.setConstraintTargets([pH, amount])
+
+        state = ChemicalState(system)
+        equilibrate(state, serial_problem)
+
+        assert batch_state.speciesAmounts() == pytest.approx(state.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+
+def test_equilibrium_inverse_batch_solver_is_independent_of_number_of_threads():
+    system, problem = _create_inverse_problem()
+    states, T, P, values, b = _create_samples(system, problem, 16)
+
+    serial_states = _solve_batch(problem, states, T, P, values, b, 1)
+    parallel_states = _solve_batch(problem, states, T, P, values, b, 4)
+
+    for serial_state, parallel_state in zip(serial_states, parallel_states):
+        assert parallel_state.speciesAmounts() == pytest.approx(serial_state.speciesAmounts(), rel=1e-12, abs=1e-16)
@@ -0,0 +1,111 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    EquilibriumOptions,
+    EquilibriumPacketSolver,
+    EquilibriumProblem,
+    EquilibriumSolver,
+)
+
+
+def _create_packet_problems(size):
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+
+    system = ChemicalSystem(editor)
+
+    T = np.linspace(25.0, 90.0, size) + 273.15
+    P = np.full(size, 100e5)
+
+    # One column of element amounts per problem, with increasing amounts of CO2
+    be = np.zeros((system.numElements(), size))
+    for k in range(size):
+        problem = EquilibriumProblem(system)
+        problem.add("H2O", 1, "kg")
+        problem.add("NaCl", 0.5, "mol")
+        problem.add("CO2", 0.1 + 0.2*k, "mol")
+        be[:, k] = problem.elementAmounts()
+
+    return system, T, P, be
+
+
+def _solve_with_equilibrium_solver(system, T, P, be):
+    solver = EquilibriumSolver(system)
+
+    states = []
+    for k in range(len(T)):
+        state = ChemicalState(system)
+        result = solver.solve(state, T[k], P[k], be[:, k])
+        assert result.optimum.succeeded
+        states.append(state)
+
+    return states
+
+
+def test_equilibrium_packet_solver_matches_equilibrium_solver():
+    # Use more problems than lanes so that the last packet is partially filled
+    size = EquilibriumPacketSolver.lanes + 3
+    system, T, P, be = _create_packet_problems(size)
+
+    solver = EquilibriumPacketSolver(system)
+    states, results = solver.solve([ChemicalState(system) for _ in range(size)], T, P, be)
+
+    expected = _solve_with_equilibrium_solver(system, T, P, be)
+
+    for state, result, expected_state in zip(states, results, expected):
+        assert result.optimum.succeeded
+        assert state.speciesAmounts() == pytest.approx(expected_state.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+
+def test_equilibrium_packet_solver_falls_back_to_equilibrium_solver():
+    size = EquilibriumPacketSolver.lanes
+    system, T, P, be = _create_packet_problems(size)
+
+    expected = _solve_with_equilibrium_solver(system, T, P, be)
+
+    # Warm-start all lanes from their solutions, except the last one, which is cold-started
+    # and cannot converge within the few lockstep iterations allowed below
+    initial = [state.clone() for state in expected[:-1]] + [ChemicalState(system)]
+
+    options = EquilibriumOptions()
+    options.optimum.max_iterations = 3
+    options.retry.coldstart.max_iterations = 200
+
+    solver = EquilibriumPacketSolver(system)
+    solver.setOptions(options)
+    states, results = solver.solve(initial, T, P, be)
+
+    # Only the lanes solved again with the standard solver have their retry counters set
+    for result in results[:-1]:
+        assert result.retry.first.attempts == 0
+    assert results[-1].retry.first.attempts == 1
+
+    for state, result, expected_state in zip(states, results, expected):
+        assert result.optimum.succeeded
+        assert state.speciesAmounts() == pytest.approx(expected_state.speciesAmounts(), rel=1e-6, abs=1e-14)
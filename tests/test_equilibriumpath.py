@@ -0,0 +1,106 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumPath,
+    EquilibriumPathOptions,
+    EquilibriumProblem,
+)
+
+
+def _create_chemical_system():
+    editor = ChemicalEditor(Database("supcrt98.xml"))
+    editor.addAqueousPhaseWithElements("H O Ca C Cl")
+    editor.addMineralPhase("Calcite")
+    return ChemicalSystem(editor)
+
+
+def _equilibrate_with_hcl(system, hcl):
+    problem = EquilibriumProblem(system)
+    problem.setTemperature(30.0, "celsius")
+    problem.setPressure(1.0, "bar")
+    problem.add("H2O", 1, "kg")
+    problem.add("CaCO3", 1, "g")
+    problem.add("HCl", hcl, "mmol")
+    return equilibrate(problem)
+
+
+def _solve_with_output(path, state_i, state_f, filename):
+    output = path.output()
+    output.filename(str(filename))
+    output.add("elementAmount(Cl units=mmol)")
+    output.add("pH")
+    output.add("speciesMass(Calcite units=g)")
+    path.solve(state_i, state_f)
+    output.close()
+    return np.loadtxt(str(filename), skiprows=1, ndmin=2)
+
+
+def test_equilibrium_path_solved_twice_gives_same_results(tmp_path):
+    system = _create_chemical_system()
+    state_i = _equilibrate_with_hcl(system, 0.0)
+    state_f = _equilibrate_with_hcl(system, 1.0)
+
+    # The second calculation reuses the solvers of the first one
+    path = EquilibriumPath(system)
+    first = _solve_with_output(path, state_i, state_f, tmp_path / "first.txt")
+    second = _solve_with_output(path, state_i, state_f, tmp_path / "second.txt")
+
+    assert first.shape == second.shape
+    assert second == pytest.approx(first, rel=1e-12)
+
+
+def test_equilibrium_path_batch_matches_single_paths():
+    system = _create_chemical_system()
+    states_i = [_equilibrate_with_hcl(system, 0.0) for _ in range(3)]
+    states_f = [_equilibrate_with_hcl(system, hcl) for hcl in [0.5, 1.0, 2.0]]
+
+    results = EquilibriumPath(system).solve(states_i, states_f)
+    assert len(results) == len(states_i)
+
+    path = EquilibriumPath(system)
+    for state_i, state_f, result in zip(states_i, states_f, results):
+        expected = path.solve(state_i, state_f)
+        assert result.equilibrium.optimum.iterations == expected.equilibrium.optimum.iterations
+
+
+def test_equilibrium_path_output_interval(tmp_path):
+    system = _create_chemical_system()
+    state_i = _equilibrate_with_hcl(system, 0.0)
+    state_f = _equilibrate_with_hcl(system, 1.0)
+
+    options = EquilibriumPathOptions()
+    options.output_interval = 0.25
+
+    path = EquilibriumPath(system)
+    path.setOptions(options)
+    rows = _solve_with_output(path, state_i, state_f, tmp_path / "output.txt")
+
+    # One row at each multiple of the interval in [0, 1), and one for the final state
+    assert len(rows) == 5
+
+    # The amount of Cl varies linearly along the path, so the rows are equally spaced in it
+    assert rows[:, 0] == pytest.approx(np.linspace(0.0, 1.0, 5), abs=1e-3)
@@ -0,0 +1,154 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    EquilibriumOptions,
+    EquilibriumProblem,
+    EquilibriumSolver,
+    EquilibriumStatistics,
+)
+
+
+def _create_equilibrium_problem(co2):
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Halite")
+
+    system = ChemicalSystem(editor)
+
+    problem = EquilibriumProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.5, "mol")
+    problem.add("CO2", co2, "mol")
+    problem.setTemperature(60, "celsius")
+    problem.setPressure(100, "bar")
+
+    return system, problem
+
+
+def _check_counters(result):
+    optimum = result.optimum
+    properties = result.properties
+
+    assert optimum.succeeded
+    assert optimum.iterations > 0
+
+    # Every iteration evaluates the Gibbs energy function at least once, and each
+    # evaluation is one evaluation of the chemical model of the system
+    assert optimum.num_objective_evals >= optimum.iterations
+    assert properties.num_chemical_evals == optimum.num_objective_evals
+
+    # The time in linear systems is split into the decomposition and the solution of the KKT equations
+    assert optimum.time_kkt_decompose >= 0
+    assert optimum.time_kkt_solve >= 0
+    assert optimum.time_linear_systems == pytest.approx(optimum.time_kkt_decompose + optimum.time_kkt_solve)
+
+    assert 0 <= optimum.time_objective_evals <= optimum.time
+    assert properties.num_thermo_evals <= properties.num_thermo_updates
+    assert properties.time_chemical_model >= 0
+
+
+def test_equilibrium_result_counters_are_filled_in():
+    system, problem = _create_equilibrium_problem(1.0)
+
+    solver = EquilibriumSolver(system)
+
+    state = ChemicalState(system)
+    first = solver.solve(state, problem)
+    _check_counters(first)
+
+    # The thermodynamic model is evaluated once, at the temperature and pressure of the problem
+    assert first.properties.num_thermo_updates >= 1
+    assert first.properties.num_thermo_evals == 1
+
+    # The counters are reset at the start of each calculation, and the thermodynamic
+    # model is not evaluated again at the same temperature and pressure
+    _, problem = _create_equilibrium_problem(1.1)
+    second = solver.solve(state, problem)
+    _check_counters(second)
+    assert second.properties.num_thermo_updates >= 1
+    assert second.properties.num_thermo_evals == 0
+
+
+def test_equilibrium_result_phase_timing():
+    system, problem = _create_equilibrium_problem(1.0)
+
+    options = EquilibriumOptions()
+    options.phase_timing = True
+
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+
+    state = ChemicalState(system)
+    result = solver.solve(state, problem)
+    _check_counters(result)
+
+    properties = result.properties
+    if system.hasPhaseModels():
+        assert len(properties.time_chemical_model_phases) == system.numPhases()
+        assert len(properties.time_thermo_model_phases) == system.numPhases()
+        assert min(properties.time_chemical_model_phases) >= 0
+        assert sum(properties.time_chemical_model_phases) <= properties.time_chemical_model
+    else:
+        assert len(properties.time_chemical_model_phases) == 0
+        assert len(properties.time_thermo_model_phases) == 0
+
+
+def test_equilibrium_statistics_aggregate_results():
+    system, problem = _create_equilibrium_problem(1.0)
+
+    solver = EquilibriumSolver(system)
+    state = ChemicalState(system)
+
+    statistics = EquilibriumStatistics()
+    results = []
+    for co2 in [1.0, 1.1, 1.2]:
+        _, problem = _create_equilibrium_problem(co2)
+        results.append(solver.solve(state, problem))
+        statistics.add(results[-1])
+
+    iterations = [result.optimum.iterations for result in results]
+
+    assert statistics.num_calculations == 3
+    assert statistics.num_failures == 0
+    assert statistics.num_restarts == 0
+    assert statistics.max_iterations == max(iterations)
+    assert statistics.total.optimum.iterations == sum(iterations)
+    assert statistics.averageIterations() == pytest.approx(sum(iterations)/3)
+    assert statistics.total.properties.num_chemical_evals == sum(result.properties.num_chemical_evals for result in results)
+
+    # Merging per-thread statistics is the same as adding all results to one instance
+    merged = EquilibriumStatistics()
+    merged.add(results[0])
+    other = EquilibriumStatistics()
+    other.add(results[1])
+    other.add(results[2])
+    merged += other
+
+    assert merged.num_calculations == statistics.num_calculations
+    assert merged.max_iterations == statistics.max_iterations
+    assert merged.total.optimum.iterations == statistics.total.optimum.iterations
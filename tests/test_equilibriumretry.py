@@ -0,0 +1,185 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumOptions,
+    EquilibriumProblem,
+    EquilibriumRetryStage,
+    EquilibriumSolver,
+    KineticOptions,
+    KineticSolver,
+    Partition,
+    ReactionSystem,
+)
+
+
+def _create_equilibrium_problem():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+
+    system = ChemicalSystem(editor)
+
+    problem = EquilibriumProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.5, "mol")
+    problem.add("CO2", 1, "mol")
+    problem.setTemperature(60, "celsius")
+    problem.setPressure(100, "bar")
+
+    return system, problem
+
+
+def test_equilibrium_solver_escalates_through_retry_stages():
+    system, problem = _create_equilibrium_problem()
+
+    # Allow a single iteration in the first attempt, the warm restart and the alternative
+    # method, so that only the cold-start stage has enough iterations to converge
+    options = EquilibriumOptions()
+    options.optimum.max_iterations = 1
+    options.retry.pass_iterations = 1
+    options.retry.warmrestart.max_iterations = 1
+    options.retry.alternative.max_iterations = 1
+    options.retry.coldstart.max_iterations = 200
+
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+
+    state = ChemicalState(system)
+    result = solver.solve(state, problem)
+
+    assert result.optimum.succeeded
+    assert result.retry.stage == EquilibriumRetryStage.ColdStart
+    assert not result.retry.timeout
+
+    for stage in [result.retry.first, result.retry.warmrestart, result.retry.alternative]:
+        assert stage.attempts == 1
+        assert stage.successes == 0
+        assert stage.iterations <= 1
+
+    assert result.retry.coldstart.attempts == 1
+    assert result.retry.coldstart.successes == 1
+    assert result.retry.coldstart.iterations > 1
+
+    expected = ChemicalState(system)
+    equilibrate(expected, problem)
+
+    assert state.speciesAmounts() == pytest.approx(expected.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+
+def test_equilibrium_solver_skips_disabled_retry_stages():
+    system, problem = _create_equilibrium_problem()
+
+    options = EquilibriumOptions()
+    options.optimum.max_iterations = 1
+    options.retry.pass_iterations = 1
+
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+
+    state = ChemicalState(system)
+    result = solver.solve(state, problem)
+
+    assert not result.optimum.succeeded
+    assert result.retry.stage == EquilibriumRetryStage.First
+    assert result.retry.first.attempts == 1
+    assert result.retry.warmrestart.attempts == 0
+    assert result.retry.alternative.attempts == 0
+    assert result.retry.coldstart.attempts == 0
+
+
+def _create_kinetic_problem():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addMineralPhase("Calcite")
+
+    calcite = editor.addMineralReaction("Calcite")
+    calcite.setEquation("Calcite = Ca++ + CO3--")
+    calcite.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+
+    state = ChemicalState(system)
+    equilibrate(state, problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+
+    return system, reactions, partition, state
+
+
+def _solve_kinetics(reactions, partition, state, options):
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+    solver.solve(state, 0.0, 60.0)
+    return solver.result()
+
+
+def test_kinetic_solver_falls_back_to_cold_start():
+    system, reactions, partition, state = _create_kinetic_problem()
+
+    expected = state.clone()
+    _solve_kinetics(reactions, partition, expected, KineticOptions())
+
+    # Invalid dual potentials of the elements make the warm-started equilibrium calculation fail,
+    # whereas the cold-start stage configured implicitly by KineticSolver recomputes them
+    state.setElementDualPotentials(np.full(system.numElements(), np.nan))
+
+    result = _solve_kinetics(reactions, partition, state, KineticOptions())
+
+    assert result.equilibrium.retry.coldstart.attempts >= 1
+    assert result.equilibrium.retry.coldstart.successes == result.equilibrium.retry.coldstart.attempts
+    assert state.speciesAmounts() == pytest.approx(expected.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+
+def test_kinetic_solver_uses_configured_retry_stages():
+    system, reactions, partition, state = _create_kinetic_problem()
+
+    state.setElementDualPotentials(np.full(system.numElements(), np.nan))
+
+    # No implicit cold-start stage is added if a retry stage has been configured
+    options = KineticOptions()
+    options.equilibrium.retry.warmrestart.max_iterations = 200
+
+    result = _solve_kinetics(reactions, partition, state, options)
+
+    assert result.equilibrium.retry.warmrestart.attempts >= 1
+    assert result.equilibrium.retry.warmrestart.successes == result.equilibrium.retry.warmrestart.attempts
+    assert result.equilibrium.retry.coldstart.attempts == 0
@@ -15,6 +15,9 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+import numpy as np
+import pytest
+
 from reaktoro import EquilibriumSolver, ChemicalState, EquilibriumProblem, equilibrate
 
 
@@ -96,3 +99,31 @@ def test_equilibrium_solver_with_chemical_state(partition_with_inert_gaseous_pha
     assert state.speciesAmount('CO2(g)') == 1.0
     assert state.speciesAmount('H2O(g)') == 0.001
 
+
+def test_equilibrium_solver_solve_batch_matches_solve_per_row(chemical_system):
+    problem = EquilibriumProblem(chemical_system)
+    problem.add('H2O', 1, 'kg')
+    problem.add('CO2', 1, 'mol')
+
+    state = ChemicalState(chemical_system)
+    equilibrate(state, problem)
+
+    # One row of element amounts per problem, each one at a different temperature and pressure
+    b0 = state.elementAmounts()
+    b = np.array([b0, 1.5 * b0, 2.0 * b0, 0.5 * b0])
+    T = np.array([300.0, 320.0, 340.0, 360.0])
+    P = np.array([1e5, 2e5, 5e5, 1e6])
+
+    solver = EquilibriumSolver(chemical_system)
+    n, succeeded = solver.solveBatch(state.clone(), T, P, b)
+
+    assert n.shape == (len(b), chemical_system.numSpecies())
+    assert list(succeeded) == [True] * len(b)
+
+    # Each calculation of the batch starts from the result of the previous one
+    expected_solver = EquilibriumSolver(chemical_system)
+    expected_state = state.clone()
+    for i in range(len(b)):
+        result = expected_solver.solve(expected_state, T[i], P[i], b[i])
+        assert result.optimum.succeeded
+        assert n[i] == pytest.approx(expected_state.speciesAmounts(), rel=1e-12, abs=1e-20)
@@ -0,0 +1,97 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import json
+
+import pytest
+
+from reaktoro import Interpreter
+
+
+SYSTEM = {"database": "supcrt98.xml", "elements": ["H", "O", "C", "Na", "Cl", "Ca"]}
+
+EQUILIBRIUM = {
+    "stateReference": "State1",
+    "temperature": {"value": 60, "units": "celsius"},
+    "pressure": {"value": 100, "units": "bar"},
+    "substances": [
+        {"substance": "H2O", "quantity": 1, "units": "kg"},
+        {"substance": "NaCl", "quantity": 0.1, "units": "mol"},
+        {"substance": "CaCO3", "quantity": 1, "units": "g"},
+    ],
+}
+
+
+def _request(interpreter, request):
+    return json.loads(interpreter.executeJsonRequest(json.dumps(request)))
+
+
+def test_interpreter_server_equilibrium_request():
+    interpreter = Interpreter()
+
+    first = _request(interpreter, {"id": 7, "system": SYSTEM, "equilibrium": EQUILIBRIUM, "quantities": ["pH"]})
+    second = _request(interpreter, {"id": 8, "system": SYSTEM, "equilibrium": EQUILIBRIUM})
+
+    assert "error" not in first and "error" not in second
+    assert first["id"] == 7 and second["id"] == 8
+
+    # Only the first request for a system pays for its construction
+    assert first["cached"] is False
+    assert second["cached"] is True
+
+    assert "pH" in first["quantities"]
+    assert first["time"]["total"] >= first["time"]["calculation"]
+
+    # The response matches the interpreter executing the same calculation
+    expected = Interpreter()
+    expected.executeJsonString(json.dumps({"system": SYSTEM, "calculations": [{"equilibrium": EQUILIBRIUM}]}))
+    n = expected.state("State1").speciesAmounts()
+
+    assert first["speciesAmounts"] == pytest.approx(n, rel=1e-10, abs=1e-16)
+    assert second["speciesAmounts"] == pytest.approx(n, rel=1e-10, abs=1e-16)
+
+
+def test_interpreter_server_state_request():
+    interpreter = Interpreter()
+
+    equilibrium = _request(interpreter, {"system": SYSTEM, "equilibrium": EQUILIBRIUM, "quantities": ["pH"]})
+
+    state = {
+        "temperature": {"value": equilibrium["temperature"], "units": "K"},
+        "pressure": {"value": equilibrium["pressure"], "units": "Pa"},
+        "speciesAmounts": equilibrium["speciesAmounts"],
+    }
+
+    response = _request(interpreter, {"system": SYSTEM, "state": state, "quantities": ["pH"]})
+
+    assert "error" not in response
+    assert response["cached"] is True
+    assert response["speciesAmounts"] == pytest.approx(equilibrium["speciesAmounts"])
+
+    # The quantities are evaluated at the given state, which is the calculated equilibrium state
+    assert response["quantities"]["pH"] == pytest.approx(equilibrium["quantities"]["pH"], rel=1e-10)
+
+
+def test_interpreter_server_rejects_unsupported_requests():
+    interpreter = Interpreter()
+
+    # Entries of the system specification other than database and elements are not silently ignored
+    system = dict(SYSTEM, phases=[{"aqueous": ["H2O(l)", "H+", "OH-"]}])
+    assert "error" in _request(interpreter, {"system": system, "equilibrium": EQUILIBRIUM})
+
+    assert "error" in _request(interpreter, {"equilibrium": EQUILIBRIUM})
+    assert "error" in json.loads(interpreter.executeJsonRequest("not json"))
@@ -0,0 +1,101 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import json
+
+import pytest
+
+from reaktoro import Interpreter, InterpreterStreamOptions
+
+
+SYSTEM = {"database": "supcrt98.xml", "elements": ["H", "O", "C", "Na", "Cl", "Ca"]}
+
+
+def _equilibrium(reference, nacl):
+    return {
+        "stateReference": reference,
+        "temperature": {"value": 60, "units": "celsius"},
+        "pressure": {"value": 100, "units": "bar"},
+        "substances": [
+            {"substance": "H2O", "quantity": 1, "units": "kg"},
+            {"substance": "NaCl", "quantity": nacl, "units": "mol"},
+            {"substance": "CaCO3", "quantity": 1, "units": "g"},
+        ],
+    }
+
+
+def _execute_stream(tmpdir, lines, num_threads):
+    infile = tmpdir / "input.ndjson"
+    outfile = tmpdir / "output-{}.ndjson".format(num_threads)
+    infile.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+    options = InterpreterStreamOptions()
+    options.num_threads = num_threads
+    options.window = 2
+
+    Interpreter().executeJsonStreamFile(str(infile), str(outfile), options)
+
+    return [json.loads(line) for line in outfile.read_text(encoding="utf-8").splitlines()]
+
+
+def test_interpreter_stream_round_trip(tmpdir):
+    calculations = [_equilibrium("State{}".format(i), 0.1 * (i + 1)) for i in range(6)]
+
+    lines = [json.dumps({"system": SYSTEM})]
+    lines += [json.dumps({"equilibrium": calculation}) for calculation in calculations[:3]]
+    lines += ["", "not json"]
+    lines += [json.dumps({"calculations": [{"equilibrium": calculation} for calculation in calculations[3:]]})]
+
+    results = _execute_stream(tmpdir, lines, 4)
+
+    # The system line is answered with the names of the species
+    assert results[0]["line"] == 1
+    species = results[0]["species"]
+    assert "H2O(l)" in species
+
+    # The results of the calculations are output in the order they were read, with the errors on their lines
+    results = results[1:]
+    assert [result.get("index") for result in results] == [0, 1, 2, None, 3, 4, 5]
+    assert results[3]["line"] == 6 and "error" in results[3]
+
+    results = [result for result in results if "index" in result]
+    assert [result["stateReference"] for result in results] == ["State{}".format(i) for i in range(6)]
+
+    # The results match those of the interpreter executing the same calculations one at a time
+    interpreter = Interpreter()
+    interpreter.executeJsonString(json.dumps({
+        "system": SYSTEM,
+        "calculations": [{"equilibrium": calculation} for calculation in calculations],
+    }))
+
+    for result in results:
+        expected = interpreter.state(result["stateReference"]).speciesAmounts()
+        assert len(result["speciesAmounts"]) == len(species)
+        assert result["speciesAmounts"] == pytest.approx(expected, rel=1e-10, abs=1e-16)
+
+
+def test_interpreter_stream_is_independent_of_number_of_threads(tmpdir):
+    lines = [json.dumps({"system": SYSTEM})]
+    lines += [json.dumps({"equilibrium": _equilibrium("State{}".format(i), 0.05 * (i + 1))}) for i in range(8)]
+
+    serial = _execute_stream(tmpdir, lines, 1)
+    parallel = _execute_stream(tmpdir, lines, 4)
+
+    assert len(serial) == len(parallel) == 9
+    for expected, actual in zip(serial[1:], parallel[1:]):
+        assert actual["index"] == expected["index"]
+        assert actual["speciesAmounts"] == pytest.approx(expected["speciesAmounts"], rel=1e-12, abs=1e-16)
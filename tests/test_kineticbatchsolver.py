@@ -0,0 +1,108 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    KineticBatchOptions,
+    KineticBatchSolver,
+    KineticSolver,
+    Partition,
+    ReactionSystem,
+)
+
+
+def _create_kinetic_problem():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+
+    calcite = editor.addMineralReaction("Calcite")
+    calcite.setEquation("Calcite = Ca++ + CO3--")
+    calcite.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    return system, reactions, partition
+
+
+def _create_states(system, partition, size):
+    # Create chemical states with increasing amounts of HCl, so that each one dissolves calcite differently
+    states = []
+    for i in range(size):
+        problem = EquilibriumProblem(system)
+        problem.setPartition(partition)
+        problem.add("H2O", 1, "kg")
+        problem.add("HCl", 1 + i, "mmol")
+
+        state = ChemicalState(system)
+        equilibrate(state, problem)
+        state.setSpeciesMass("Calcite", 100, "g")
+        states.append(state)
+
+    return states
+
+
+def _solve_batch(reactions, partition, states, num_threads):
+    options = KineticBatchOptions()
+    options.num_threads = num_threads
+
+    solver = KineticBatchSolver(reactions, len(states))
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    return solver.solve(states, 0.0, 60.0)
+
+
+def test_kinetic_batch_solver_matches_kinetic_solver():
+    system, reactions, partition = _create_kinetic_problem()
+    states = _create_states(system, partition, 8)
+
+    batch_states = _solve_batch(reactions, partition, states, 4)
+
+    for state, batch_state in zip(states, batch_states):
+        solver = KineticSolver(reactions)
+        solver.setPartition(partition)
+        solver.solve(state, 0.0, 60.0)
+
+        assert batch_state.speciesAmounts() == pytest.approx(state.speciesAmounts(), rel=1e-6, abs=1e-14)
+
+
+def test_kinetic_batch_solver_is_independent_of_number_of_threads():
+    system, reactions, partition = _create_kinetic_problem()
+    states = _create_states(system, partition, 16)
+
+    serial_states = _solve_batch(reactions, partition, states, 1)
+    parallel_states = _solve_batch(reactions, partition, states, 4)
+
+    for serial_state, parallel_state in zip(serial_states, parallel_states):
+        assert parallel_state.speciesAmounts() == pytest.approx(serial_state.speciesAmounts(), rel=1e-12, abs=1e-16)
@@ -0,0 +1,119 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    KineticPath,
+    KineticPathOptions,
+    Partition,
+    ReactionSystem,
+)
+
+
+def _create_kinetic_path():
+    editor = ChemicalEditor(Database("supcrt98.xml"))
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addMineralPhase("Calcite")
+
+    calcite = editor.addMineralReaction("Calcite")
+    calcite.setEquation("Calcite = Ca++ + CO3--")
+    calcite.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+
+    state = ChemicalState(system)
+    equilibrate(state, problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+
+    path = KineticPath(reactions)
+    path.setPartition(partition)
+
+    return path, state
+
+
+def test_kinetic_path_solved_twice_gives_same_results():
+    path, state = _create_kinetic_path()
+
+    # The second calculation reuses the integrator of the first one
+    first = state.clone()
+    path.solve(first, 0, 5, "minute")
+
+    second = state.clone()
+    path.solve(second, 0, 5, "minute")
+
+    assert second.speciesAmounts() == pytest.approx(first.speciesAmounts(), rel=1e-12)
+
+
+def test_kinetic_path_batch_matches_single_paths():
+    path, state = _create_kinetic_path()
+
+    initial_states = []
+    for mass in [10.0, 50.0, 100.0]:
+        initial_states.append(state.clone())
+        initial_states[-1].setSpeciesMass("Calcite", mass, "g")
+
+    final_states, results = path.solve([s.clone() for s in initial_states], 0, 5, "minute")
+    assert len(final_states) == len(initial_states)
+    assert len(results) == len(initial_states)
+
+    for initial_state, final_state in zip(initial_states, final_states):
+        expected = initial_state.clone()
+        path.solve(expected, 0, 5, "minute")
+        assert final_state.speciesAmounts() == pytest.approx(expected.speciesAmounts(), rel=1e-12)
+
+
+def test_kinetic_path_output_interval(tmp_path):
+    path, state = _create_kinetic_path()
+
+    options = KineticPathOptions()
+    options.kinetics.ode.reltol = 1e-6
+    options.output_interval = 20.0
+    path.setOptions(options)
+
+    filename = str(tmp_path / "output.txt")
+    output = path.output()
+    output.filename(filename)
+    output.add("time(units=s)")
+    output.add("pH")
+
+    path.solve(state, 0, 100, "s")
+    output.close()
+
+    # One row at each multiple of the interval in [0, 100), and one for the final time
+    rows = np.loadtxt(filename, skiprows=1, ndmin=2)
+    assert rows[:, 0] == pytest.approx([0.0, 20.0, 40.0, 60.0, 80.0, 100.0])
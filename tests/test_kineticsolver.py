@@ -0,0 +1,179 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalProperties,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    KineticOptions,
+    KineticSolver,
+    ODELinearSolver,
+    Partition,
+    ReactionSystem,
+)
+
+
+def _create_kinetic_problem():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+
+    calcite = editor.addMineralReaction("Calcite")
+    calcite.setEquation("Calcite = Ca++ + CO3--")
+    calcite.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+
+    state = ChemicalState(system)
+    equilibrate(state, problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+
+    return reactions, partition, state
+
+
+def _solve_kinetic_path(reactions, partition, state, options, times):
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    path = []
+    for t0, t1 in zip(times[:-1], times[1:]):
+        solver.solve(state, t0, t1 - t0)
+        path.append(state.speciesAmounts().copy())
+
+    return solver, path
+
+
+def test_kinetic_solver_first_order_estimates_match_full_equilibrium():
+    reactions, partition, state = _create_kinetic_problem()
+    times = [0.0, 10.0, 30.0, 60.0, 120.0, 300.0]
+
+    options = KineticOptions()
+    options.ode.reltol = 1e-6
+    options.ode.abstol = 1e-12
+
+    _, expected = _solve_kinetic_path(reactions, partition, state.clone(), options, times)
+
+    # Accept only estimates whose ln activities are within the ODE tolerance of those of the reference state
+    options.smart.active = True
+    options.smart.reltol = 1e-6
+    options.smart.abstol = 1e-8
+
+    solver, actual = _solve_kinetic_path(reactions, partition, state.clone(), options, times)
+
+    assert solver.result().smart.num_estimates > 0
+    assert solver.result().smart.num_equilibrium_calculations > 0
+
+    for n, expected_n in zip(actual, expected):
+        assert n == pytest.approx(expected_n, rel=1e-4, abs=1e-12)
+
+
+@pytest.mark.parametrize("linear_solver", [
+    ODELinearSolver.Band,
+    ODELinearSolver.Spgmr,
+    ODELinearSolver.Spbcg,
+    ODELinearSolver.Sparse,
+])
+def test_kinetic_solver_ode_linear_solvers_match_dense(linear_solver):
+    reactions, partition, state = _create_kinetic_problem()
+    times = [0.0, 10.0, 30.0, 60.0, 120.0, 300.0]
+
+    options = KineticOptions()
+    options.ode.reltol = 1e-8
+    options.ode.abstol = 1e-14
+
+    _, expected = _solve_kinetic_path(reactions, partition, state.clone(), options, times)
+
+    options.ode.linear_solver.type = linear_solver
+
+    # The unknowns of the kinetic ODE are the amounts of equilibrium elements and kinetic species,
+    # and a full half-bandwidth makes the band linear solver applicable to its dense Jacobian
+    num_equations = partition.numEquilibriumElements() + partition.numKineticSpecies()
+    options.ode.linear_solver.mupper = num_equations - 1
+    options.ode.linear_solver.mlower = num_equations - 1
+
+    _, actual = _solve_kinetic_path(reactions, partition, state.clone(), options, times)
+
+    for n, expected_n in zip(actual, expected):
+        assert n == pytest.approx(expected_n, rel=1e-5, abs=1e-12)
+
+
+def test_kinetic_solver_source_rates_derivatives_match_finite_differences():
+    reactions, partition, state = _create_kinetic_problem()
+    system = reactions.system()
+
+    # Deplete the gaseous phase so that a sink on it has no volume to drain
+    igaseous = system.indexPhase("Gaseous")
+    for i in system.indicesSpeciesInPhases([igaseous]):
+        state.setSpeciesAmount(i, 0.0)
+
+    def create_solver(with_empty_sink):
+        solver = KineticSolver(reactions)
+        solver.setPartition(partition)
+        solver.addSource(state.clone(), 1e-6, "m3/s")
+        solver.addFluidSink(2e-6, "m3/s")
+        if with_empty_sink:
+            solver.addPhaseSink("Gaseous", 1e-6, "m3/s")
+        return solver
+
+    T = state.temperature()
+    P = state.pressure()
+    n = state.speciesAmounts().copy()
+
+    def source_rates(solver, n):
+        properties = ChemicalProperties(system)
+        properties.update(T, P, n)
+        q = solver.sourceRates(properties)
+        return q.val.copy(), q.ddn.copy()
+
+    solver = create_solver(with_empty_sink=True)
+    q, dqdn = source_rates(solver, n)
+
+    # A sink on a phase without volume contributes nothing to the source rates
+    q_expected, dqdn_expected = source_rates(create_solver(with_empty_sink=False), n)
+    assert q == pytest.approx(q_expected, rel=1e-14, abs=1e-20)
+    assert dqdn == pytest.approx(dqdn_expected, rel=1e-14, abs=1e-20)
+
+    for j in np.flatnonzero(n > 0.0):
+        h = 1e-6 * n[j]
+        n_plus, n_minus = n.copy(), n.copy()
+        n_plus[j] += h
+        n_minus[j] -= h
+        dqdnj = (source_rates(solver, n_plus)[0] - source_rates(solver, n_minus)[0]) / (2 * h)
+        assert dqdn[:, j] == pytest.approx(dqdnj, rel=1e-5, abs=1e-14)
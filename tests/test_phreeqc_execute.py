@@ -15,6 +15,11 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+
 from reaktoro import *
 from pytest import approx
 
@@ -34,3 +39,80 @@ def test_phreeqc_execute(shared_datadir):
     assert approx(p.numSpecies()) == 44
     assert approx(p.numPhases()) == 1
 
+
+def test_phreeqc_system_evaluated_concurrently(shared_datadir):
+    """Test the concurrent evaluation of a chemical system created from a Phreeqc instance."""
+
+    database_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / 'phreeqc.dat').parts])
+    input_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / 'IW.pqi').parts])
+
+    p = Phreeqc(database_path)
+    p.execute(input_path)
+
+    assert p.isReplicable()
+
+    system = p.system()
+    state = p.state(system)
+
+    assert system.hasReentrantModels()
+
+    T = state.temperature()
+    P = state.pressure()
+    b = state.elementAmounts()
+    factors = [1.0, 0.9, 1.1, 0.8, 1.2, 0.95, 1.05, 1.15]
+
+    def solve(factor):
+        # Each thread uses its own solver, so only the Phreeqc instances behind the system are shared
+        solver = EquilibriumSolver(system)
+        result_state = state.clone()
+        result = solver.solve(result_state, T, P, b * factor)
+        assert result.optimum.succeeded
+        return result_state.speciesAmounts().copy()
+
+    expected = [solve(factor) for factor in factors]
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        actual = list(executor.map(solve, factors))
+
+    for n, expected_n in zip(actual, expected):
+        assert n == approx(expected_n, rel=1e-10, abs=1e-20)
+
+
+@pytest.mark.parametrize("database", ["phreeqc.dat", "pitzer.dat"])
+def test_phreeqc_ln_activities_derivatives(shared_datadir, database):
+    """Test the molar derivatives of the ln activities of a Phreeqc instance against central finite differences."""
+
+    database_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / database).parts])
+
+    p = Phreeqc(database_path)
+    p.execute("""
+        SOLUTION 1
+            temp  25
+            units mol/kgw
+            Na    1.0
+            Cl    1.0 charge
+            Ca    0.1
+        END
+    """)
+
+    system = p.system()
+    state = p.state(system)
+
+    T = state.temperature()
+    P = state.pressure()
+    n = state.speciesAmounts().copy()
+
+    dlnadn = system.properties(T, P, n).lnActivities().ddn.copy()
+
+    def ln_activities(n):
+        return system.properties(T, P, n).lnActivities().val.copy()
+
+    # Only the derivatives w.r.t. the amounts of the major species are compared, since the forward
+    # differences of the Pitzer model use a step that is too large for the amounts of trace species
+    for j in np.flatnonzero(n > 1e-6):
+        h = 1e-6 * n[j]
+        n_plus, n_minus = n.copy(), n.copy()
+        n_plus[j] += h
+        n_minus[j] -= h
+        expected = (ln_activities(n_plus) - ln_activities(n_minus)) / (2 * h)
+        assert dlnadn[:, j] == approx(expected, rel=1e-3, abs=1e-4 * np.abs(expected).max())
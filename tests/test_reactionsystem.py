@@ -0,0 +1,102 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalState,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    Partition,
+    ReactionSystem,
+)
+
+
+def _assert_same_chemical_scalar(actual_val, actual_ddT, actual_ddP, actual_ddn, expected):
+    assert actual_val == pytest.approx(expected.val, rel=1e-8, abs=1e-18)
+    assert actual_ddT == pytest.approx(expected.ddT, rel=1e-8, abs=1e-18)
+    assert actual_ddP == pytest.approx(expected.ddP, rel=1e-8, abs=1e-18)
+    assert actual_ddn == pytest.approx(expected.ddn, rel=1e-8, abs=1e-18)
+
+
+def test_reaction_system_vectorized_functions_match_per_reaction_functions():
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3 MgCO3")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+    editor.addMineralPhase("Dolomite")
+
+    # A mechanism catalysed by the activity of H+ and another by the partial pressure of CO2(g)
+    editor.addMineralReaction("Calcite") \
+        .setEquation("Calcite = Ca++ + CO3--") \
+        .addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol") \
+        .addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0") \
+        .addMechanism("logk = -3.48 mol/(m2*s); Ea = 35.4 kJ/mol; p[CO2(g)] = 1.0") \
+        .setSpecificSurfaceArea(10, "cm2/g")
+
+    editor.addMineralReaction("Dolomite") \
+        .setEquation("Dolomite = Ca++ + Mg++ + 2*CO3--") \
+        .addMechanism("logk = -7.53 mol/(m2*s); Ea = 52.2 kJ/mol") \
+        .addMechanism("logk = -3.19 mol/(m2*s); Ea = 36.1 kJ/mol; a[H+] = 0.5") \
+        .setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite", "Dolomite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.setTemperature(60, "celsius")
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+    problem.add("MgCl2", 0.1, "mmol")
+    problem.add("CO2", 10, "mmol")
+
+    state = ChemicalState(system)
+    equilibrate(state, problem)
+
+    # Calcite is present and Dolomite is left with zero amount
+    state.setSpeciesMass("Calcite", 100, "g")
+    state.setSpeciesAmount("Dolomite", 0.0)
+
+    properties = state.properties()
+
+    rates = reactions.rates(properties)
+    lnQ = reactions.lnReactionQuotients(properties)
+    lnK = reactions.lnEquilibriumConstants(properties)
+
+    for i, reaction in enumerate(reactions.reactions()):
+        rate = reaction.rate(properties)
+        _assert_same_chemical_scalar(rates.val[i], rates.ddT[i], rates.ddP[i], rates.ddn[i], rate)
+
+        lnQi = reaction.lnReactionQuotient(properties)
+        _assert_same_chemical_scalar(lnQ.val[i], lnQ.ddT[i], lnQ.ddP[i], lnQ.ddn[i], lnQi)
+
+        lnKi = reaction.lnEquilibriumConstant(properties)
+        assert lnK.val[i] == pytest.approx(lnKi.val, rel=1e-8)
+        assert lnK.ddT[i] == pytest.approx(lnKi.ddT, rel=1e-8, abs=1e-18)
+        assert lnK.ddP[i] == pytest.approx(lnKi.ddP, rel=1e-8, abs=1e-18)
+